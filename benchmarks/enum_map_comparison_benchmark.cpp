@@ -0,0 +1,167 @@
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// Typical for state machines and feature flags
+// clang-format off
+enum class Key : std::uint8_t
+{
+    K00, K01, K02, K03, K04, K05, K06, K07, K08, K09, K10, K11, K12, K13, K14, K15,
+    K16, K17, K18, K19, K20, K21, K22, K23, K24, K25, K26, K27, K28, K29, K30, K31,
+};
+// clang-format on
+constexpr std::size_t KEY_COUNT = 32;
+
+// Arguments of every benchmark: the number of keys present and whether they are visited in order
+constexpr std::int64_t SEQUENTIAL_KEYS = 0;
+constexpr std::int64_t RANDOM_KEYS = 1;
+
+std::vector<Key> make_keys(const benchmark::State& state, const unsigned seed)
+{
+    std::vector<Key> keys(KEY_COUNT);
+    for (std::size_t i = 0; i < KEY_COUNT; i++)
+    {
+        keys[i] = static_cast<Key>(i);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937{seed});
+    keys.resize(static_cast<std::size_t>(state.range(0)));
+    if (state.range(1) == SEQUENTIAL_KEYS)
+    {
+        std::sort(keys.begin(), keys.end());
+    }
+    return keys;
+}
+
+template <class Container>
+void insert_key(Container& container, const Key key)
+{
+    if constexpr (requires { typename Container::mapped_type; })
+    {
+        container.try_emplace(key, static_cast<std::int64_t>(key));
+    }
+    else
+    {
+        container.insert(key);
+    }
+}
+
+template <class Container>
+void benchmark_insert(benchmark::State& state)
+{
+    const std::vector<Key> keys = make_keys(state, 1);
+    Container container{};
+
+    for (auto _ : state)
+    {
+        container.clear();
+        for (const Key key : keys)
+        {
+            insert_key(container, key);
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Every key is looked up, whether it is present or not
+template <class Container>
+void benchmark_contains(benchmark::State& state)
+{
+    const std::vector<Key> keys = make_keys(state, 2);
+    Container container{};
+    for (const Key key : keys)
+    {
+        insert_key(container, key);
+    }
+    std::array<Key, KEY_COUNT> lookups{};
+    for (std::size_t i = 0; i < KEY_COUNT; i++)
+    {
+        lookups[i] = static_cast<Key>(i);
+    }
+    if (state.range(1) == RANDOM_KEYS)
+    {
+        std::shuffle(lookups.begin(), lookups.end(), std::mt19937{3});
+    }
+
+    for (auto _ : state)
+    {
+        for (const Key key : lookups)
+        {
+            benchmark::DoNotOptimize(container.contains(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * KEY_COUNT));
+}
+
+template <class Container>
+void benchmark_iterate(benchmark::State& state)
+{
+    const std::vector<Key> keys = make_keys(state, 4);
+    Container container{};
+    for (const Key key : keys)
+    {
+        insert_key(container, key);
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& entry : container)
+        {
+            benchmark::DoNotOptimize(&entry);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <class Container>
+void register_benchmarks(const std::string& name)
+{
+    const auto configure = [](benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgsProduct({{4, 16, KEY_COUNT}, {SEQUENTIAL_KEYS, RANDOM_KEYS}})
+            ->ArgNames({"size", "random"});
+    };
+    configure(
+        benchmark::RegisterBenchmark(("insert/" + name).c_str(), benchmark_insert<Container>));
+    configure(
+        benchmark::RegisterBenchmark(("contains/" + name).c_str(), benchmark_contains<Container>));
+    configure(
+        benchmark::RegisterBenchmark(("iterate/" + name).c_str(), benchmark_iterate<Container>));
+}
+
+}  // namespace
+}  // namespace fixed_containers
+
+int main(int argc, char** argv)
+{
+    using fixed_containers::Key;
+    fixed_containers::register_benchmarks<fixed_containers::EnumMap<Key, std::int64_t>>("EnumMap");
+    fixed_containers::register_benchmarks<std::map<Key, std::int64_t>>("std::map");
+    fixed_containers::register_benchmarks<std::unordered_map<Key, std::int64_t>>(
+        "std::unordered_map");
+    fixed_containers::register_benchmarks<fixed_containers::EnumSet<Key>>("EnumSet");
+    fixed_containers::register_benchmarks<std::set<Key>>("std::set");
+    fixed_containers::register_benchmarks<std::unordered_set<Key>>("std::unordered_set");
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include "fixed_containers/fixed_btree_map.hpp"
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 65536;
+constexpr std::size_t SCAN_LENGTH = 64;
+
+// Records the addresses of the keys that a lookup compares against, so that the number of
+// distinct keys (i.e. tree nodes, for FixedMap) and cache lines visited can be reported
+struct TouchRecordingLess
+{
+    static inline const std::int64_t* probe = nullptr;
+    static inline std::set<std::uintptr_t> touched_keys{};
+
+    bool operator()(const std::int64_t& left, const std::int64_t& right) const
+    {
+        record(left);
+        record(right);
+        return left < right;
+    }
+
+    static void record(const std::int64_t& key)
+    {
+        if (&key != probe)
+        {
+            touched_keys.insert(reinterpret_cast<std::uintptr_t>(&key));
+        }
+    }
+};
+
+template <class Compare>
+using TreeMap = FixedMap<std::int64_t, std::int64_t, CAP, Compare>;
+template <class Compare>
+using BTreeMap = FixedBTreeMap<std::int64_t, std::int64_t, CAP, Compare>;
+
+// Even keys in random order, so that odd keys can be used for misses
+std::vector<std::int64_t> shuffled_even_keys(const std::size_t count, const unsigned seed)
+{
+    std::vector<std::int64_t> out(count);
+    std::iota(out.begin(), out.end(), 0);
+    for (std::int64_t& key : out)
+    {
+        key *= 2;
+    }
+    std::shuffle(out.begin(), out.end(), std::mt19937{seed});
+    return out;
+}
+
+// Maps of this size do not fit on the stack
+template <template <class> class MapTemplate, class Compare>
+std::unique_ptr<MapTemplate<Compare>> make_filled_map(const std::vector<std::int64_t>& keys)
+{
+    auto map = std::make_unique<MapTemplate<Compare>>();
+    for (const std::int64_t key : keys)
+    {
+        map->try_emplace(key, key);
+    }
+    return map;
+}
+
+template <template <class> class MapTemplate>
+void report_touched_memory(benchmark::State& state, const std::vector<std::int64_t>& keys)
+{
+    const auto map = make_filled_map<MapTemplate, TouchRecordingLess>(keys);
+    std::size_t key_count = 0;
+    std::size_t line_count = 0;
+    for (const std::int64_t& key : keys)
+    {
+        TouchRecordingLess::probe = &key;
+        TouchRecordingLess::touched_keys.clear();
+        benchmark::DoNotOptimize(map->find(key));
+
+        std::set<std::uintptr_t> lines{};
+        for (const std::uintptr_t address : TouchRecordingLess::touched_keys)
+        {
+            lines.insert(address / cache_line_detail::CACHE_LINE_SIZE);
+        }
+        key_count += TouchRecordingLess::touched_keys.size();
+        line_count += lines.size();
+    }
+    const auto lookup_count = static_cast<double>(keys.size());
+    state.counters["keys_touched"] = static_cast<double>(key_count) / lookup_count;
+    state.counters["lines_touched"] = static_cast<double>(line_count) / lookup_count;
+}
+
+template <template <class> class MapTemplate>
+void benchmark_lookup(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 1);
+    const auto map = make_filled_map<MapTemplate, std::less<std::int64_t>>(keys);
+
+    for (auto _ : state)
+    {
+        for (const std::int64_t key : keys)
+        {
+            benchmark::DoNotOptimize(map->find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+
+    report_touched_memory<MapTemplate>(state, keys);
+    if constexpr (requires { map->depth(); })
+    {
+        state.counters["depth"] = static_cast<double>(map->depth());
+    }
+}
+
+// lower_bound() on a random key, then SCAN_LENGTH entries in order
+template <template <class> class MapTemplate>
+void benchmark_range_scan(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 2);
+    const auto map = make_filled_map<MapTemplate, std::less<std::int64_t>>(keys);
+
+    std::size_t scanned = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < keys.size(); i += SCAN_LENGTH)
+        {
+            std::int64_t sum = 0;
+            auto it = map->lower_bound(keys[i]);
+            for (std::size_t j = 0; j < SCAN_LENGTH && it != map->end(); j++, ++it)
+            {
+                // FixedBTreeMap iterators return a PairView, FixedMap iterators a std::pair
+                if constexpr (requires { it->second(); })
+                {
+                    sum += it->second();
+                }
+                else
+                {
+                    sum += it->second;
+                }
+                scanned++;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(scanned));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_lookup<TreeMap>)->RangeMultiplier(4)->Range(256, CAP);
+BENCHMARK(benchmark_lookup<BTreeMap>)->RangeMultiplier(4)->Range(256, CAP);
+BENCHMARK(benchmark_range_scan<TreeMap>)->RangeMultiplier(4)->Range(256, CAP);
+BENCHMARK(benchmark_range_scan<BTreeMap>)->RangeMultiplier(4)->Range(256, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+#include "fixed_containers/fixed_flat_map.hpp"
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 4096;
+
+using TreeMap = FixedMap<std::int64_t, std::int64_t, CAP>;
+using FlatMap = FixedFlatMap<std::int64_t, std::int64_t, CAP>;
+
+// Even keys in random order, so that odd keys can be used for misses
+std::vector<std::int64_t> shuffled_even_keys(const std::size_t count, const unsigned seed)
+{
+    std::vector<std::int64_t> out(count);
+    std::iota(out.begin(), out.end(), 0);
+    for (std::int64_t& key : out)
+    {
+        key *= 2;
+    }
+    std::shuffle(out.begin(), out.end(), std::mt19937{seed});
+    return out;
+}
+
+template <class MapType>
+void fill(MapType& map, const std::vector<std::int64_t>& keys)
+{
+    for (const std::int64_t key : keys)
+    {
+        map.try_emplace(key, key);
+    }
+}
+
+template <class MapType>
+void benchmark_lookup(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 1);
+    MapType map{};
+    fill(map, keys);
+
+    for (auto _ : state)
+    {
+        for (const std::int64_t key : keys)
+        {
+            benchmark::DoNotOptimize(map.find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <class MapType>
+void benchmark_iteration(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    MapType map{};
+    fill(map, shuffled_even_keys(size, 2));
+
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (auto&& [key, value] : map)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+// One insert() per key, in random order
+template <class MapType>
+void benchmark_insert(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 3);
+    MapType map{};
+
+    for (auto _ : state)
+    {
+        map.clear();
+        fill(map, keys);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+// All keys at once, in random order
+template <class MapType>
+void benchmark_insert_range(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 3);
+    std::vector<std::pair<const std::int64_t, std::int64_t>> entries{};
+    for (const std::int64_t key : keys)
+    {
+        entries.emplace_back(key, key);
+    }
+    MapType map{};
+
+    for (auto _ : state)
+    {
+        map.clear();
+        map.insert(entries.begin(), entries.end());
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_lookup<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_lookup<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_iteration<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_iteration<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_insert<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_insert<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_insert_range<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_insert_range<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 65536;
+// Keys looked up together, as in one message of a request router
+constexpr std::size_t BATCH_SIZE = 32;
+
+template <template <class, std::size_t> class StorageTemplate>
+using MapType =
+    FixedMap<std::int64_t,
+             std::int64_t,
+             CAP,
+             std::less<std::int64_t>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             StorageTemplate>;
+
+std::vector<std::int64_t> shuffled_keys(const std::size_t count, const unsigned seed)
+{
+    std::vector<std::int64_t> out(count);
+    std::iota(out.begin(), out.end(), 0);
+    std::shuffle(out.begin(), out.end(), std::mt19937{seed});
+    return out;
+}
+
+// Maps of this size do not fit on the stack
+template <template <class, std::size_t> class StorageTemplate>
+std::unique_ptr<MapType<StorageTemplate>> make_filled_map(const std::size_t size)
+{
+    auto map = std::make_unique<MapType<StorageTemplate>>();
+    for (const std::int64_t key : shuffled_keys(size, 1))
+    {
+        map->try_emplace(key, key);
+    }
+    return map;
+}
+
+template <template <class, std::size_t> class StorageTemplate>
+void benchmark_find_loop(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto map = make_filled_map<StorageTemplate>(size);
+    const std::vector<std::int64_t> keys = shuffled_keys(size, 2);
+    std::array<typename MapType<StorageTemplate>::const_iterator, BATCH_SIZE> out{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t begin = 0; begin + BATCH_SIZE <= keys.size(); begin += BATCH_SIZE)
+        {
+            for (std::size_t j = 0; j < BATCH_SIZE; j++)
+            {
+                out[j] = std::as_const(*map).find(keys[begin + j]);
+            }
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <template <class, std::size_t> class StorageTemplate>
+void benchmark_find_batch(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto map = make_filled_map<StorageTemplate>(size);
+    const std::vector<std::int64_t> keys = shuffled_keys(size, 2);
+    std::array<typename MapType<StorageTemplate>::const_iterator, BATCH_SIZE> out{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t begin = 0; begin + BATCH_SIZE <= keys.size(); begin += BATCH_SIZE)
+        {
+            std::as_const(*map).find_batch(
+                std::span<const std::int64_t>{keys}.subspan(begin, BATCH_SIZE), out);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_find_loop<FixedIndexBasedPoolStorage>)->RangeMultiplier(4)->Range(1024, CAP);
+BENCHMARK(benchmark_find_batch<FixedIndexBasedPoolStorage>)->RangeMultiplier(4)->Range(1024, CAP);
+BENCHMARK(benchmark_find_loop<FixedIndexBasedContiguousStorage>)
+    ->RangeMultiplier(4)
+    ->Range(1024, CAP);
+BENCHMARK(benchmark_find_batch<FixedIndexBasedContiguousStorage>)
+    ->RangeMultiplier(4)
+    ->Range(1024, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
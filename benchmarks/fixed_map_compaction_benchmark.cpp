@@ -0,0 +1,97 @@
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 65536;
+
+// Large enough values for the layout of the nodes to matter
+using MapType = FixedMap<std::int64_t, std::array<std::int64_t, 4>, CAP>;
+
+// Fills the map in random order and replaces half of the entries, which leaves entries that are
+// next to each other in iteration order scattered across the storage
+std::unique_ptr<MapType> make_churned_map(const std::size_t size)
+{
+    std::vector<std::int64_t> keys(size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::mt19937 random_engine{1};
+    std::shuffle(keys.begin(), keys.end(), random_engine);
+
+    auto map = std::make_unique<MapType>();
+    for (const std::int64_t key : keys)
+    {
+        map->try_emplace(key, std::array<std::int64_t, 4>{key});
+    }
+    std::shuffle(keys.begin(), keys.end(), random_engine);
+    for (std::size_t i = 0; i < size / 2; i++)
+    {
+        map->erase(keys[i]);
+    }
+    for (std::size_t i = 0; i < size / 2; i++)
+    {
+        map->try_emplace(keys[i], std::array<std::int64_t, 4>{keys[i]});
+    }
+    return map;
+}
+
+template <bool COMPACTED>
+void benchmark_iterate(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto map = make_churned_map(size);
+    if constexpr (COMPACTED)
+    {
+        map->compact_in_order();
+    }
+    state.counters["fragmentation"] = static_cast<double>(map->fragmentation());
+
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const auto& [key, value] : *map)
+        {
+            sum += value[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void benchmark_compact(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto churned = make_churned_map(size);
+    auto map = std::make_unique<MapType>();
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        *map = *churned;
+        state.ResumeTiming();
+        map->compact_in_order();
+        benchmark::DoNotOptimize(map->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_iterate<false>)->RangeMultiplier(8)->Range(1024, CAP);
+BENCHMARK(benchmark_iterate<true>)->RangeMultiplier(8)->Range(1024, CAP);
+BENCHMARK(benchmark_compact)->RangeMultiplier(8)->Range(1024, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
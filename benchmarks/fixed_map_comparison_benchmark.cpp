@@ -0,0 +1,212 @@
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 16384;
+
+using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+constexpr auto EMBEDDED_COLOR = Compactness::EMBEDDED_COLOR;
+constexpr auto DEDICATED_COLOR = Compactness::DEDICATED_COLOR;
+
+// Large enough for the layout of the nodes to matter
+using LargeValue = std::array<std::int64_t, 16>;
+
+template <class V, Compactness COMPACTNESS, template <class, std::size_t> class StorageTemplate>
+using FixedMapType =
+    FixedMap<std::int64_t, V, CAP, std::less<std::int64_t>, COMPACTNESS, StorageTemplate>;
+template <Compactness COMPACTNESS, template <class, std::size_t> class StorageTemplate>
+using FixedSetType =
+    FixedSet<std::int64_t, CAP, std::less<std::int64_t>, COMPACTNESS, StorageTemplate>;
+
+// Arguments of every benchmark: the number of entries and whether keys arrive in order
+constexpr std::int64_t SEQUENTIAL_KEYS = 0;
+constexpr std::int64_t RANDOM_KEYS = 1;
+
+std::vector<std::int64_t> make_keys(const benchmark::State& state, const unsigned seed)
+{
+    std::vector<std::int64_t> keys(static_cast<std::size_t>(state.range(0)));
+    std::iota(keys.begin(), keys.end(), 0);
+    if (state.range(1) == RANDOM_KEYS)
+    {
+        std::shuffle(keys.begin(), keys.end(), std::mt19937{seed});
+    }
+    return keys;
+}
+
+template <class Container>
+void insert_key(Container& container, const std::int64_t key)
+{
+    if constexpr (requires { typename Container::mapped_type; })
+    {
+        container.try_emplace(key);
+    }
+    else
+    {
+        container.insert(key);
+    }
+}
+
+// The large fixed containers do not fit on the stack
+template <class Container>
+std::unique_ptr<Container> make_filled(const std::vector<std::int64_t>& keys)
+{
+    auto container = std::make_unique<Container>();
+    for (const std::int64_t key : keys)
+    {
+        insert_key(*container, key);
+    }
+    return container;
+}
+
+// Clears and refills, which is how long-lived instances are reused
+template <class Container>
+void benchmark_insert(benchmark::State& state)
+{
+    const std::vector<std::int64_t> keys = make_keys(state, 1);
+    auto container = std::make_unique<Container>();
+
+    for (auto _ : state)
+    {
+        container->clear();
+        for (const std::int64_t key : keys)
+        {
+            insert_key(*container, key);
+        }
+        benchmark::DoNotOptimize(container->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Lookups always come in random order, the distribution only affects how the tree was built
+template <class Container>
+void benchmark_find(benchmark::State& state)
+{
+    const std::vector<std::int64_t> keys = make_keys(state, 2);
+    const auto container = make_filled<Container>(keys);
+    std::vector<std::int64_t> lookups = keys;
+    std::shuffle(lookups.begin(), lookups.end(), std::mt19937{3});
+
+    for (auto _ : state)
+    {
+        for (const std::int64_t key : lookups)
+        {
+            benchmark::DoNotOptimize(container->find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <class Container>
+void benchmark_iterate(benchmark::State& state)
+{
+    const std::vector<std::int64_t> keys = make_keys(state, 4);
+    const auto container = make_filled<Container>(keys);
+
+    for (auto _ : state)
+    {
+        for (const auto& entry : *container)
+        {
+            benchmark::DoNotOptimize(&entry);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Erases and re-inserts half of the entries: descents plus rebalancing
+template <class Container>
+void benchmark_erase_and_insert(benchmark::State& state)
+{
+    const std::vector<std::int64_t> keys = make_keys(state, 5);
+    const auto container = make_filled<Container>(keys);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+        {
+            container->erase(keys[i]);
+        }
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+        {
+            insert_key(*container, keys[i]);
+        }
+        benchmark::DoNotOptimize(container->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <class Container>
+void register_benchmarks(const std::string& name)
+{
+    const auto configure = [](benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgsProduct({{64, 1024, CAP}, {SEQUENTIAL_KEYS, RANDOM_KEYS}})
+            ->ArgNames({"size", "random"});
+    };
+    configure(
+        benchmark::RegisterBenchmark(("insert/" + name).c_str(), benchmark_insert<Container>));
+    configure(benchmark::RegisterBenchmark(("find/" + name).c_str(), benchmark_find<Container>));
+    configure(
+        benchmark::RegisterBenchmark(("iterate/" + name).c_str(), benchmark_iterate<Container>));
+    configure(benchmark::RegisterBenchmark(("erase_and_insert/" + name).c_str(),
+                                           benchmark_erase_and_insert<Container>));
+}
+
+template <class V>
+void register_map_benchmarks(const std::string& value_name)
+{
+    register_benchmarks<FixedMapType<V, EMBEDDED_COLOR, FixedIndexBasedPoolStorage>>(
+        "FixedMap<EMBEDDED_COLOR,Pool>/" + value_name);
+    register_benchmarks<FixedMapType<V, EMBEDDED_COLOR, FixedIndexBasedContiguousStorage>>(
+        "FixedMap<EMBEDDED_COLOR,Contiguous>/" + value_name);
+    register_benchmarks<FixedMapType<V, DEDICATED_COLOR, FixedIndexBasedPoolStorage>>(
+        "FixedMap<DEDICATED_COLOR,Pool>/" + value_name);
+    register_benchmarks<FixedMapType<V, DEDICATED_COLOR, FixedIndexBasedContiguousStorage>>(
+        "FixedMap<DEDICATED_COLOR,Contiguous>/" + value_name);
+    register_benchmarks<std::map<std::int64_t, V>>("std::map/" + value_name);
+}
+
+void register_set_benchmarks()
+{
+    register_benchmarks<FixedSetType<EMBEDDED_COLOR, FixedIndexBasedPoolStorage>>(
+        "FixedSet<EMBEDDED_COLOR,Pool>");
+    register_benchmarks<FixedSetType<EMBEDDED_COLOR, FixedIndexBasedContiguousStorage>>(
+        "FixedSet<EMBEDDED_COLOR,Contiguous>");
+    register_benchmarks<FixedSetType<DEDICATED_COLOR, FixedIndexBasedPoolStorage>>(
+        "FixedSet<DEDICATED_COLOR,Pool>");
+    register_benchmarks<FixedSetType<DEDICATED_COLOR, FixedIndexBasedContiguousStorage>>(
+        "FixedSet<DEDICATED_COLOR,Contiguous>");
+    register_benchmarks<std::set<std::int64_t>>("std::set");
+}
+
+}  // namespace
+}  // namespace fixed_containers
+
+int main(int argc, char** argv)
+{
+    fixed_containers::register_map_benchmarks<std::int64_t>("int64");
+    fixed_containers::register_map_benchmarks<fixed_containers::LargeValue>("128B");
+    fixed_containers::register_set_benchmarks();
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace fixed_containers
+{
+namespace
+{
+// Sized for the worst case, while most instances only ever hold a handful of entries
+constexpr std::size_t CAP = 8192;
+
+using MapType = FixedMap<std::int64_t, std::int64_t, CAP>;
+
+void fill(MapType& map, const std::int64_t count)
+{
+    for (std::int64_t i = 0; i < count; i++)
+    {
+        map.try_emplace(i, i);
+    }
+}
+
+// A short-lived map per iteration, e.g. one per request. It lives on the heap so that the stack
+// size does not matter.
+void benchmark_construct(benchmark::State& state)
+{
+    const auto count = static_cast<std::int64_t>(state.range(0));
+    auto buffer = std::make_unique<MapType>();
+
+    for (auto _ : state)
+    {
+        std::destroy_at(buffer.get());
+        MapType* map = std::construct_at(buffer.get());
+        fill(*map, count);
+        benchmark::DoNotOptimize(map->size());
+    }
+}
+
+// A long-lived map that is cleared before every use
+void benchmark_clear(benchmark::State& state)
+{
+    const auto count = static_cast<std::int64_t>(state.range(0));
+    auto map = std::make_unique<MapType>();
+
+    for (auto _ : state)
+    {
+        map->clear();
+        fill(*map, count);
+        benchmark::DoNotOptimize(map->size());
+    }
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_construct)->RangeMultiplier(8)->Range(1, CAP);
+BENCHMARK(benchmark_clear)->RangeMultiplier(8)->Range(1, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 65536;
+
+// Timestamp-keyed entries, e.g. in-flight requests indexed by their deadline
+using MapType = FixedMap<std::int64_t, std::int64_t, CAP>;
+
+// Maps of this size do not fit on the stack
+std::unique_ptr<MapType> make_filled_map(const std::size_t size)
+{
+    auto map = std::make_unique<MapType>();
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const auto timestamp = static_cast<std::int64_t>(i);
+        map->try_emplace(map->cend(), timestamp, timestamp);
+    }
+    return map;
+}
+
+// Every iteration evicts the `window` oldest entries and appends as many new ones, so the size of
+// the map stays the same. Appending is the same in both variants.
+template <bool USE_RANGE_ERASE>
+void benchmark_evict_window(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto window = static_cast<std::int64_t>(state.range(1));
+    const auto map = make_filled_map(size);
+    auto next_timestamp = static_cast<std::int64_t>(size);
+
+    for (auto _ : state)
+    {
+        const std::int64_t expiry = next_timestamp - static_cast<std::int64_t>(size) + window;
+        const auto last = map->lower_bound(expiry);
+        if constexpr (USE_RANGE_ERASE)
+        {
+            map->erase(map->begin(), last);
+        }
+        else
+        {
+            for (auto it = map->begin(); it != last;)
+            {
+                it = map->erase(it);
+            }
+        }
+
+        for (std::int64_t j = 0; j < window; j++)
+        {
+            map->try_emplace(map->cend(), next_timestamp, next_timestamp);
+            next_timestamp++;
+        }
+        benchmark::DoNotOptimize(map->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * window);
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_evict_window<false>)
+    ->ArgsProduct({{1024, CAP / 2}, {16, 256, 1024}})
+    ->ArgNames({"size", "window"});
+BENCHMARK(benchmark_evict_window<true>)
+    ->ArgsProduct({{1024, CAP / 2}, {16, 256, 1024}})
+    ->ArgNames({"size", "window"});
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
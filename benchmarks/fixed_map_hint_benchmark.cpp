@@ -0,0 +1,72 @@
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 1024;
+using MapType = FixedMap<int, int, CAP>;
+
+// Ascending keys without a hint: every insertion descends from the root
+void benchmark_ascending_emplace(benchmark::State& state)
+{
+    MapType map{};
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < CAP; i++)
+        {
+            map.emplace(static_cast<int>(i), 0);
+        }
+        benchmark::DoNotOptimize(map);
+        map.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAP));
+}
+
+// Ascending keys hinted at end(): the new entry is attached next to the current maximum
+void benchmark_ascending_emplace_hint_end(benchmark::State& state)
+{
+    MapType map{};
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < CAP; i++)
+        {
+            map.emplace_hint(map.cend(), static_cast<int>(i), 0);
+        }
+        benchmark::DoNotOptimize(map);
+        map.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAP));
+}
+
+// Ascending keys hinted with the previously inserted entry, as a merge of sorted runs would do
+void benchmark_ascending_emplace_hint_previous(benchmark::State& state)
+{
+    MapType map{};
+    for (auto _ : state)
+    {
+        MapType::const_iterator hint = map.cend();
+        for (std::size_t i = 0; i < CAP; i++)
+        {
+            hint = map.emplace_hint(hint, static_cast<int>(i), 0).first;
+        }
+        benchmark::DoNotOptimize(map);
+        map.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAP));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_ascending_emplace);
+BENCHMARK(benchmark_ascending_emplace_hint_end);
+BENCHMARK(benchmark_ascending_emplace_hint_previous);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+#include "fixed_containers/fixed_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 16384;
+// Same payload as in fixed_map_perf_test.cpp
+using LargeValue = std::array<std::array<int, 3>, 30>;
+
+template <template <class, std::size_t> class StorageTemplate>
+using LargeValueMap =
+    FixedMap<int,
+             LargeValue,
+             CAP,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             StorageTemplate>;
+
+std::vector<int> shuffled_keys(const std::size_t count, const unsigned seed)
+{
+    std::vector<int> out(count);
+    std::iota(out.begin(), out.end(), 0);
+    std::shuffle(out.begin(), out.end(), std::mt19937{seed});
+    return out;
+}
+
+// Maps of this size do not fit on the stack
+template <template <class, std::size_t> class StorageTemplate>
+std::unique_ptr<LargeValueMap<StorageTemplate>> make_filled_map(const std::vector<int>& keys)
+{
+    auto map = std::make_unique<LargeValueMap<StorageTemplate>>();
+    for (const int key : keys)
+    {
+        map->try_emplace(key);
+    }
+    return map;
+}
+
+// Descents only: nothing but keys and links is needed
+template <template <class, std::size_t> class StorageTemplate>
+void benchmark_contains(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<int> keys = shuffled_keys(size, 1);
+    const auto map = make_filled_map<StorageTemplate>(keys);
+
+    for (auto _ : state)
+    {
+        for (const int key : keys)
+        {
+            benchmark::DoNotOptimize(map->contains(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Descent followed by a read of one field of the value
+template <template <class, std::size_t> class StorageTemplate>
+void benchmark_find_and_read(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<int> keys = shuffled_keys(size, 2);
+    const auto map = make_filled_map<StorageTemplate>(keys);
+
+    for (auto _ : state)
+    {
+        for (const int key : keys)
+        {
+            benchmark::DoNotOptimize(map->find(key)->second[0][0]);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Erase and re-insert half of the entries: descents plus rebalancing
+template <template <class, std::size_t> class StorageTemplate>
+void benchmark_erase_and_insert(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<int> keys = shuffled_keys(size, 3);
+    const auto map = make_filled_map<StorageTemplate>(keys);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+        {
+            map->erase(keys[i]);
+        }
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+        {
+            map->try_emplace(keys[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_contains<FixedIndexBasedPoolStorage>)->RangeMultiplier(4)->Range(64, CAP);
+BENCHMARK(benchmark_contains<FixedIndexBasedSplitPoolStorage>)->RangeMultiplier(4)->Range(64, CAP);
+BENCHMARK(benchmark_find_and_read<FixedIndexBasedPoolStorage>)
+    ->RangeMultiplier(4)
+    ->Range(64, CAP);
+BENCHMARK(benchmark_find_and_read<FixedIndexBasedSplitPoolStorage>)
+    ->RangeMultiplier(4)
+    ->Range(64, CAP);
+BENCHMARK(benchmark_erase_and_insert<FixedIndexBasedPoolStorage>)
+    ->RangeMultiplier(4)
+    ->Range(64, CAP);
+BENCHMARK(benchmark_erase_and_insert<FixedIndexBasedSplitPoolStorage>)
+    ->RangeMultiplier(4)
+    ->Range(64, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,118 @@
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 1024;
+constexpr std::size_t OPERATIONS_PER_ITERATION = 1024;
+
+// Fixed-capacity deques behind a mutex: the no-allocation baselines. FixedDeque keeps its
+// elements contiguous, so popping the front shifts the rest; FixedCircularDeque is a ring buffer.
+template <class Deque>
+class MutexQueue
+{
+    std::mutex mutex_;
+    Deque deque_;
+
+public:
+    bool try_push(const std::uint64_t v)
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (deque_.size() == deque_.max_size())
+        {
+            return false;
+        }
+        deque_.push_back(v);
+        return true;
+    }
+
+    std::optional<std::uint64_t> try_pop()
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (deque_.empty())
+        {
+            return std::nullopt;
+        }
+        const std::uint64_t out = deque_.front();
+        if constexpr (requires { deque_.pop_front(); })
+        {
+            deque_.pop_front();
+        }
+        else
+        {
+            deque_.erase(deque_.begin());
+        }
+        return out;
+    }
+};
+
+constinit FixedMpmcQueue<std::uint64_t, CAP> LOCK_FREE_QUEUE{};
+MutexQueue<FixedDeque<std::uint64_t, CAP>> MUTEX_DEQUE{};
+MutexQueue<FixedCircularDeque<std::uint64_t, CAP>> MUTEX_CIRCULAR_DEQUE{};
+
+// Half of the benchmark threads are producers and the other half consumers, so the runs go from
+// 1 producer and 1 consumer to N of each. Every thread runs the same number of iterations, so
+// the consumers pop exactly what the producers push. Throughput is reported as elements passed
+// from a producer to a consumer per second.
+//
+// Scaling is only measured when every thread has a core of its own. With more threads than
+// cores, threads are time-sliced and mostly run alone between preemptions, so the rates say
+// nothing about contention. These runs have not been measured on a multi-core machine yet.
+template <auto& QUEUE>
+void benchmark_producers_and_consumers(benchmark::State& state)
+{
+    const bool is_producer = state.thread_index() % 2 == 0;
+    std::uint64_t sum = 0;
+    for (auto _ : state)
+    {
+        for (std::uint64_t i = 0; i < OPERATIONS_PER_ITERATION; i++)
+        {
+            if (is_producer)
+            {
+                while (!QUEUE.try_push(i))
+                {
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+
+            std::optional<std::uint64_t> v = QUEUE.try_pop();
+            while (!v.has_value())
+            {
+                std::this_thread::yield();
+                v = QUEUE.try_pop();
+            }
+            sum += *v;
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+    if (!is_producer)
+    {
+        state.SetItemsProcessed(
+            static_cast<std::int64_t>(state.iterations() * OPERATIONS_PER_ITERATION));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_producers_and_consumers<LOCK_FREE_QUEUE>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(benchmark_producers_and_consumers<MUTEX_DEQUE>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(benchmark_producers_and_consumers<MUTEX_CIRCULAR_DEQUE>)
+    ->ThreadRange(2, 16)
+    ->UseRealTime();
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,168 @@
+#include "fixed_containers/fixed_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <random>
+
+namespace fixed_containers
+{
+namespace
+{
+// Results are returned by value, so the capacity is sized to the inputs as it would be in practice
+template <std::size_t SIZE>
+using SetType = FixedSet<std::int32_t, 2 * SIZE>;
+
+// Sets of SIZE keys each, drawn from a range twice as large, so that about half of the keys of two
+// such sets are shared
+template <std::size_t SIZE>
+std::unique_ptr<SetType<SIZE>> make_random_set(const unsigned seed)
+{
+    auto set = std::make_unique<SetType<SIZE>>();
+    std::mt19937 random_engine{seed};
+    std::uniform_int_distribution<std::int32_t> distribution{
+        0, static_cast<std::int32_t>(2 * SIZE - 1)};
+    while (set->size() < SIZE)
+    {
+        set->insert(distribution(random_engine));
+    }
+    return set;
+}
+
+template <std::size_t SIZE>
+void benchmark_intersection_by_insertion(benchmark::State& state)
+{
+    const auto a = make_random_set<SIZE>(1);
+    const auto b = make_random_set<SIZE>(2);
+    auto out = std::make_unique<SetType<SIZE>>();
+
+    for (auto _ : state)
+    {
+        out->clear();
+        std::set_intersection(
+            a->begin(), a->end(), b->begin(), b->end(), std::inserter(*out, out->end()));
+        benchmark::DoNotOptimize(out->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 2 * SIZE));
+}
+
+template <std::size_t SIZE>
+void benchmark_intersection(benchmark::State& state)
+{
+    const auto a = make_random_set<SIZE>(1);
+    const auto b = make_random_set<SIZE>(2);
+    auto out = std::make_unique<SetType<SIZE>>();
+
+    for (auto _ : state)
+    {
+        *out = set_intersection(*a, *b);
+        benchmark::DoNotOptimize(out->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 2 * SIZE));
+}
+
+template <std::size_t SIZE>
+void benchmark_union_by_insertion(benchmark::State& state)
+{
+    const auto a = make_random_set<SIZE>(1);
+    const auto b = make_random_set<SIZE>(2);
+    auto out = std::make_unique<SetType<SIZE>>();
+
+    for (auto _ : state)
+    {
+        *out = *a;
+        out->insert(b->begin(), b->end());
+        benchmark::DoNotOptimize(out->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 2 * SIZE));
+}
+
+template <std::size_t SIZE>
+void benchmark_union(benchmark::State& state)
+{
+    const auto a = make_random_set<SIZE>(1);
+    const auto b = make_random_set<SIZE>(2);
+    auto out = std::make_unique<SetType<SIZE>>();
+
+    for (auto _ : state)
+    {
+        *out = set_union(*a, *b);
+        benchmark::DoNotOptimize(out->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 2 * SIZE));
+}
+
+template <std::size_t SIZE>
+void benchmark_merge_by_insertion(benchmark::State& state)
+{
+    const auto a = make_random_set<SIZE>(1);
+    const auto b = make_random_set<SIZE>(2);
+    auto out = std::make_unique<SetType<SIZE>>();
+    auto source = std::make_unique<SetType<SIZE>>();
+
+    for (auto _ : state)
+    {
+        *out = *a;
+        *source = *b;
+        for (auto it = source->begin(); it != source->end();)
+        {
+            it = out->insert(*it).second ? source->erase(it) : std::next(it);
+        }
+        benchmark::DoNotOptimize(out->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 2 * SIZE));
+}
+
+template <std::size_t SIZE>
+void benchmark_merge(benchmark::State& state)
+{
+    const auto a = make_random_set<SIZE>(1);
+    const auto b = make_random_set<SIZE>(2);
+    auto out = std::make_unique<SetType<SIZE>>();
+    auto source = std::make_unique<SetType<SIZE>>();
+
+    for (auto _ : state)
+    {
+        *out = *a;
+        *source = *b;
+        out->merge(*source);
+        benchmark::DoNotOptimize(out->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 2 * SIZE));
+}
+
+}  // namespace
+
+// Small sets are the common case (e.g. access-control lists intersected per request)
+BENCHMARK(benchmark_intersection_by_insertion<8>);
+BENCHMARK(benchmark_intersection_by_insertion<64>);
+BENCHMARK(benchmark_intersection_by_insertion<512>);
+BENCHMARK(benchmark_intersection_by_insertion<4096>);
+BENCHMARK(benchmark_intersection<8>);
+BENCHMARK(benchmark_intersection<64>);
+BENCHMARK(benchmark_intersection<512>);
+BENCHMARK(benchmark_intersection<4096>);
+BENCHMARK(benchmark_union_by_insertion<8>);
+BENCHMARK(benchmark_union_by_insertion<64>);
+BENCHMARK(benchmark_union_by_insertion<512>);
+BENCHMARK(benchmark_union_by_insertion<4096>);
+BENCHMARK(benchmark_union<8>);
+BENCHMARK(benchmark_union<64>);
+BENCHMARK(benchmark_union<512>);
+BENCHMARK(benchmark_union<4096>);
+BENCHMARK(benchmark_merge_by_insertion<8>);
+BENCHMARK(benchmark_merge_by_insertion<64>);
+BENCHMARK(benchmark_merge_by_insertion<512>);
+BENCHMARK(benchmark_merge_by_insertion<4096>);
+BENCHMARK(benchmark_merge<8>);
+BENCHMARK(benchmark_merge<64>);
+BENCHMARK(benchmark_merge<512>);
+BENCHMARK(benchmark_merge<4096>);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,244 @@
+#include "fixed_containers/fixed_spsc_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 1024;
+constexpr std::size_t ITEMS_PER_ITERATION = std::size_t{1} << 20;
+constexpr std::size_t ROUND_TRIPS_PER_ITERATION = std::size_t{1} << 14;
+
+constexpr int CONSUMER_CPU = 0;
+constexpr int PRODUCER_CPU = 1;
+
+// The numbers are only meaningful with one core per thread. With fewer cores the threads share
+// one, so waiting must yield instead of spinning for a whole time slice.
+bool has_core_per_thread() { return std::thread::hardware_concurrency() >= 2; }
+
+void pin_current_thread_to(const int cpu)
+{
+#if defined(__linux__)
+    if (!has_core_per_thread())
+    {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+void wait_a_little()
+{
+    if (!has_core_per_thread())
+    {
+        std::this_thread::yield();
+    }
+}
+
+// std::deque behind a mutex: the usual starting point for passing messages between threads
+class MutexQueue
+{
+    std::mutex mutex_;
+    std::deque<std::uint64_t> deque_;
+
+public:
+    bool try_push(const std::uint64_t v)
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (deque_.size() >= CAP)
+        {
+            return false;
+        }
+        deque_.push_back(v);
+        return true;
+    }
+
+    std::optional<std::uint64_t> try_pop()
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (deque_.empty())
+        {
+            return std::nullopt;
+        }
+        const std::uint64_t out = deque_.front();
+        deque_.pop_front();
+        return out;
+    }
+};
+
+// One element per push/pop: every element pays for an atomic store on each side
+template <class QueueType>
+void benchmark_throughput(benchmark::State& state)
+{
+    pin_current_thread_to(CONSUMER_CPU);
+    QueueType q{};
+    std::uint64_t sum = 0;
+
+    for (auto _ : state)
+    {
+        std::thread producer(
+            [&q]()
+            {
+                pin_current_thread_to(PRODUCER_CPU);
+                for (std::uint64_t i = 0; i < ITEMS_PER_ITERATION; i++)
+                {
+                    while (!q.try_push(i))
+                    {
+                        wait_a_little();
+                    }
+                }
+            });
+
+        for (std::size_t received = 0; received < ITEMS_PER_ITERATION;)
+        {
+            if (const auto v = q.try_pop(); v.has_value())
+            {
+                sum += *v;
+                received++;
+            }
+            else
+            {
+                wait_a_little();
+            }
+        }
+        producer.join();
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ITEMS_PER_ITERATION));
+}
+
+// try_push_n/try_pop_n: one atomic store per batch instead of per element
+void benchmark_batched_throughput(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    pin_current_thread_to(CONSUMER_CPU);
+    FixedSpscQueue<std::uint64_t, CAP> q{};
+    std::uint64_t sum = 0;
+
+    for (auto _ : state)
+    {
+        std::thread producer(
+            [&q, batch_size]()
+            {
+                pin_current_thread_to(PRODUCER_CPU);
+                std::array<std::uint64_t, CAP> batch{};
+                for (std::size_t sent = 0; sent < ITEMS_PER_ITERATION;)
+                {
+                    const std::size_t n = (std::min)(batch_size, ITEMS_PER_ITERATION - sent);
+                    for (std::size_t i = 0; i < n; i++)
+                    {
+                        batch[i] = sent + i;
+                    }
+                    const std::size_t pushed = q.try_push_n(batch.begin(), n);
+                    if (pushed == 0)
+                    {
+                        wait_a_little();
+                    }
+                    sent += pushed;
+                }
+            });
+
+        std::array<std::uint64_t, CAP> batch{};
+        for (std::size_t received = 0; received < ITEMS_PER_ITERATION;)
+        {
+            const std::size_t n = q.try_pop_n(batch.begin(), batch_size);
+            if (n == 0)
+            {
+                wait_a_little();
+            }
+            for (std::size_t i = 0; i < n; i++)
+            {
+                sum += batch[i];
+            }
+            received += n;
+        }
+        producer.join();
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ITEMS_PER_ITERATION));
+}
+
+// Ping-pong between two queues. Reports the mean round-trip time, i.e. twice the one-way latency.
+template <class QueueType>
+void benchmark_round_trip_latency(benchmark::State& state)
+{
+    pin_current_thread_to(CONSUMER_CPU);
+    QueueType ping{};
+    QueueType pong{};
+
+    for (auto _ : state)
+    {
+        std::thread echo(
+            [&ping, &pong]()
+            {
+                pin_current_thread_to(PRODUCER_CPU);
+                for (std::size_t i = 0; i < ROUND_TRIPS_PER_ITERATION; i++)
+                {
+                    std::optional<std::uint64_t> v = ping.try_pop();
+                    while (!v.has_value())
+                    {
+                        wait_a_little();
+                        v = ping.try_pop();
+                    }
+                    while (!pong.try_push(*v))
+                    {
+                        wait_a_little();
+                    }
+                }
+            });
+
+        for (std::uint64_t i = 0; i < ROUND_TRIPS_PER_ITERATION; i++)
+        {
+            while (!ping.try_push(i))
+            {
+                wait_a_little();
+            }
+            std::optional<std::uint64_t> v = pong.try_pop();
+            while (!v.has_value())
+            {
+                wait_a_little();
+                v = pong.try_pop();
+            }
+            benchmark::DoNotOptimize(v);
+        }
+        echo.join();
+    }
+
+    state.counters["round_trip"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * ROUND_TRIPS_PER_ITERATION),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_throughput<FixedSpscQueue<std::uint64_t, CAP>>)->UseRealTime();
+BENCHMARK(benchmark_throughput<MutexQueue>)->UseRealTime();
+BENCHMARK(benchmark_batched_throughput)->Arg(8)->Arg(64)->Arg(256)->UseRealTime();
+BENCHMARK(benchmark_round_trip_latency<FixedSpscQueue<std::uint64_t, CAP>>)->UseRealTime();
+BENCHMARK(benchmark_round_trip_latency<MutexQueue>)->UseRealTime();
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
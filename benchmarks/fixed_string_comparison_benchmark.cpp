@@ -0,0 +1,108 @@
+#include "fixed_containers/fixed_string.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using fixed_string_detail::FixedString;
+
+constexpr std::size_t CAP = 256;
+
+// Strings of the requested length that only differ in their last character, so comparisons
+// have to look at all of them
+std::vector<std::string> make_strings(const benchmark::State& state)
+{
+    const auto length = static_cast<std::size_t>(state.range(0));
+    std::vector<std::string> out{};
+    for (char last = 'a'; last <= 'p'; last++)
+    {
+        out.emplace_back(length - 1, 'x').push_back(last);
+    }
+    return out;
+}
+
+template <class StringType>
+void benchmark_construct_from_string_view(benchmark::State& state)
+{
+    const std::vector<std::string> sources = make_strings(state);
+
+    for (auto _ : state)
+    {
+        for (const std::string& source : sources)
+        {
+            StringType s{std::string_view{source}};
+            benchmark::DoNotOptimize(s);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * sources.size()));
+}
+
+template <class StringType>
+void benchmark_copy(benchmark::State& state)
+{
+    std::vector<StringType> sources{};
+    for (const std::string& source : make_strings(state))
+    {
+        sources.emplace_back(std::string_view{source});
+    }
+
+    for (auto _ : state)
+    {
+        for (const StringType& source : sources)
+        {
+            StringType s{source};
+            benchmark::DoNotOptimize(s);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * sources.size()));
+}
+
+template <class StringType>
+void benchmark_compare(benchmark::State& state)
+{
+    std::vector<StringType> sources{};
+    for (const std::string& source : make_strings(state))
+    {
+        sources.emplace_back(std::string_view{source});
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 1; i < sources.size(); i++)
+        {
+            benchmark::DoNotOptimize(std::string_view{sources[i - 1]} ==
+                                     std::string_view{sources[i]});
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * sources.size()));
+}
+
+}  // namespace
+
+// Short enough for the small string optimization of std::string, and longer
+BENCHMARK(benchmark_construct_from_string_view<FixedString<CAP>>)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(CAP)
+    ->ArgName("length");
+BENCHMARK(benchmark_construct_from_string_view<std::string>)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(CAP)
+    ->ArgName("length");
+BENCHMARK(benchmark_copy<FixedString<CAP>>)->Arg(8)->Arg(64)->Arg(CAP)->ArgName("length");
+BENCHMARK(benchmark_copy<std::string>)->Arg(8)->Arg(64)->Arg(CAP)->ArgName("length");
+BENCHMARK(benchmark_compare<FixedString<CAP>>)->Arg(8)->Arg(64)->Arg(CAP)->ArgName("length");
+BENCHMARK(benchmark_compare<std::string>)->Arg(8)->Arg(64)->Arg(CAP)->ArgName("length");
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
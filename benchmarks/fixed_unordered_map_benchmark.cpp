@@ -0,0 +1,138 @@
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// Same capacity and value type as fixed_map_perf_test.cpp
+using LargeValue = std::array<std::array<int, 3>, 30>;
+constexpr std::size_t CAP = 130;
+
+std::vector<int> random_unique_keys(const std::size_t count, const unsigned seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int> distribution{0, 1'000'000};
+    std::vector<int> out{};
+    FixedUnorderedMap<int, int, CAP * 2> seen{};
+    while (out.size() < count)
+    {
+        const int key = distribution(generator);
+        if (seen.try_emplace(key, 0).second)
+        {
+            out.push_back(key);
+        }
+    }
+    return out;
+}
+
+template <class MapType>
+void benchmark_lookup_hit(benchmark::State& state)
+{
+    const std::vector<int> keys = random_unique_keys(CAP, 1);
+    MapType map{};
+    for (const int key : keys)
+    {
+        map.try_emplace(key);
+    }
+
+    for (auto _ : state)
+    {
+        for (const int key : keys)
+        {
+            benchmark::DoNotOptimize(map.find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <class MapType>
+void benchmark_lookup_miss(benchmark::State& state)
+{
+    const std::vector<int> keys = random_unique_keys(CAP * 2, 2);
+    MapType map{};
+    for (std::size_t i = 0; i < CAP; i++)
+    {
+        map.try_emplace(keys[i]);
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = CAP; i < keys.size(); i++)
+        {
+            benchmark::DoNotOptimize(map.contains(keys[i]));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAP));
+}
+
+template <class MapType>
+void benchmark_fill_and_clear(benchmark::State& state)
+{
+    const std::vector<int> keys = random_unique_keys(CAP, 3);
+    MapType map{};
+
+    for (auto _ : state)
+    {
+        for (const int key : keys)
+        {
+            map.try_emplace(key);
+        }
+        benchmark::DoNotOptimize(map);
+        map.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+template <class MapType>
+void benchmark_iterate(benchmark::State& state)
+{
+    const std::vector<int> keys = random_unique_keys(CAP, 4);
+    MapType map{};
+    for (const int key : keys)
+    {
+        map.try_emplace(key);
+    }
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto& [key, value] : map)
+        {
+            sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_lookup_hit<FixedMap<int, int, CAP>>);
+BENCHMARK(benchmark_lookup_hit<FixedUnorderedMap<int, int, CAP>>);
+BENCHMARK(benchmark_lookup_hit<FixedMap<int, LargeValue, CAP>>);
+BENCHMARK(benchmark_lookup_hit<FixedUnorderedMap<int, LargeValue, CAP>>);
+
+BENCHMARK(benchmark_lookup_miss<FixedMap<int, int, CAP>>);
+BENCHMARK(benchmark_lookup_miss<FixedUnorderedMap<int, int, CAP>>);
+BENCHMARK(benchmark_lookup_miss<FixedMap<int, LargeValue, CAP>>);
+BENCHMARK(benchmark_lookup_miss<FixedUnorderedMap<int, LargeValue, CAP>>);
+
+BENCHMARK(benchmark_fill_and_clear<FixedMap<int, int, CAP>>);
+BENCHMARK(benchmark_fill_and_clear<FixedUnorderedMap<int, int, CAP>>);
+BENCHMARK(benchmark_fill_and_clear<FixedMap<int, LargeValue, CAP>>);
+BENCHMARK(benchmark_fill_and_clear<FixedUnorderedMap<int, LargeValue, CAP>>);
+
+BENCHMARK(benchmark_iterate<FixedMap<int, LargeValue, CAP>>);
+BENCHMARK(benchmark_iterate<FixedUnorderedMap<int, LargeValue, CAP>>);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 4096;
+
+// Same layout as int, but with user-provided copy/move so that the containers have to shift
+// elements one at a time. Serves as the baseline for the block-move path.
+struct ElementWiseInt
+{
+    int value;
+
+    ElementWiseInt(int v)  // NOLINT(google-explicit-constructor)
+      : value{v}
+    {
+    }
+    ElementWiseInt(const ElementWiseInt& other)
+      : value{other.value}
+    {
+    }
+    ElementWiseInt(ElementWiseInt&& other) noexcept
+      : value{other.value}
+    {
+    }
+    ElementWiseInt& operator=(const ElementWiseInt& other) = default;
+    ElementWiseInt& operator=(ElementWiseInt&& other) noexcept = default;
+    ~ElementWiseInt() = default;
+};
+static_assert(NotTriviallyCopyable<ElementWiseInt>);
+
+// Erases from the middle until empty, then refills through middle insertions
+template <class VectorType>
+void benchmark_erase_and_insert_in_the_middle(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    VectorType v{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        v.push_back(static_cast<int>(i));
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            v.erase(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2));
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            // FixedDeque has no single-value insert()
+            const auto middle = static_cast<std::ptrdiff_t>(v.size() / 2);
+            v.insert(v.begin() + middle, {static_cast<int>(i)});
+        }
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count * 2));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_erase_and_insert_in_the_middle<FixedVector<int, CAP>>)->Arg(1024)->Arg(4096);
+BENCHMARK(benchmark_erase_and_insert_in_the_middle<FixedVector<ElementWiseInt, CAP>>)
+    ->Arg(1024)
+    ->Arg(4096);
+BENCHMARK(benchmark_erase_and_insert_in_the_middle<FixedDeque<int, CAP>>)->Arg(1024)->Arg(4096);
+BENCHMARK(benchmark_erase_and_insert_in_the_middle<FixedDeque<ElementWiseInt, CAP>>)
+    ->Arg(1024)
+    ->Arg(4096);
+BENCHMARK(benchmark_erase_and_insert_in_the_middle<std::vector<int>>)->Arg(1024)->Arg(4096);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
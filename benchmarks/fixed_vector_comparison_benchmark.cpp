@@ -0,0 +1,184 @@
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 16384;
+
+// One cache line per element
+using LargeElement = std::array<std::int64_t, 8>;
+
+template <class T>
+T make_element(const std::size_t i)
+{
+    if constexpr (std::is_same_v<T, LargeElement>)
+    {
+        return LargeElement{static_cast<std::int64_t>(i)};
+    }
+    else
+    {
+        return static_cast<T>(i);
+    }
+}
+
+template <class T>
+std::int64_t first_field(const T& element)
+{
+    if constexpr (std::is_same_v<T, LargeElement>)
+    {
+        return element[0];
+    }
+    else
+    {
+        return static_cast<std::int64_t>(element);
+    }
+}
+
+// The large fixed containers do not fit on the stack
+template <class Container>
+std::unique_ptr<Container> make_filled(const std::size_t count)
+{
+    auto container = std::make_unique<Container>();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        container->push_back(make_element<typename Container::value_type>(i));
+    }
+    return container;
+}
+
+// A fresh container per iteration, so the std containers pay for their allocations
+template <class Container>
+void benchmark_push_back(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto buffer = std::make_unique<Container>();
+
+    for (auto _ : state)
+    {
+        std::destroy_at(buffer.get());
+        Container* container = std::construct_at(buffer.get());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            container->push_back(make_element<typename Container::value_type>(i));
+        }
+        benchmark::DoNotOptimize(container->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <class Container>
+void benchmark_iterate(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto container = make_filled<Container>(count);
+
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const auto& element : *container)
+        {
+            sum += first_field(element);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <class Container>
+void benchmark_random_access(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto container = make_filled<Container>(count);
+    std::vector<std::size_t> indices(count);
+    std::mt19937 random_engine{1};
+    std::uniform_int_distribution<std::size_t> distribution{0, count - 1};
+    for (std::size_t& index : indices)
+    {
+        index = distribution(random_engine);
+    }
+
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const std::size_t index : indices)
+        {
+            sum += first_field((*container)[index]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+// Queue usage: the deques keep a constant size while their contents rotate
+template <class Container>
+void benchmark_push_back_and_pop_front(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto container = make_filled<Container>(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            container->pop_front();
+            container->push_back(make_element<typename Container::value_type>(i));
+        }
+        benchmark::DoNotOptimize(container->size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <class Container>
+void register_benchmarks(const std::string& name)
+{
+    const auto configure = [](benchmark::internal::Benchmark* benchmark)
+    { benchmark->RangeMultiplier(16)->Range(16, CAP)->ArgName("size"); };
+    configure(benchmark::RegisterBenchmark(("push_back/" + name).c_str(),
+                                           benchmark_push_back<Container>));
+    configure(
+        benchmark::RegisterBenchmark(("iterate/" + name).c_str(), benchmark_iterate<Container>));
+    configure(benchmark::RegisterBenchmark(("random_access/" + name).c_str(),
+                                           benchmark_random_access<Container>));
+    if constexpr (requires(Container& c) { c.pop_front(); })
+    {
+        configure(benchmark::RegisterBenchmark(("push_back_and_pop_front/" + name).c_str(),
+                                               benchmark_push_back_and_pop_front<Container>));
+    }
+}
+
+template <class T>
+void register_benchmarks_for_element(const std::string& element_name)
+{
+    register_benchmarks<FixedVector<T, CAP>>("FixedVector/" + element_name);
+    register_benchmarks<std::vector<T>>("std::vector/" + element_name);
+    register_benchmarks<FixedDeque<T, CAP>>("FixedDeque/" + element_name);
+    register_benchmarks<std::deque<T>>("std::deque/" + element_name);
+}
+
+}  // namespace
+}  // namespace fixed_containers
+
+int main(int argc, char** argv)
+{
+    fixed_containers::register_benchmarks_for_element<std::int32_t>("int32");
+    fixed_containers::register_benchmarks_for_element<fixed_containers::LargeElement>("64B");
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include "fixed_containers/fixed_flat_map.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/frozen_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 16384;
+
+using TreeMap = FixedMap<std::int64_t, std::int64_t, CAP>;
+using FlatMap = FixedFlatMap<std::int64_t, std::int64_t, CAP>;
+using FrozenMapType = FrozenMap<std::int64_t, std::int64_t, CAP>;
+
+// Even keys in random order, so that odd keys can be used for misses
+std::vector<std::int64_t> shuffled_even_keys(const std::size_t count, const unsigned seed)
+{
+    std::vector<std::int64_t> out(count);
+    std::iota(out.begin(), out.end(), 0);
+    for (std::int64_t& key : out)
+    {
+        key *= 2;
+    }
+    std::shuffle(out.begin(), out.end(), std::mt19937{seed});
+    return out;
+}
+
+// The maps are built at runtime, from the same entries a `freeze()` would see. The large ones do
+// not fit on the stack.
+template <class MapType>
+std::unique_ptr<MapType> make_map(const std::vector<std::int64_t>& keys)
+{
+    auto tree = std::make_unique<TreeMap>();
+    for (const std::int64_t key : keys)
+    {
+        tree->try_emplace(key, key);
+    }
+    if constexpr (std::is_same_v<MapType, TreeMap>)
+    {
+        return tree;
+    }
+    else
+    {
+        auto out = std::make_unique<MapType>();
+        *out = MapType::from_sorted_unique(tree->cbegin(), tree->cend());
+        return out;
+    }
+}
+
+template <class MapType>
+void benchmark_find(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 1);
+    const auto map = make_map<MapType>(keys);
+
+    for (auto _ : state)
+    {
+        for (const std::int64_t key : keys)
+        {
+            benchmark::DoNotOptimize(map->find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+// Half of the lookups miss
+template <class MapType>
+void benchmark_contains(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> keys = shuffled_even_keys(size, 2);
+    const auto map = make_map<MapType>(keys);
+    std::vector<std::int64_t> lookups = keys;
+    for (const std::int64_t key : keys)
+    {
+        lookups.push_back(key + 1);
+    }
+    std::shuffle(lookups.begin(), lookups.end(), std::mt19937{3});
+
+    for (auto _ : state)
+    {
+        for (const std::int64_t key : lookups)
+        {
+            benchmark::DoNotOptimize(map->contains(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * lookups.size()));
+}
+
+template <class MapType>
+void benchmark_iteration(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto map = make_map<MapType>(shuffled_even_keys(size, 4));
+
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (auto&& [key, value] : *map)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_find<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_find<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_find<FrozenMapType>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_contains<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_contains<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_contains<FrozenMapType>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_iteration<TreeMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_iteration<FlatMap>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_iteration<FrozenMapType>)->RangeMultiplier(4)->Range(16, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
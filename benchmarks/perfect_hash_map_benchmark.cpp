@@ -0,0 +1,104 @@
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/perfect_hash_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 4096;
+
+template <class K>
+using PerfectHashMapType = PerfectHashMap<K, std::int64_t, CAP>;
+template <class K>
+using FixedUnorderedMapType = FixedUnorderedMap<K, std::int64_t, CAP>;
+
+// Sparse integer keys, like opcodes or error codes
+std::vector<std::int64_t> make_keys(const std::size_t count, std::int64_t /*tag*/)
+{
+    std::vector<std::int64_t> out{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        out.push_back(static_cast<std::int64_t>(i * 7919));
+    }
+    return out;
+}
+
+// Config-key-like strings. The std::strings own the characters the string_views point to.
+std::vector<std::string_view> make_keys(const std::size_t count, std::string_view /*tag*/)
+{
+    static std::vector<std::string> storage{};
+    storage.clear();
+    storage.reserve(count);
+    std::vector<std::string_view> out{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        out.emplace_back(storage.emplace_back("config.section_" + std::to_string(i) + ".value"));
+    }
+    return out;
+}
+
+template <class MapType>
+std::unique_ptr<MapType> make_map(const std::vector<typename MapType::key_type>& keys)
+{
+    std::vector<std::pair<typename MapType::key_type, std::int64_t>> entries{};
+    for (const auto& key : keys)
+    {
+        entries.emplace_back(key, static_cast<std::int64_t>(entries.size()));
+    }
+    return std::make_unique<MapType>(entries.begin(), entries.end());
+}
+
+// Lookups of present keys in random order
+template <class MapType>
+void benchmark_find(benchmark::State& state)
+{
+    using K = typename MapType::key_type;
+    std::vector<K> keys = make_keys(static_cast<std::size_t>(state.range(0)), K{});
+    const auto map = make_map<MapType>(keys);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937{1});
+
+    for (auto _ : state)
+    {
+        for (const K& key : keys)
+        {
+            benchmark::DoNotOptimize(map->find(key));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * keys.size()));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_find<PerfectHashMapType<std::int64_t>>)->RangeMultiplier(4)->Range(16, CAP);
+BENCHMARK(benchmark_find<FixedUnorderedMapType<std::int64_t>>)
+    ->RangeMultiplier(4)
+    ->Range(16, CAP);
+BENCHMARK(benchmark_find<std::unordered_map<std::int64_t, std::int64_t>>)
+    ->RangeMultiplier(4)
+    ->Range(16, CAP);
+BENCHMARK(benchmark_find<PerfectHashMapType<std::string_view>>)
+    ->RangeMultiplier(4)
+    ->Range(16, CAP);
+BENCHMARK(benchmark_find<FixedUnorderedMapType<std::string_view>>)
+    ->RangeMultiplier(4)
+    ->Range(16, CAP);
+BENCHMARK(benchmark_find<std::unordered_map<std::string_view, std::int64_t>>)
+    ->RangeMultiplier(4)
+    ->Range(16, CAP);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
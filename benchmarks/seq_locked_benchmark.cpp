@@ -0,0 +1,145 @@
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/seq_locked.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+
+namespace fixed_containers
+{
+namespace
+{
+// A routing table: updated now and then by a control thread, read constantly by data-plane threads
+constexpr std::size_t CAP = 64;
+constexpr std::uint32_t KEY_COUNT = 48;
+constexpr std::size_t LOOKUPS_PER_ITERATION = 256;
+using RoutingTable = FixedMap<std::uint32_t, std::uint32_t, CAP>;
+
+RoutingTable make_table(const std::uint32_t generation)
+{
+    RoutingTable table{};
+    for (std::uint32_t key = 0; key < KEY_COUNT; key++)
+    {
+        table[key * 3] = key + generation;
+    }
+    return table;
+}
+
+class SharedMutexTable
+{
+    mutable std::shared_mutex mutex_;
+    RoutingTable table_ = make_table(0);
+
+public:
+    std::optional<std::uint32_t> lookup(const std::uint32_t key) const
+    {
+        const std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto it = table_.find(key);
+        return it == table_.end() ? std::nullopt : std::optional{it->second};
+    }
+
+    void update(const std::uint32_t generation)
+    {
+        const std::unique_lock<std::shared_mutex> lock(mutex_);
+        table_ = make_table(generation);
+    }
+};
+
+class SeqLockedTable
+{
+    SeqLocked<RoutingTable> table_{make_table(0)};
+
+public:
+    std::optional<std::uint32_t> lookup(const std::uint32_t key) const
+    {
+        return table_.read(
+            [key](const RoutingTable& table)
+            {
+                const auto it = table.find(key);
+                return it == table.end() ? std::nullopt : std::optional{it->second};
+            });
+    }
+
+    void update(const std::uint32_t generation) { table_.store(make_table(generation)); }
+};
+
+SharedMutexTable SHARED_MUTEX_TABLE{};
+SeqLockedTable SEQ_LOCKED_TABLE{};
+
+// Updates the table every WRITER_PERIOD until stopped
+template <auto& TABLE>
+class BackgroundWriter
+{
+    static constexpr auto WRITER_PERIOD = std::chrono::microseconds{100};
+
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+
+public:
+    BackgroundWriter()
+      : thread_{[this]()
+                {
+                    for (std::uint32_t generation = 1; !stop_.load(std::memory_order_relaxed);
+                         generation++)
+                    {
+                        TABLE.update(generation);
+                        std::this_thread::sleep_for(WRITER_PERIOD);
+                    }
+                }}
+    {
+    }
+
+    BackgroundWriter(const BackgroundWriter&) = delete;
+    BackgroundWriter& operator=(const BackgroundWriter&) = delete;
+
+    ~BackgroundWriter()
+    {
+        stop_.store(true, std::memory_order_relaxed);
+        thread_.join();
+    }
+};
+
+// Every benchmark thread is a reader. With WITH_WRITER, the first thread also runs a writer in the
+// background for the duration of the benchmark. Throughput is reported as lookups per second
+// across all reader threads.
+template <auto& TABLE, bool WITH_WRITER>
+void benchmark_lookups(benchmark::State& state)
+{
+    std::optional<BackgroundWriter<TABLE>> writer{};
+    if (WITH_WRITER && state.thread_index() == 0)
+    {
+        writer.emplace();
+    }
+
+    std::uint64_t sum = 0;
+    std::uint32_t key = static_cast<std::uint32_t>(state.thread_index());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < LOOKUPS_PER_ITERATION; i++)
+        {
+            key = (key + 7) % (KEY_COUNT * 3);
+            sum += TABLE.lookup(key).value_or(0);
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * LOOKUPS_PER_ITERATION));
+}
+
+}  // namespace
+
+BENCHMARK(benchmark_lookups<SEQ_LOCKED_TABLE, false>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(benchmark_lookups<SHARED_MUTEX_TABLE, false>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(benchmark_lookups<SEQ_LOCKED_TABLE, true>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(benchmark_lookups<SHARED_MUTEX_TABLE, true>)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -141,6 +141,14 @@ public:
         return out;
     }
 
+    // Lets the owning container recover the position of an iterator (e.g. for insertion hints)
+    // without a lookup. Not part of the public API.
+    constexpr const ReferenceProvider& IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider()
+        const noexcept
+    {
+        return reference_provider_;
+    }
+
 private:
     constexpr void advance() noexcept
     {
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace fixed_containers::cache_line_detail
+{
+// Alignment that keeps data written by different threads on different cache lines.
+// std::hardware_destructive_interference_size is not usable in headers without ABI warnings,
+// and 64 bytes is the line size of every target we care about.
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+// Hints that the cache line holding `address` is about to be read. No-op in constant evaluation
+// and on compilers without a prefetch intrinsic.
+constexpr void prefetch_for_read(const void* address) noexcept
+{
+    if (std::is_constant_evaluated())
+    {
+        return;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    static_cast<void>(address);
+#endif
+}
+}  // namespace fixed_containers::cache_line_detail
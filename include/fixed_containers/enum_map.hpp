@@ -10,7 +10,9 @@
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/source_location.hpp"
 #include "fixed_containers/type_name.hpp"
+#include "fixed_containers/word_bitset.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
@@ -134,6 +136,7 @@ protected:  // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of E
     using KeyArrayType = std::array<K, ENUM_COUNT>;
     using OptionalV = optional_storage_detail::OptionalStorage<V>;
     using ValueArrayType = std::array<OptionalV, ENUM_COUNT>;
+    using ArraySetType = word_bitset_detail::WordBitset<ENUM_COUNT>;
     static constexpr const KeyArrayType& ENUM_VALUES = EnumAdapterType::values();
 
 private:
@@ -188,8 +191,16 @@ private:
 
     struct IndexPredicate
     {
-        const std::array<bool, ENUM_COUNT>* array_set_;
-        constexpr bool operator()(const std::size_t i) const { return (*array_set_)[i]; }
+        const ArraySetType* array_set_;
+        constexpr bool operator()(const std::size_t i) const { return array_set_->test(i); }
+        constexpr std::size_t next_index(const std::size_t i, const std::size_t end) const
+        {
+            return (std::min)(array_set_->find_first_at_or_after(i), end);
+        }
+        constexpr std::size_t previous_index(const std::size_t i) const
+        {
+            return array_set_->find_last_at_or_before(i);
+        }
     };
 
     template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
@@ -302,14 +313,12 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     ValueArrayType IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
-    std::array<bool, ENUM_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
-    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    ArraySetType IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
 
 public:
     constexpr EnumMapBase() noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_{}
-      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
     {
     }
 
@@ -332,7 +341,7 @@ public:
                                       std_transition::source_location::current()) noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
-        if (preconditions::test(array_set_unchecked_at(ordinal)))
+        if (preconditions::test(contains_at(ordinal)))
         {
             CheckingType::out_of_range(key, size(), loc);
         }
@@ -344,7 +353,7 @@ public:
             std_transition::source_location::current()) const noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
-        if (preconditions::test(array_set_unchecked_at(ordinal)))
+        if (preconditions::test(contains_at(ordinal)))
         {
             CheckingType::out_of_range(key, size(), loc);
         }
@@ -385,45 +394,41 @@ public:
 
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
 
-    [[nodiscard]] constexpr std::size_t size() const noexcept
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
-    }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return array_set().count(); }
 
     constexpr void clear() noexcept
     {
-        const std::size_t sz = values().size();
-        for (std::size_t i = 0; i < sz; i++)
+        if constexpr (NotTriviallyDestructible<V>)
         {
-            if (array_set_unchecked_at(i))
+            for (std::size_t i = array_set().find_first_at_or_after(0); i < ENUM_COUNT;
+                 i = array_set().find_first_at_or_after(i + 1))
             {
-                reset_at(i);
+                std::destroy_at(&unchecked_at(i));
             }
         }
+        array_set().reset_all();
     }
     constexpr std::pair<iterator, bool> insert(const value_type& value) noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(value.first);
-        if (array_set_unchecked_at(ordinal))
+        if (contains_at(ordinal))
         {
             return {create_iterator(ordinal), false};
         }
 
-        increment_size();
-        array_set_unchecked_at(ordinal) = true;
+        array_set().set(ordinal);
         std::construct_at(&values_unchecked_at(ordinal), value.second);
         return {create_iterator(ordinal), true};
     }
     constexpr std::pair<iterator, bool> insert(value_type&& value) noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(value.first);
-        if (array_set_unchecked_at(ordinal))
+        if (contains_at(ordinal))
         {
             return {create_iterator(ordinal), false};
         }
 
-        increment_size();
-        array_set_unchecked_at(ordinal) = true;
+        array_set().set(ordinal);
         std::construct_at(&values_unchecked_at(ordinal), std::move(value.second));
         return {create_iterator(ordinal), true};
     }
@@ -446,11 +451,10 @@ public:
         requires std::is_assignable_v<mapped_type&, M&&>
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
-        const bool is_insertion = !array_set_unchecked_at(ordinal);
+        const bool is_insertion = !contains_at(ordinal);
         if (is_insertion)
         {
-            increment_size();
-            array_set_unchecked_at(ordinal) = true;
+            array_set().set(ordinal);
         }
         values_unchecked_at(ordinal) = OptionalV(std::forward<M>(obj));
         return {create_iterator(ordinal), is_insertion};
@@ -466,13 +470,12 @@ public:
     constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
-        if (array_set_unchecked_at(ordinal))
+        if (contains_at(ordinal))
         {
             return {create_iterator(ordinal), false};
         }
 
-        increment_size();
-        array_set_unchecked_at(ordinal) = true;
+        array_set().set(ordinal);
         std::construct_at(
             &values_unchecked_at(ordinal), std::in_place, std::forward<Args>(args)...);
         return {create_iterator(ordinal), true};
@@ -522,12 +525,10 @@ public:
         const std::size_t to = last == cend() ? ENUM_COUNT : EnumAdapterType::ordinal(last->first);
         assert(from <= to);
 
-        for (std::size_t i = from; i < to; i++)
+        for (std::size_t i = array_set().find_first_at_or_after(from); i < to;
+             i = array_set().find_first_at_or_after(i + 1))
         {
-            if (contains_at(i))
-            {
-                reset_at(i);
-            }
+            reset_at(i);
         }
 
         return create_iterator(to);
@@ -580,18 +581,14 @@ public:
     template <enum_map_customize::EnumMapChecking<K> CheckingType2>
     [[nodiscard]] constexpr bool operator==(const EnumMapBase<K, V, CheckingType2>& other) const
     {
-        for (std::size_t i = 0; i < ENUM_COUNT; i++)
+        if (this->array_set() != other.array_set())
         {
-            if (this->array_set_unchecked_at(i) != other.array_set_unchecked_at(i))
-            {
-                return false;
-            }
-
-            if (!this->array_set_unchecked_at(i))
-            {
-                continue;
-            }
+            return false;
+        }
 
+        for (std::size_t i = array_set().find_first_at_or_after(0); i < ENUM_COUNT;
+             i = array_set().find_first_at_or_after(i + 1))
+        {
             if (this->unchecked_at(i) != other.unchecked_at(i))
             {
                 return false;
@@ -609,8 +606,7 @@ private:
             return;
         }
 
-        increment_size();
-        array_set_unchecked_at(ordinal) = true;
+        array_set().set(ordinal);
         std::construct_at(&values_unchecked_at(ordinal), std::in_place);
     }
 
@@ -646,27 +642,15 @@ private:
         {
             std::destroy_at(&unchecked_at(i));
         }
-        array_set_unchecked_at(i) = false;
-        decrement_size();
+        array_set().reset(i);
     }
 
 protected:  // [WORKAROUND-1]
-    constexpr const std::array<bool, ENUM_COUNT>& array_set() const
+    constexpr const ArraySetType& array_set() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
     }
-    constexpr std::array<bool, ENUM_COUNT>& array_set()
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
-    }
-    constexpr const bool& array_set_unchecked_at(const std::size_t i) const
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_[i];
-    }
-    constexpr bool& array_set_unchecked_at(const std::size_t i)
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_[i];
-    }
+    constexpr ArraySetType& array_set() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_; }
 
     constexpr const ValueArrayType& values() const
     {
@@ -691,20 +675,7 @@ protected:  // [WORKAROUND-1]
     }
     [[nodiscard]] constexpr bool contains_at(const std::size_t i) const noexcept
     {
-        return array_set_unchecked_at(i);
-    }
-
-    constexpr void increment_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
-    }
-    constexpr void decrement_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
-    }
-    constexpr void set_size(const std::size_t size)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+        return array_set().test(i);
     }
 };
 }  // namespace fixed_containers::enum_map_detail
@@ -799,27 +770,21 @@ public:
       : EnumMap()
     {
         this->array_set() = other.array_set();
-        this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
+        for (std::size_t i = this->array_set().find_first_at_or_after(0); i < Base::ENUM_COUNT;
+             i = this->array_set().find_first_at_or_after(i + 1))
         {
-            if (this->contains_at(i))
-            {
-                std::construct_at(&this->values_unchecked_at(i), other.values_unchecked_at(i));
-            }
+            std::construct_at(&this->values_unchecked_at(i), other.values_unchecked_at(i));
         }
     }
     constexpr EnumMap(EnumMap&& other) noexcept
       : EnumMap()
     {
         this->array_set() = other.array_set();
-        this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
+        for (std::size_t i = this->array_set().find_first_at_or_after(0); i < Base::ENUM_COUNT;
+             i = this->array_set().find_first_at_or_after(i + 1))
         {
-            if (this->contains_at(i))
-            {
-                std::construct_at(&this->values_unchecked_at(i),
-                                  std::move(other.values_unchecked_at(i)));
-            }
+            std::construct_at(&this->values_unchecked_at(i),
+                              std::move(other.values_unchecked_at(i)));
         }
         // Clear the moved-out-of-map. This is consistent with both std::map
         // as well as the trivial move constructor of this class.
@@ -834,13 +799,10 @@ public:
 
         this->clear();
         this->array_set() = other.array_set();
-        this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
+        for (std::size_t i = this->array_set().find_first_at_or_after(0); i < Base::ENUM_COUNT;
+             i = this->array_set().find_first_at_or_after(i + 1))
         {
-            if (this->contains_at(i))
-            {
-                std::construct_at(&this->values_unchecked_at(i), other.values_unchecked_at(i));
-            }
+            std::construct_at(&this->values_unchecked_at(i), other.values_unchecked_at(i));
         }
         return *this;
     }
@@ -853,14 +815,11 @@ public:
 
         this->clear();
         this->array_set() = other.array_set();
-        this->set_size(other.size());
-        for (std::size_t i = 0; i < Base::ENUM_COUNT; i++)
+        for (std::size_t i = this->array_set().find_first_at_or_after(0); i < Base::ENUM_COUNT;
+             i = this->array_set().find_first_at_or_after(i + 1))
         {
-            if (this->contains_at(i))
-            {
-                std::construct_at(&this->values_unchecked_at(i),
-                                  std::move(other.values_unchecked_at(i)));
-            }
+            std::construct_at(&this->values_unchecked_at(i),
+                              std::move(other.values_unchecked_at(i)));
         }
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
         // consistency across EnumMaps. std::map<T> does clear it, so behavior is different.
@@ -4,7 +4,9 @@
 #include "fixed_containers/enum_utils.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/index_range_predicate_iterator.hpp"
+#include "fixed_containers/word_bitset.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
@@ -96,6 +98,8 @@ namespace fixed_containers
  *
  * Note that despite what the underlying implementation might suggest, this is NOT a bitset. EnumSet
  * is a set for the special case when the keys are enum values, so the API matches that of std::set.
+ * Presence is stored one bit per enumerator, so size(), iteration and the whole-set operations
+ * (union, intersection, difference, complement, subset test) work on 64 enumerators at a time.
  */
 template <class K>
 class EnumSet
@@ -115,6 +119,7 @@ private:
     static constexpr std::size_t ENUM_COUNT = EnumAdapterType::count();
     using KeyArrayType = std::array<K, ENUM_COUNT>;
     static constexpr const KeyArrayType& ENUM_VALUES = EnumAdapterType::values();
+    using ArraySetType = word_bitset_detail::WordBitset<ENUM_COUNT>;
 
     struct ReferenceProvider
     {
@@ -125,8 +130,16 @@ private:
 
     struct IndexPredicate
     {
-        const std::array<bool, ENUM_COUNT>* array_set_;
-        constexpr bool operator()(const std::size_t i) const { return (*array_set_)[i]; }
+        const ArraySetType* array_set_;
+        constexpr bool operator()(const std::size_t i) const { return array_set_->test(i); }
+        constexpr std::size_t next_index(const std::size_t i, const std::size_t end) const
+        {
+            return (std::min)(array_set_->find_first_at_or_after(i), end);
+        }
+        constexpr std::size_t previous_index(const std::size_t i) const
+        {
+            return array_set_->find_last_at_or_before(i);
+        }
     };
 
     template <IteratorDirection DIRECTION>
@@ -151,7 +164,14 @@ public:
     static constexpr EnumSetType all()
     {
         EnumSetType output{};
-        output.insert(ENUM_VALUES.cbegin(), ENUM_VALUES.cend());
+        if constexpr (std::same_as<EnumSetType, Self>)
+        {
+            output.array_set().set_all();
+        }
+        else
+        {
+            output.insert(ENUM_VALUES.cbegin(), ENUM_VALUES.cend());
+        }
         return output;
     }
 
@@ -164,6 +184,11 @@ public:
     template <class Container, class EnumSetType = Self>
     static constexpr EnumSetType complement_of(const Container& s)
     {
+        if constexpr (std::same_as<Container, Self> && std::same_as<EnumSetType, Self>)
+        {
+            return s.complement();
+        }
+
         EnumSetType output = all<EnumSetType>();
         for (const K& key : s)
         {
@@ -184,14 +209,11 @@ public:
     static constexpr std::size_t max_size() noexcept { return ENUM_COUNT; }
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    // std::bitset is not sufficiently constexpr to use here, using a std::array instead.
-    std::array<bool, ENUM_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
-    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    ArraySetType IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
 
 public:
     constexpr EnumSet() noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_()
-      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
     {
     }
 
@@ -227,22 +249,9 @@ public:
 
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
 
-    [[nodiscard]] constexpr std::size_t size() const noexcept
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
-    }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return array_set().count(); }
 
-    constexpr void clear() noexcept
-    {
-        const std::size_t sz = array_set().size();
-        for (std::size_t i = 0; i < sz; i++)
-        {
-            if (contains_at(i))
-            {
-                reset_at(i);
-            }
-        }
-    }
+    constexpr void clear() noexcept { array_set().reset_all(); }
     constexpr std::pair<const_iterator, bool> insert(const K& key) noexcept
     {
         const std::size_t ordinal = EnumAdapterType::ordinal(key);
@@ -251,8 +260,7 @@ public:
             return {create_const_iterator(ordinal), false};
         }
 
-        increment_size();
-        array_set_unchecked_at(EnumAdapterType::ordinal(key)) = true;
+        array_set().set(ordinal);
         return {create_const_iterator(ordinal), true};
     }
     constexpr const_iterator insert(const_iterator /*hint*/, const K& key) noexcept
@@ -287,12 +295,10 @@ public:
         const std::size_t to = last == end() ? ENUM_COUNT : EnumAdapterType::ordinal(*last);
         assert(from <= to);
 
-        for (std::size_t i = from; i < to; i++)
+        for (std::size_t i = array_set().find_first_at_or_after(from); i < to;
+             i = array_set().find_first_at_or_after(i + 1))
         {
-            if (contains_at(i))
-            {
-                reset_at(i);
-            }
+            reset_at(i);
         }
 
         return create_const_iterator(to);
@@ -315,36 +321,50 @@ public:
         return contains_at(EnumAdapterType::ordinal(key));
     }
 
-    constexpr bool operator==(const EnumSet<K>& other) const
+    /**
+     * Whole-set operations. These work on the packed representation directly, so they cost one
+     * operation per 64 enumerators regardless of how many keys are present.
+     */
+    [[nodiscard]] constexpr EnumSet union_with(const EnumSet& other) const noexcept
     {
-        return array_set() == other.array_set();
+        EnumSet output = *this;
+        output.array_set().union_with(other.array_set());
+        return output;
     }
-
-private:
-    constexpr const std::array<bool, ENUM_COUNT>& array_set() const
+    [[nodiscard]] constexpr EnumSet intersection_with(const EnumSet& other) const noexcept
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
+        EnumSet output = *this;
+        output.array_set().intersect_with(other.array_set());
+        return output;
     }
-    constexpr std::array<bool, ENUM_COUNT>& array_set()
+    [[nodiscard]] constexpr EnumSet difference_with(const EnumSet& other) const noexcept
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
+        EnumSet output = *this;
+        output.array_set().subtract(other.array_set());
+        return output;
     }
-    constexpr const bool& array_set_unchecked_at(const std::size_t i) const
+    [[nodiscard]] constexpr EnumSet complement() const noexcept
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_[i];
+        EnumSet output = *this;
+        output.array_set().flip_all();
+        return output;
     }
-    constexpr bool& array_set_unchecked_at(const std::size_t i)
+    [[nodiscard]] constexpr bool is_subset_of(const EnumSet& other) const noexcept
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_[i];
+        return array_set().is_subset_of(other.array_set());
     }
-    constexpr void increment_size(const std::size_t n = 1)
+
+    constexpr bool operator==(const EnumSet<K>& other) const
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
+        return array_set() == other.array_set();
     }
-    constexpr void decrement_size(const std::size_t n = 1)
+
+private:
+    constexpr const ArraySetType& array_set() const
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_;
     }
+    constexpr ArraySetType& array_set() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_set_; }
 
     constexpr const_iterator create_const_iterator(const std::size_t start_index) const noexcept
     {
@@ -360,14 +380,13 @@ private:
 
     [[nodiscard]] constexpr bool contains_at(const std::size_t i) const noexcept
     {
-        return array_set_unchecked_at(i);
+        return array_set().test(i);
     }
 
     constexpr void reset_at(const std::size_t i) noexcept
     {
         assert(contains_at(i));
-        array_set_unchecked_at(i) = false;
-        decrement_size();
+        array_set().reset(i);
     }
 };
 
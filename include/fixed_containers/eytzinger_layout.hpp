@@ -0,0 +1,116 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+
+namespace fixed_containers::eytzinger_layout_detail
+{
+// The Eytzinger layout stores a complete binary search tree in breadth-first order, so that it
+// needs no links: with 1-based positions, the children of position k are 2k and 2k + 1. A search
+// reads positions 1, 2 or 3, 4 to 7, ... so the first levels, which every search visits, share a
+// few cache lines instead of being spread over the whole array as with a binary search.
+//
+// Positions are 1-based here; 0 means "no position" (i.e. end()). The entry at position k is
+// stored at index k - 1.
+
+// First position in key order: the leftmost one
+[[nodiscard]] constexpr std::size_t first_position(const std::size_t count) noexcept
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    return std::bit_floor(count);
+}
+
+// Last position in key order: the rightmost one
+[[nodiscard]] constexpr std::size_t last_position(const std::size_t count) noexcept
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    // The rightmost path is 1, 3, 7, ...; if the last level is too short for it, stop one above
+    const std::size_t all_ones = (std::bit_floor(count) << 1U) - 1;
+    return all_ones <= count ? all_ones : all_ones >> 1U;
+}
+
+// Next position in key order, or 0 after the last one
+[[nodiscard]] constexpr std::size_t next_position(std::size_t k, const std::size_t count) noexcept
+{
+    if (2 * k + 1 <= count)
+    {
+        // Leftmost position of the right subtree
+        k = 2 * k + 1;
+        while (2 * k <= count)
+        {
+            k = 2 * k;
+        }
+        return k;
+    }
+    // Up until coming from a left child
+    return k >> (std::countr_one(k) + 1);
+}
+
+// Previous position in key order. 0 (i.e. end()) goes to the last position.
+[[nodiscard]] constexpr std::size_t previous_position(std::size_t k,
+                                                      const std::size_t count) noexcept
+{
+    if (k == 0)
+    {
+        return last_position(count);
+    }
+    if (2 * k <= count)
+    {
+        // Rightmost position of the left subtree
+        k = 2 * k;
+        while (2 * k + 1 <= count)
+        {
+            k = 2 * k + 1;
+        }
+        return k;
+    }
+    // Up until coming from a right child
+    return k >> (std::countr_zero(k) + 1);
+}
+
+// Descends from the root, going right whenever `go_right(entry)` is true. The comparison result
+// is turned into the next position arithmetically, so there is no data-dependent branch. The
+// position of the first entry for which `go_right` is false is recovered from the path: it is
+// where the descent went left for the last time. Returns 0 if there is none.
+template <class RandomAccessIt, class GoRight>
+[[nodiscard]] constexpr std::size_t first_position_not_to_the_right(const RandomAccessIt entries,
+                                                                    const std::size_t count,
+                                                                    const GoRight& go_right)
+{
+    std::size_t k = 1;
+    while (k <= count)
+    {
+        const bool right = go_right(entries[static_cast<std::ptrdiff_t>(k - 1)]);
+        k = 2 * k + static_cast<std::size_t>(right);
+    }
+    // Strip the trailing right turns, and then the last left turn
+    return k >> (std::countr_one(k) + 1);
+}
+
+// Same results as std::lower_bound/std::upper_bound, as positions
+template <class RandomAccessIt, class K0, class Compare>
+[[nodiscard]] constexpr std::size_t lower_bound_position(const RandomAccessIt entries,
+                                                         const std::size_t count,
+                                                         const K0& key,
+                                                         const Compare& comparator)
+{
+    return first_position_not_to_the_right(
+        entries, count, [&](const auto& entry) { return comparator(entry, key); });
+}
+template <class RandomAccessIt, class K0, class Compare>
+[[nodiscard]] constexpr std::size_t upper_bound_position(const RandomAccessIt entries,
+                                                         const std::size_t count,
+                                                         const K0& key,
+                                                         const Compare& comparator)
+{
+    return first_position_not_to_the_right(
+        entries, count, [&](const auto& entry) { return !comparator(key, entry); });
+}
+
+}  // namespace fixed_containers::eytzinger_layout_detail
@@ -0,0 +1,1246 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/flat_sorted_keys.hpp"
+#include "fixed_containers/smallest_unsigned_integer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_btree_detail
+{
+struct EmptyValue
+{
+    constexpr EmptyValue() = delete;
+};
+
+// The keys of a node are searched as one block. Two cache lines keep the fanout high enough for
+// shallow trees, and adjacent-line prefetching usually brings in the second line with the first.
+inline constexpr std::size_t NODE_KEY_BYTES = 2 * cache_line_detail::CACHE_LINE_SIZE;
+
+template <class K>
+inline constexpr std::size_t KEYS_PER_NODE =
+    (std::max)(std::size_t{4}, NODE_KEY_BYTES / sizeof(K));
+
+/**
+ * Node capacities and the pool sizes they imply. Every node except the root is kept at least
+ * half full, which bounds the number of nodes that can ever be in use at the same time:
+ *  - leaves are split in two halves when full and merged with a sibling when below half
+ *  - `n` leaves need at most `1 + (n - 2) / (INTERNAL_MIN_CHILDREN - 1)` internal nodes
+ */
+template <class K, std::size_t MAXIMUM_SIZE>
+struct BTreeLayout
+{
+    // A tree whose entries all fit in one leaf never splits, so don't make the leaf any larger
+    static constexpr std::size_t LEAF_CAPACITY =
+        (std::min)(KEYS_PER_NODE<K>, (std::max)(MAXIMUM_SIZE, std::size_t{1}));
+    static constexpr std::size_t LEAF_MIN_SIZE = LEAF_CAPACITY / 2;
+
+    static constexpr std::size_t INTERNAL_KEY_CAPACITY = KEYS_PER_NODE<K>;
+    static constexpr std::size_t INTERNAL_CHILD_CAPACITY = INTERNAL_KEY_CAPACITY + 1;
+    static constexpr std::size_t INTERNAL_MIN_CHILDREN = (INTERNAL_CHILD_CAPACITY + 1) / 2;
+
+    static constexpr std::size_t LEAF_POOL_SIZE =
+        MAXIMUM_SIZE <= LEAF_CAPACITY ? 1 : MAXIMUM_SIZE / LEAF_MIN_SIZE;
+    static constexpr std::size_t INTERNAL_POOL_SIZE =
+        1 + LEAF_POOL_SIZE / (INTERNAL_MIN_CHILDREN - 1);
+
+    // Number of internal levels of the tallest tree that the leaf pool can hold
+    static constexpr std::size_t MAXIMUM_HEIGHT = []()
+    {
+        std::size_t height = 0;
+        std::size_t minimum_leaf_count_of_taller_tree = 2;
+        while (minimum_leaf_count_of_taller_tree <= LEAF_POOL_SIZE)
+        {
+            height++;
+            minimum_leaf_count_of_taller_tree *= INTERNAL_MIN_CHILDREN;
+        }
+        return height;
+    }();
+
+    // Indexes both pools, plus one past the end of the leaf pool for "no node"
+    using NodeIndex = smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<LEAF_POOL_SIZE>;
+    static constexpr std::size_t NULL_INDEX = LEAF_POOL_SIZE;
+};
+
+template <class K, class V, std::size_t CAPACITY, class NodeIndex>
+class BTreeLeaf
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<K, CAPACITY> IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    FixedVector<V, CAPACITY> IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_next_;
+
+public:
+    constexpr BTreeLeaf() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_{}
+    {
+    }
+
+    [[nodiscard]] constexpr const FixedVector<K, CAPACITY>& keys() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    constexpr FixedVector<K, CAPACITY>& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    [[nodiscard]] constexpr const FixedVector<V, CAPACITY>& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr FixedVector<V, CAPACITY>& values()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+
+    [[nodiscard]] constexpr std::size_t previous() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_;
+    }
+    constexpr void set_previous(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_ = static_cast<NodeIndex>(i);
+    }
+    [[nodiscard]] constexpr std::size_t next() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_next_;
+    }
+    constexpr void set_next(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_ = static_cast<NodeIndex>(i);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const { return keys().size(); }
+    [[nodiscard]] constexpr bool full() const { return is_full(keys()); }
+
+    template <class KeyType, class... Args>
+    constexpr void emplace_back(KeyType&& key, Args&&... args)
+    {
+        keys().emplace_back(std::forward<KeyType>(key));
+        values().emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <class KeyType, class... Args>
+    constexpr void emplace_at(const std::size_t slot, KeyType&& key, Args&&... args)
+    {
+        keys().emplace(keys().cbegin() + static_cast<std::ptrdiff_t>(slot),
+                       std::forward<KeyType>(key));
+        values().emplace(values().cbegin() + static_cast<std::ptrdiff_t>(slot),
+                         std::forward<Args>(args)...);
+    }
+
+    constexpr void erase_at(const std::size_t slot)
+    {
+        keys().erase(keys().cbegin() + static_cast<std::ptrdiff_t>(slot));
+        values().erase(values().cbegin() + static_cast<std::ptrdiff_t>(slot));
+    }
+
+    // Moves the entries from `first` onwards to the back of `to`
+    constexpr void move_tail_to(const std::size_t first, BTreeLeaf& to)
+    {
+        for (std::size_t i = first; i < size(); i++)
+        {
+            to.keys().push_back(std::move(keys()[i]));
+            to.values().push_back(std::move(values()[i]));
+        }
+        keys().erase(keys().cbegin() + static_cast<std::ptrdiff_t>(first), keys().cend());
+        values().erase(values().cbegin() + static_cast<std::ptrdiff_t>(first), values().cend());
+    }
+
+    // Moves the last entry of `left` to the front of this leaf
+    constexpr void take_back_of(BTreeLeaf& left)
+    {
+        keys().insert(keys().cbegin(), std::move(left.keys().back()));
+        values().insert(values().cbegin(), std::move(left.values().back()));
+        left.keys().pop_back();
+        left.values().pop_back();
+    }
+
+    // Moves the first entry of `right` to the back of this leaf
+    constexpr void take_front_of(BTreeLeaf& right)
+    {
+        keys().push_back(std::move(right.keys().front()));
+        values().push_back(std::move(right.values().front()));
+        right.erase_at(0);
+    }
+};
+
+template <class K, std::size_t CAPACITY, class NodeIndex>
+class BTreeLeaf<K, EmptyValue, CAPACITY, NodeIndex>
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<K, CAPACITY> IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_next_;
+
+public:
+    constexpr BTreeLeaf() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_{}
+    {
+    }
+
+    [[nodiscard]] constexpr const FixedVector<K, CAPACITY>& keys() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    constexpr FixedVector<K, CAPACITY>& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+
+    [[nodiscard]] constexpr std::size_t previous() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_;
+    }
+    constexpr void set_previous(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_ = static_cast<NodeIndex>(i);
+    }
+    [[nodiscard]] constexpr std::size_t next() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_next_;
+    }
+    constexpr void set_next(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_ = static_cast<NodeIndex>(i);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const { return keys().size(); }
+    [[nodiscard]] constexpr bool full() const { return is_full(keys()); }
+
+    template <class KeyType>
+    constexpr void emplace_back(KeyType&& key)
+    {
+        keys().emplace_back(std::forward<KeyType>(key));
+    }
+
+    template <class KeyType>
+    constexpr void emplace_at(const std::size_t slot, KeyType&& key)
+    {
+        keys().emplace(keys().cbegin() + static_cast<std::ptrdiff_t>(slot),
+                       std::forward<KeyType>(key));
+    }
+
+    constexpr void erase_at(const std::size_t slot)
+    {
+        keys().erase(keys().cbegin() + static_cast<std::ptrdiff_t>(slot));
+    }
+
+    constexpr void move_tail_to(const std::size_t first, BTreeLeaf& to)
+    {
+        for (std::size_t i = first; i < size(); i++)
+        {
+            to.keys().push_back(std::move(keys()[i]));
+        }
+        keys().erase(keys().cbegin() + static_cast<std::ptrdiff_t>(first), keys().cend());
+    }
+
+    constexpr void take_back_of(BTreeLeaf& left)
+    {
+        keys().insert(keys().cbegin(), std::move(left.keys().back()));
+        left.keys().pop_back();
+    }
+
+    constexpr void take_front_of(BTreeLeaf& right)
+    {
+        keys().push_back(std::move(right.keys().front()));
+        right.erase_at(0);
+    }
+};
+
+// `keys()[i]` separates child `i` from child `i + 1`: it is greater than every key under child
+// `i`, and less than or equal to every key under child `i + 1`.
+template <class K, std::size_t KEY_CAPACITY, class NodeIndex>
+class BTreeInternalNode
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<K, KEY_CAPACITY> IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    std::array<NodeIndex, KEY_CAPACITY + 1> IMPLEMENTATION_DETAIL_DO_NOT_USE_children_;
+
+public:
+    constexpr BTreeInternalNode() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_children_{}
+    {
+    }
+
+    [[nodiscard]] constexpr const FixedVector<K, KEY_CAPACITY>& keys() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    constexpr FixedVector<K, KEY_CAPACITY>& keys()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+
+    [[nodiscard]] constexpr std::size_t child_count() const { return keys().size() + 1; }
+    [[nodiscard]] constexpr bool full() const { return is_full(keys()); }
+
+    [[nodiscard]] constexpr std::size_t child(const std::size_t i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_children_[i];
+    }
+    constexpr void set_child(const std::size_t i, const std::size_t node)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_children_[i] = static_cast<NodeIndex>(node);
+    }
+
+    // Inserts `key` at `i`, with `right_child` as the child right after it
+    constexpr void insert_at(const std::size_t i, K&& key, const std::size_t right_child)
+    {
+        auto& children = IMPLEMENTATION_DETAIL_DO_NOT_USE_children_;
+        std::copy_backward(children.begin() + static_cast<std::ptrdiff_t>(i + 1),
+                           children.begin() + static_cast<std::ptrdiff_t>(child_count()),
+                           children.begin() + static_cast<std::ptrdiff_t>(child_count() + 1));
+        set_child(i + 1, right_child);
+        keys().insert(keys().cbegin() + static_cast<std::ptrdiff_t>(i), std::move(key));
+    }
+    constexpr void push_back(K&& key, const std::size_t right_child)
+    {
+        set_child(child_count(), right_child);
+        keys().push_back(std::move(key));
+    }
+    constexpr void push_front(K&& key, const std::size_t left_child)
+    {
+        auto& children = IMPLEMENTATION_DETAIL_DO_NOT_USE_children_;
+        std::copy_backward(children.begin(),
+                           children.begin() + static_cast<std::ptrdiff_t>(child_count()),
+                           children.begin() + static_cast<std::ptrdiff_t>(child_count() + 1));
+        set_child(0, left_child);
+        keys().insert(keys().cbegin(), std::move(key));
+    }
+
+    // Removes the key at `i` and the child right after it
+    constexpr void erase_at(const std::size_t i)
+    {
+        auto& children = IMPLEMENTATION_DETAIL_DO_NOT_USE_children_;
+        std::copy(children.begin() + static_cast<std::ptrdiff_t>(i + 2),
+                  children.begin() + static_cast<std::ptrdiff_t>(child_count()),
+                  children.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        keys().erase(keys().cbegin() + static_cast<std::ptrdiff_t>(i));
+    }
+    // Removes the first key and the first child
+    constexpr void pop_front()
+    {
+        auto& children = IMPLEMENTATION_DETAIL_DO_NOT_USE_children_;
+        std::copy(children.begin() + 1,
+                  children.begin() + static_cast<std::ptrdiff_t>(child_count()),
+                  children.begin());
+        keys().erase(keys().cbegin());
+    }
+    // Removes the last key and the last child
+    constexpr void pop_back() { keys().pop_back(); }
+};
+
+// An entry, as the leaf that holds it and its slot in that leaf. The end position is
+// `{NULL_INDEX, 0}`; it is both one past the last entry and one before the first one.
+struct BTreePosition
+{
+    std::size_t leaf;
+    std::size_t slot;
+
+    constexpr bool operator==(const BTreePosition&) const = default;
+};
+
+/**
+ * B+tree with all entries in the leaves, which are linked in key order for range iteration.
+ * Internal nodes only hold copies of keys to direct the search, so K must be copyable.
+ * Nodes come from two index-based pools (leaves, internal nodes) and refer to each other by
+ * index, so the tree is pointer-free.
+ *
+ * There are no parent links: modifications descend from the root while recording the path, and
+ * splits and merges are then propagated up that path. Neither needs recursion.
+ */
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare>
+class FixedBTreeBase
+{
+protected:  // [WORKAROUND-1]
+    static constexpr bool HAS_ASSOCIATED_VALUE = !std::is_same_v<V, EmptyValue>;
+    using Layout = BTreeLayout<K, MAXIMUM_SIZE>;
+    using NodeIndex = typename Layout::NodeIndex;
+    static constexpr std::size_t NULL_INDEX = Layout::NULL_INDEX;
+    using SizeType = smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>;
+
+public:
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using LeafNode = BTreeLeaf<K, V, Layout::LEAF_CAPACITY, NodeIndex>;
+    using InternalNode = BTreeInternalNode<K, Layout::INTERNAL_KEY_CAPACITY, NodeIndex>;
+    using LeafPool = FixedIndexBasedPoolStorage<LeafNode, Layout::LEAF_POOL_SIZE>;
+    using InternalPool = FixedIndexBasedPoolStorage<InternalNode, Layout::INTERNAL_POOL_SIZE>;
+
+    struct PathEntry
+    {
+        std::size_t node;
+        std::size_t child;
+    };
+    // The internal nodes from the root down to the leaf, and which child was taken at each
+    using Path = std::array<PathEntry, (std::max)(Layout::MAXIMUM_HEIGHT, std::size_t{1})>;
+
+    struct InsertionPoint
+    {
+        Path path;
+        std::size_t leaf;
+        std::size_t slot;
+        bool is_present;
+    };
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    LeafPool IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_;
+    InternalPool IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+    SizeType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedBTreeBase() noexcept
+      : FixedBTreeBase(Compare{})
+    {
+    }
+
+    explicit constexpr FixedBTreeBase(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{static_cast<NodeIndex>(NULL_INDEX)}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_{static_cast<NodeIndex>(NULL_INDEX)}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_{static_cast<NodeIndex>(NULL_INDEX)}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_height_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return size() == MAXIMUM_SIZE; }
+
+    // Number of nodes from the root to any leaf (all leaves are at the same depth)
+    [[nodiscard]] constexpr std::size_t depth() const noexcept
+    {
+        return empty() ? 0 : height() + 1;
+    }
+
+    [[nodiscard]] constexpr const Compare& comparator() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    constexpr void clear() noexcept
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        for (std::size_t i = first_leaf_index(); i != NULL_INDEX;)
+        {
+            const std::size_t next = leaf_at(i).next();
+            leaves().delete_at_and_return_repositioned_index(i);
+            i = next;
+        }
+
+        // Depth-first, with the child to visit next stored alongside every node of the path
+        if (height() > 0)
+        {
+            assert(height() <= Layout::MAXIMUM_HEIGHT);
+            Path stack{};
+            std::size_t level = 0;
+            stack[0] = {root_index(), 0};
+            while (true)
+            {
+                PathEntry& top = stack[level];
+                const InternalNode& node = internal_node_at(top.node);
+                // height() never exceeds MAXIMUM_HEIGHT; the second bound states it for the
+                // optimizer, which otherwise cannot tell that stack[level] stays in range
+                if (level + 1 < height() && level + 1 < Layout::MAXIMUM_HEIGHT &&
+                    top.child < node.child_count())
+                {
+                    const std::size_t child = node.child(top.child);
+                    top.child++;
+                    level++;
+                    stack[level] = {child, 0};
+                    continue;
+                }
+
+                internal_nodes().delete_at_and_return_repositioned_index(top.node);
+                if (level == 0)
+                {
+                    break;
+                }
+                level--;
+            }
+        }
+
+        set_root_index(NULL_INDEX);
+        set_first_leaf_index(NULL_INDEX);
+        set_last_leaf_index(NULL_INDEX);
+        set_height(0);
+        set_size(0);
+    }
+
+    [[nodiscard]] constexpr BTreePosition begin_position() const noexcept
+    {
+        return {first_leaf_index(), 0};
+    }
+    [[nodiscard]] static constexpr BTreePosition end_position() noexcept { return {NULL_INDEX, 0}; }
+
+    constexpr void advance(BTreePosition& position) const noexcept
+    {
+        if (position.leaf == NULL_INDEX)
+        {
+            position = begin_position();
+            return;
+        }
+        position.slot++;
+        position = normalized(position);
+    }
+    constexpr void recede(BTreePosition& position) const noexcept
+    {
+        if (position.leaf == NULL_INDEX)
+        {
+            position.leaf = last_leaf_index();
+            position.slot = position.leaf == NULL_INDEX ? 0 : leaf_at(position.leaf).size() - 1;
+            return;
+        }
+        if (position.slot > 0)
+        {
+            position.slot--;
+            return;
+        }
+        position.leaf = leaf_at(position.leaf).previous();
+        position.slot = position.leaf == NULL_INDEX ? 0 : leaf_at(position.leaf).size() - 1;
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const BTreePosition& position) const noexcept
+    {
+        return leaf_at(position.leaf).keys()[position.slot];
+    }
+    [[nodiscard]] constexpr const V& value_at(const BTreePosition& position) const noexcept
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return leaf_at(position.leaf).values()[position.slot];
+    }
+    [[nodiscard]] constexpr V& value_at(const BTreePosition& position) noexcept
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return leaf_at(position.leaf).values()[position.slot];
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr BTreePosition find_position(const K0& key) const noexcept
+    {
+        const std::size_t leaf_index = leaf_index_for(key, nullptr);
+        if (leaf_index == NULL_INDEX)
+        {
+            return end_position();
+        }
+        const auto& keys = leaf_at(leaf_index).keys();
+        const std::size_t slot = lower_bound_in(keys, key);
+        if (slot == keys.size() || comparator()(key, keys[slot]))
+        {
+            return end_position();
+        }
+        return {leaf_index, slot};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr BTreePosition lower_bound_position(const K0& key) const noexcept
+    {
+        const std::size_t leaf_index = leaf_index_for(key, nullptr);
+        if (leaf_index == NULL_INDEX)
+        {
+            return end_position();
+        }
+        return normalized({leaf_index, lower_bound_in(leaf_at(leaf_index).keys(), key)});
+    }
+    template <class K0>
+    [[nodiscard]] constexpr BTreePosition upper_bound_position(const K0& key) const noexcept
+    {
+        const std::size_t leaf_index = leaf_index_for(key, nullptr);
+        if (leaf_index == NULL_INDEX)
+        {
+            return end_position();
+        }
+        return normalized({leaf_index, upper_bound_in(leaf_at(leaf_index).keys(), key)});
+    }
+
+    // Where `key` is, or would be inserted, along with the path that leads there
+    template <class K0>
+    [[nodiscard]] constexpr InsertionPoint locate(const K0& key) const noexcept
+    {
+        InsertionPoint out{};
+        out.leaf = leaf_index_for(key, &out.path);
+        if (out.leaf == NULL_INDEX)
+        {
+            out.slot = 0;
+            out.is_present = false;
+            return out;
+        }
+        const auto& keys = leaf_at(out.leaf).keys();
+        out.slot = lower_bound_in(keys, key);
+        out.is_present = out.slot != keys.size() && !comparator()(key, keys[out.slot]);
+        return out;
+    }
+
+    // Inserts a new entry at the point returned by `locate()`, which must not be present
+    template <class KeyType, class... Args>
+    constexpr BTreePosition emplace_at(InsertionPoint& point, KeyType&& key, Args&&... args)
+    {
+        assert(!point.is_present);
+        assert(!full());
+        set_size(size() + 1);
+
+        if (point.leaf == NULL_INDEX)
+        {
+            const std::size_t leaf_index = leaves().emplace_and_return_index();
+            LeafNode& leaf = leaf_at(leaf_index);
+            leaf.set_previous(NULL_INDEX);
+            leaf.set_next(NULL_INDEX);
+            leaf.emplace_back(std::forward<KeyType>(key), std::forward<Args>(args)...);
+            set_root_index(leaf_index);
+            set_first_leaf_index(leaf_index);
+            set_last_leaf_index(leaf_index);
+            return {leaf_index, 0};
+        }
+
+        LeafNode& leaf = leaf_at(point.leaf);
+        if (!leaf.full())
+        {
+            leaf.emplace_at(point.slot, std::forward<KeyType>(key), std::forward<Args>(args)...);
+            return {point.leaf, point.slot};
+        }
+
+        // Split first, so that the leaves never need room for more than their capacity
+        const std::size_t right_index = emplace_leaf_after(point.leaf);
+        LeafNode& right = leaf_at(right_index);
+        const std::size_t left_size = Layout::LEAF_CAPACITY - Layout::LEAF_MIN_SIZE;
+        leaf.move_tail_to(left_size, right);
+
+        BTreePosition out{};
+        if (point.slot <= left_size)
+        {
+            leaf.emplace_at(point.slot, std::forward<KeyType>(key), std::forward<Args>(args)...);
+            out = {point.leaf, point.slot};
+        }
+        else
+        {
+            const std::size_t slot = point.slot - left_size;
+            right.emplace_at(slot, std::forward<KeyType>(key), std::forward<Args>(args)...);
+            out = {right_index, slot};
+        }
+
+        insert_into_parents(point.path, K{right.keys().front()}, right_index);
+        return out;
+    }
+
+    // Removes the entry at `position` and returns the position of the entry that followed it
+    constexpr BTreePosition erase_at(const BTreePosition& position) noexcept
+    {
+        Path path{};
+        [[maybe_unused]] const std::size_t leaf_index = leaf_index_for(key_at(position), &path);
+        assert(leaf_index == position.leaf);
+
+        LeafNode& leaf = leaf_at(position.leaf);
+        leaf.erase_at(position.slot);
+        set_size(size() - 1);
+
+        if (height() == 0)
+        {
+            if (leaf.size() == 0)
+            {
+                leaves().delete_at_and_return_repositioned_index(position.leaf);
+                set_root_index(NULL_INDEX);
+                set_first_leaf_index(NULL_INDEX);
+                set_last_leaf_index(NULL_INDEX);
+                return end_position();
+            }
+            return normalized(position);
+        }
+
+        if (leaf.size() >= Layout::LEAF_MIN_SIZE)
+        {
+            return normalized(position);
+        }
+
+        const BTreePosition out = rebalance_leaf(path, position);
+        rebalance_internal_nodes(path);
+        return normalized(out);
+    }
+
+    /**
+     * Builds the tree bottom-up from `count` entries that are sorted and unique, in linear time.
+     * `emplace_next(LeafNode&)` must emplace the next entry at the back of the given leaf.
+     * Entries are spread evenly over as few leaves as possible, so the leaves are close to full.
+     */
+    template <class EntryEmplacer>
+    constexpr void build_from_sorted_unique(const std::size_t count, EntryEmplacer&& emplace_next)
+    {
+        assert(empty());
+        assert(count <= MAXIMUM_SIZE);
+        if (count == 0)
+        {
+            return;
+        }
+
+        // The nodes of the level being built, along with the first leaf under each. Each level is
+        // written over the one below it, which is always at least as long.
+        std::array<NodeIndex, Layout::LEAF_POOL_SIZE> nodes{};
+        std::array<NodeIndex, Layout::LEAF_POOL_SIZE> first_leaves{};
+
+        const std::size_t leaf_count = (count + Layout::LEAF_CAPACITY - 1) / Layout::LEAF_CAPACITY;
+        std::size_t previous = NULL_INDEX;
+        for (std::size_t i = 0; i < leaf_count; i++)
+        {
+            const std::size_t leaf_index = emplace_leaf_after(previous);
+            LeafNode& leaf = leaf_at(leaf_index);
+            const std::size_t entry_count =
+                (count / leaf_count) + static_cast<std::size_t>(i < count % leaf_count);
+            for (std::size_t j = 0; j < entry_count; j++)
+            {
+                emplace_next(leaf);
+            }
+            nodes[i] = static_cast<NodeIndex>(leaf_index);
+            first_leaves[i] = static_cast<NodeIndex>(leaf_index);
+            previous = leaf_index;
+        }
+        set_size(count);
+
+        std::size_t node_count = leaf_count;
+        while (node_count > 1)
+        {
+            const std::size_t group_count = (node_count + Layout::INTERNAL_CHILD_CAPACITY - 1) /
+                                            Layout::INTERNAL_CHILD_CAPACITY;
+            std::size_t read = 0;
+            for (std::size_t group = 0; group < group_count; group++)
+            {
+                const bool takes_remainder = group < node_count % group_count;
+                const std::size_t child_count =
+                    (node_count / group_count) + static_cast<std::size_t>(takes_remainder);
+                const std::size_t internal_index = internal_nodes().emplace_and_return_index();
+                InternalNode& internal = internal_node_at(internal_index);
+                internal.set_child(0, nodes[read]);
+                for (std::size_t j = 1; j < child_count; j++)
+                {
+                    internal.push_back(K{leaf_at(first_leaves[read + j]).keys().front()},
+                                       nodes[read + j]);
+                }
+                nodes[group] = static_cast<NodeIndex>(internal_index);
+                first_leaves[group] = first_leaves[read];
+                read += child_count;
+            }
+            node_count = group_count;
+            set_height(height() + 1);
+        }
+        set_root_index(nodes[0]);
+    }
+
+protected:  // [WORKAROUND-1]
+    constexpr const LeafPool& leaves() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_; }
+    constexpr LeafPool& leaves() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_; }
+    constexpr const InternalPool& internal_nodes() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_;
+    }
+    constexpr InternalPool& internal_nodes()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_;
+    }
+    constexpr const LeafNode& leaf_at(const std::size_t i) const { return leaves().at(i); }
+    constexpr LeafNode& leaf_at(const std::size_t i) { return leaves().at(i); }
+    constexpr const InternalNode& internal_node_at(const std::size_t i) const
+    {
+        return internal_nodes().at(i);
+    }
+    constexpr InternalNode& internal_node_at(const std::size_t i) { return internal_nodes().at(i); }
+
+    [[nodiscard]] constexpr std::size_t root_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    }
+    constexpr void set_root_index(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = static_cast<NodeIndex>(i);
+    }
+    [[nodiscard]] constexpr std::size_t first_leaf_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_;
+    }
+    constexpr void set_first_leaf_index(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_ = static_cast<NodeIndex>(i);
+    }
+    [[nodiscard]] constexpr std::size_t last_leaf_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_;
+    }
+    constexpr void set_last_leaf_index(const std::size_t i)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_ = static_cast<NodeIndex>(i);
+    }
+    // Number of internal levels, i.e. 0 when the root is a leaf
+    [[nodiscard]] constexpr std::size_t height() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+    }
+    constexpr void set_height(const std::size_t h)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_height_ = static_cast<NodeIndex>(h);
+    }
+    constexpr void set_size(const std::size_t s)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = static_cast<SizeType>(s);
+    }
+
+    // At runtime, search through a plain pointer rather than the (range-checked) vector iterators
+    template <class KeyVector, class K0>
+    [[nodiscard]] constexpr std::size_t lower_bound_in(const KeyVector& keys,
+                                                       const K0& key) const
+    {
+        if (std::is_constant_evaluated())
+        {
+            return flat_sorted_keys_detail::lower_bound_index(
+                keys.cbegin(), keys.size(), key, comparator());
+        }
+        return flat_sorted_keys_detail::lower_bound_index(
+            keys.data(), keys.size(), key, comparator());
+    }
+    template <class KeyVector, class K0>
+    [[nodiscard]] constexpr std::size_t upper_bound_in(const KeyVector& keys,
+                                                       const K0& key) const
+    {
+        if (std::is_constant_evaluated())
+        {
+            return flat_sorted_keys_detail::upper_bound_index(
+                keys.cbegin(), keys.size(), key, comparator());
+        }
+        return flat_sorted_keys_detail::upper_bound_index(
+            keys.data(), keys.size(), key, comparator());
+    }
+
+    // The only leaf that can hold `key`. Records the path to it if `path` is not null.
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t leaf_index_for(const K0& key, Path* path) const
+    {
+        std::size_t node = root_index();
+        for (std::size_t level = 0; level < height(); level++)
+        {
+            const InternalNode& internal = internal_node_at(node);
+            const std::size_t child = upper_bound_in(internal.keys(), key);
+            if (path != nullptr)
+            {
+                (*path)[level] = {node, child};
+            }
+            node = internal.child(child);
+        }
+        return node;
+    }
+
+    // Moves one-past-the-end of a leaf to the start of the next one
+    [[nodiscard]] constexpr BTreePosition normalized(const BTreePosition& position) const
+    {
+        const LeafNode& leaf = leaf_at(position.leaf);
+        if (position.slot < leaf.size())
+        {
+            return position;
+        }
+        return {leaf.next(), 0};
+    }
+
+    // Emplaces an empty leaf and links it after `previous`, or first if that is NULL_INDEX
+    constexpr std::size_t emplace_leaf_after(const std::size_t previous)
+    {
+        assert(!leaves().full());
+        const std::size_t i = leaves().emplace_and_return_index();
+        const std::size_t next = previous == NULL_INDEX ? first_leaf_index()
+                                                        : leaf_at(previous).next();
+        LeafNode& leaf = leaf_at(i);
+        leaf.set_previous(previous);
+        leaf.set_next(next);
+        if (previous == NULL_INDEX)
+        {
+            set_first_leaf_index(i);
+        }
+        else
+        {
+            leaf_at(previous).set_next(i);
+        }
+        if (next == NULL_INDEX)
+        {
+            set_last_leaf_index(i);
+        }
+        else
+        {
+            leaf_at(next).set_previous(i);
+        }
+        return i;
+    }
+
+    constexpr void unlink_and_delete_leaf(const std::size_t i)
+    {
+        const std::size_t previous = leaf_at(i).previous();
+        const std::size_t next = leaf_at(i).next();
+        if (previous == NULL_INDEX)
+        {
+            set_first_leaf_index(next);
+        }
+        else
+        {
+            leaf_at(previous).set_next(next);
+        }
+        if (next == NULL_INDEX)
+        {
+            set_last_leaf_index(previous);
+        }
+        else
+        {
+            leaf_at(next).set_previous(previous);
+        }
+        leaves().delete_at_and_return_repositioned_index(i);
+    }
+
+    // `right`, whose smallest key is `separator`, was split off the node at the end of `path`
+    // and must be added to the parent right after it. Splits the parents as needed.
+    constexpr void insert_into_parents(const Path& path, K separator, std::size_t right)
+    {
+        for (std::size_t level = height(); level-- > 0;)
+        {
+            const PathEntry& entry = path[level];
+            InternalNode& node = internal_node_at(entry.node);
+            if (!node.full())
+            {
+                node.insert_at(entry.child, std::move(separator), right);
+                return;
+            }
+            right = split_internal_node_and_insert(entry.node, entry.child, separator, right);
+        }
+
+        // The root was split
+        const std::size_t new_root_index = internal_nodes().emplace_and_return_index();
+        InternalNode& new_root = internal_node_at(new_root_index);
+        new_root.set_child(0, root_index());
+        new_root.push_back(std::move(separator), right);
+        set_root_index(new_root_index);
+        set_height(height() + 1);
+    }
+
+    // Inserts `separator` at `i` (and `right_child` after it) into the full node, then splits it
+    // in two halves. Returns the new right half, and leaves in `separator` the middle key, which
+    // moves up to the parent.
+    constexpr std::size_t split_internal_node_and_insert(const std::size_t node_index,
+                                                         const std::size_t i,
+                                                         K& separator,
+                                                         const std::size_t right_child)
+    {
+        constexpr std::size_t KEY_COUNT = Layout::INTERNAL_KEY_CAPACITY + 1;
+        constexpr std::size_t LEFT_CHILD_COUNT = Layout::INTERNAL_MIN_CHILDREN;
+
+        InternalNode& node = internal_node_at(node_index);
+        FixedVector<K, KEY_COUNT> keys{};
+        std::array<NodeIndex, KEY_COUNT + 1> children{};
+        for (std::size_t j = 0; j < node.child_count(); j++)
+        {
+            children[j] = static_cast<NodeIndex>(node.child(j));
+        }
+        for (K& key : node.keys())
+        {
+            keys.push_back(std::move(key));
+        }
+        node.keys().clear();
+
+        keys.insert(keys.cbegin() + static_cast<std::ptrdiff_t>(i), std::move(separator));
+        std::copy_backward(children.begin() + static_cast<std::ptrdiff_t>(i + 1),
+                           children.end() - 1,
+                           children.end());
+        children[i + 1] = static_cast<NodeIndex>(right_child);
+
+        for (std::size_t j = 1; j < LEFT_CHILD_COUNT; j++)
+        {
+            node.push_back(std::move(keys[j - 1]), children[j]);
+        }
+        separator = std::move(keys[LEFT_CHILD_COUNT - 1]);
+
+        const std::size_t new_index = internal_nodes().emplace_and_return_index();
+        InternalNode& new_node = internal_node_at(new_index);
+        new_node.set_child(0, children[LEFT_CHILD_COUNT]);
+        for (std::size_t j = LEFT_CHILD_COUNT; j < KEY_COUNT; j++)
+        {
+            new_node.push_back(std::move(keys[j]), children[j + 1]);
+        }
+        return new_index;
+    }
+
+    // The leaf at `position` is below the minimum size: borrow an entry from a sibling, or merge
+    // with one. Returns where the entry at `position` ended up.
+    constexpr BTreePosition rebalance_leaf(const Path& path, const BTreePosition& position)
+    {
+        const PathEntry& entry = path[height() - 1];
+        InternalNode& parent = internal_node_at(entry.node);
+        LeafNode& leaf = leaf_at(position.leaf);
+
+        if (entry.child > 0)
+        {
+            LeafNode& left = leaf_at(parent.child(entry.child - 1));
+            if (left.size() > Layout::LEAF_MIN_SIZE)
+            {
+                leaf.take_back_of(left);
+                parent.keys()[entry.child - 1] = leaf.keys().front();
+                return {position.leaf, position.slot + 1};
+            }
+        }
+        if (entry.child + 1 < parent.child_count())
+        {
+            LeafNode& right = leaf_at(parent.child(entry.child + 1));
+            if (right.size() > Layout::LEAF_MIN_SIZE)
+            {
+                leaf.take_front_of(right);
+                parent.keys()[entry.child] = right.keys().front();
+                return position;
+            }
+        }
+
+        if (entry.child > 0)
+        {
+            const std::size_t left_index = parent.child(entry.child - 1);
+            LeafNode& left = leaf_at(left_index);
+            const BTreePosition out{left_index, left.size() + position.slot};
+            leaf.move_tail_to(0, left);
+            unlink_and_delete_leaf(position.leaf);
+            parent.erase_at(entry.child - 1);
+            return out;
+        }
+
+        const std::size_t right_index = parent.child(entry.child + 1);
+        leaf_at(right_index).move_tail_to(0, leaf);
+        unlink_and_delete_leaf(right_index);
+        parent.erase_at(entry.child);
+        return position;
+    }
+
+    // Restores the minimum child count of the internal nodes along `path`, bottom-up, after one
+    // of the leaves at its end was merged away
+    constexpr void rebalance_internal_nodes(const Path& path)
+    {
+        for (std::size_t level = height(); level-- > 0;)
+        {
+            const std::size_t node_index = path[level].node;
+            InternalNode& node = internal_node_at(node_index);
+            if (level == 0)
+            {
+                if (node.child_count() == 1)
+                {
+                    set_root_index(node.child(0));
+                    internal_nodes().delete_at_and_return_repositioned_index(node_index);
+                    set_height(height() - 1);
+                }
+                return;
+            }
+            if (node.child_count() >= Layout::INTERNAL_MIN_CHILDREN)
+            {
+                return;
+            }
+
+            const PathEntry& entry = path[level - 1];
+            InternalNode& parent = internal_node_at(entry.node);
+            if (entry.child > 0)
+            {
+                InternalNode& left = internal_node_at(parent.child(entry.child - 1));
+                if (left.child_count() > Layout::INTERNAL_MIN_CHILDREN)
+                {
+                    node.push_front(std::move(parent.keys()[entry.child - 1]),
+                                    left.child(left.child_count() - 1));
+                    parent.keys()[entry.child - 1] = std::move(left.keys().back());
+                    left.pop_back();
+                    return;
+                }
+            }
+            if (entry.child + 1 < parent.child_count())
+            {
+                InternalNode& right = internal_node_at(parent.child(entry.child + 1));
+                if (right.child_count() > Layout::INTERNAL_MIN_CHILDREN)
+                {
+                    node.push_back(std::move(parent.keys()[entry.child]), right.child(0));
+                    parent.keys()[entry.child] = std::move(right.keys().front());
+                    right.pop_front();
+                    return;
+                }
+            }
+
+            if (entry.child > 0)
+            {
+                merge_internal_nodes(parent, entry.child - 1);
+            }
+            else
+            {
+                merge_internal_nodes(parent, entry.child);
+            }
+        }
+    }
+
+    // Merges child `i + 1` of `parent` into child `i`, pulling down the key that separates them
+    constexpr void merge_internal_nodes(InternalNode& parent, const std::size_t i)
+    {
+        const std::size_t right_index = parent.child(i + 1);
+        InternalNode& left = internal_node_at(parent.child(i));
+        InternalNode& right = internal_node_at(right_index);
+        left.push_back(std::move(parent.keys()[i]), right.child(0));
+        for (std::size_t j = 0; j < right.keys().size(); j++)
+        {
+            left.push_back(std::move(right.keys()[j]), right.child(j + 1));
+        }
+        internal_nodes().delete_at_and_return_repositioned_index(right_index);
+        parent.erase_at(i);
+    }
+};
+
+}  // namespace fixed_containers::fixed_btree_detail
+
+namespace fixed_containers::fixed_btree_detail::specializations
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare>
+class FixedBTree : public fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare>
+{
+    using Base = fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare>;
+
+public:
+    // clang-format off
+    constexpr FixedBTree() noexcept : Base() { }
+    explicit constexpr FixedBTree(const Compare& comparator) noexcept : Base(comparator) { }
+    // clang-format on
+
+    constexpr FixedBTree(const FixedBTree& other)
+        requires TriviallyCopyConstructible<K> && TriviallyCopyConstructible<V>
+    = default;
+    constexpr FixedBTree(FixedBTree&& other) noexcept
+        requires TriviallyMoveConstructible<K> && TriviallyMoveConstructible<V>
+    = default;
+    constexpr FixedBTree& operator=(const FixedBTree& other)
+        requires TriviallyCopyAssignable<K> && TriviallyCopyAssignable<V>
+    = default;
+    constexpr FixedBTree& operator=(FixedBTree&& other) noexcept
+        requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
+    = default;
+
+    constexpr FixedBTree(const FixedBTree& other)
+      : FixedBTree(other.comparator())
+    {
+        copy_entries_from(other);
+    }
+    constexpr FixedBTree(FixedBTree&& other) noexcept
+      : FixedBTree(other.comparator())
+    {
+        move_entries_from(other);
+        // Clear the moved-out-of-map. This is consistent with both std::map
+        // as well as the trivial move constructor of this class.
+        other.clear();
+    }
+    constexpr FixedBTree& operator=(const FixedBTree& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        copy_entries_from(other);
+        return *this;
+    }
+    constexpr FixedBTree& operator=(FixedBTree&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        move_entries_from(other);
+        // The trivial assignment operator does not `other.clear()`, so don't do it here either for
+        // consistency across FixedMaps. std::map<T> does clear it, so behavior is different.
+        // Both choices are fine, because the state of a moved object is intentionally unspecified
+        // as per the standard and use-after-move is undefined behavior.
+        return *this;
+    }
+
+    constexpr ~FixedBTree() noexcept { this->clear(); }
+
+private:
+    // The source is already sorted and unique, so copies are built bottom-up in linear time
+    constexpr void copy_entries_from(const FixedBTree& other)
+    {
+        BTreePosition from = other.begin_position();
+        this->build_from_sorted_unique(other.size(),
+                                       [&](typename Base::LeafNode& leaf)
+                                       {
+                                           if constexpr (Base::HAS_ASSOCIATED_VALUE)
+                                           {
+                                               leaf.emplace_back(other.key_at(from),
+                                                                 other.value_at(from));
+                                           }
+                                           else
+                                           {
+                                               leaf.emplace_back(other.key_at(from));
+                                           }
+                                           other.advance(from);
+                                       });
+    }
+    constexpr void move_entries_from(FixedBTree& other)
+    {
+        BTreePosition from = other.begin_position();
+        this->build_from_sorted_unique(
+            other.size(),
+            [&](typename Base::LeafNode& leaf)
+            {
+                auto& other_leaf = other.leaf_at(from.leaf);
+                if constexpr (Base::HAS_ASSOCIATED_VALUE)
+                {
+                    leaf.emplace_back(std::move(other_leaf.keys()[from.slot]),
+                                      std::move(other_leaf.values()[from.slot]));
+                }
+                else
+                {
+                    leaf.emplace_back(std::move(other_leaf.keys()[from.slot]));
+                }
+                other.advance(from);
+            });
+    }
+};
+
+template <TriviallyCopyable K, TriviallyCopyable V, std::size_t MAXIMUM_SIZE, class Compare>
+class FixedBTree<K, V, MAXIMUM_SIZE, Compare>
+  : public fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare>
+{
+    using Base = fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare>;
+
+public:
+    // clang-format off
+    constexpr FixedBTree() noexcept : Base() { }
+    explicit constexpr FixedBTree(const Compare& comparator) noexcept : Base(comparator) { }
+    // clang-format on
+};
+
+}  // namespace fixed_containers::fixed_btree_detail::specializations
+
+namespace fixed_containers::fixed_btree_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare = std::less<K>>
+using FixedBTree = fixed_btree_detail::specializations::FixedBTree<K, V, MAXIMUM_SIZE, Compare>;
+
+template <class K, std::size_t MAXIMUM_SIZE, class Compare = std::less<K>>
+using FixedBTreeSet = FixedBTree<K, EmptyValue, MAXIMUM_SIZE, Compare>;
+}  // namespace fixed_containers::fixed_btree_detail
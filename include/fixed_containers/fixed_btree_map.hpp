@@ -0,0 +1,770 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_btree.hpp"
+#include "fixed_containers/pair_view.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace fixed_containers::fixed_btree_map_customize
+{
+template <class T, class K>
+concept FixedBTreeMapChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::out_of_range(key, size, loc);  // ~ std::out_of_range
+        T::length_error(size, loc);       // ~ std::length_error
+    };
+
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+    static constexpr auto VALUE_TYPE_NAME = fixed_containers::type_name<V>();
+
+    [[noreturn]] static constexpr void out_of_range(const K& /*key*/,
+                                                    const std::size_t /*size*/,
+                                                    const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::fixed_btree_map_customize
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity B+tree map with maximum size that is declared at compile-time via template
+ * parameter. Nodes hold as many keys as fit in a couple of cache lines, so a lookup visits a
+ * handful of nodes instead of the ~log2(n) nodes of FixedMap's red-black tree, and the entries
+ * live in leaves that are linked in key order, so range iteration is mostly sequential. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * Keys and values are kept in separate arrays in each leaf, so iterators dereference to a
+ * `PairView`: use `it->first()`/`it->second()` or structured bindings. K must be copyable, as
+ * internal nodes hold copies of keys.
+ *
+ * Unlike FixedMap, insertion and removal move entries within and between leaves, so they
+ * invalidate all iterators. Hints are accepted for compatibility and ignored: modifications need
+ * the path from the root anyway.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_btree_map_customize::FixedBTreeMapChecking<K> CheckingType =
+              fixed_btree_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedBTreeMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = PairView<const K, V>;
+    using const_reference = PairView<const K, const V>;
+    using key_compare = Compare;
+
+private:
+    using Tree = fixed_btree_detail::FixedBTree<K, V, MAXIMUM_SIZE, Compare>;
+    using Position = fixed_btree_detail::BTreePosition;
+
+    template <bool IS_CONST>
+    struct PairProvider
+    {
+        using ConstOrMutableTree = std::conditional_t<IS_CONST, const Tree, Tree>;
+
+        ConstOrMutableTree* tree_;
+        Position position_;
+
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, Tree::end_position()}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableTree* const tree, const Position& position) noexcept
+          : tree_{tree}
+          , position_{position}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.tree_, m.position_}
+        {
+        }
+
+        constexpr void advance() noexcept { tree_->advance(position_); }
+        constexpr void recede() noexcept { tree_->recede(position_); }
+
+        constexpr const_reference get() const noexcept
+            requires IS_CONST
+        {
+            return {&tree_->key_at(position_), &tree_->value_at(position_)};
+        }
+        constexpr reference get() const noexcept
+            requires(not IS_CONST)
+        {
+            return {&tree_->key_at(position_), &tree_->value_at(position_)};
+        }
+
+        constexpr bool operator==(const PairProvider& other) const noexcept
+        {
+            return tree_ == other.tree_ && position_ == other.position_;
+        }
+        constexpr bool operator==(const PairProvider<!IS_CONST>& other) const noexcept
+        {
+            return tree_ == other.tree_ && position_ == other.position_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        BidirectionalIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using pointer = typename iterator::pointer;
+    using const_pointer = typename const_iterator::pointer;
+    using size_type = typename Tree::size_type;
+    using difference_type = typename Tree::difference_type;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Tree IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+
+public:
+    constexpr FixedBTreeMap() noexcept
+      : FixedBTreeMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeMap(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedBTreeMap(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeMap{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedBTreeMap(std::initializer_list<value_type> list,
+                            const Compare& comparator = {},
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current()) noexcept
+      : FixedBTreeMap{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`, in linear time.
+     * See `insert_sorted()`.
+     */
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedBTreeMap from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        FixedBTreeMap out{comparator};
+        out.insert_sorted(first, last, loc);
+        return out;
+    }
+    [[nodiscard]] static constexpr FixedBTreeMap from_sorted_unique(
+        std::initializer_list<value_type> list,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return from_sorted_unique(list.begin(), list.end(), comparator, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const Position position = tree().find_position(key);
+        if (preconditions::test(position != Tree::end_position()))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return tree().value_at(position);
+    }
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const Position position = tree().find_position(key);
+        if (preconditions::test(position != Tree::end_position()))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return tree().value_at(position);
+    }
+
+    constexpr V& operator[](const K& key) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return tree().value_at(
+            try_emplace_impl(std_transition::source_location::current(), key).first);
+    }
+    constexpr V& operator[](K&& key) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return tree().value_at(
+            try_emplace_impl(std_transition::source_location::current(), std::move(key)).first);
+    }
+
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree().begin_position());
+    }
+    constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(Tree::end_position());
+    }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(tree().begin_position()); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(Tree::end_position()); }
+
+    constexpr reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{&tree(), Tree::end_position()}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{&tree(), Tree::end_position()}};
+    }
+    constexpr reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{&tree(), tree().begin_position()}};
+    }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{&tree(), tree().begin_position()}};
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
+
+    /**
+     * Number of nodes visited by a lookup: the internal levels plus the leaf level. 0 when empty.
+     */
+    [[nodiscard]] constexpr std::size_t depth() const noexcept { return tree().depth(); }
+
+    constexpr void clear() noexcept { tree().clear(); }
+
+    constexpr std::pair<iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return to_iterator_pair(try_emplace_impl(loc, value.first, value.second));
+    }
+    constexpr std::pair<iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return to_iterator_pair(try_emplace_impl(loc, value.first, std::move(value.second)));
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    /**
+     * Insert entries that are sorted and unique according to the comparator. If the container is
+     * empty and the range is forward-iterable, the tree is built bottom-up in linear time, with
+     * leaves that are as full as possible. Otherwise, this is equivalent to `insert(first, last)`.
+     * Passing entries that are not sorted and unique is undefined behavior when the fast path is
+     * taken.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert_sorted(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            if (empty())
+            {
+                const auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (preconditions::test(count <= MAXIMUM_SIZE))
+                {
+                    CheckingType::length_error(count, loc);
+                }
+                tree().build_from_sorted_unique(count,
+                                                [&](typename Tree::LeafNode& leaf)
+                                                {
+                                                    const value_type& value = *first;
+                                                    leaf.emplace_back(value.first, value.second);
+                                                    std::advance(first, 1);
+                                                });
+                return;
+            }
+        }
+
+        this->insert(first, last, loc);
+    }
+    constexpr void insert_sorted(std::initializer_list<value_type> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        this->insert_sorted(list.begin(), list.end(), loc);
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        const K& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return to_iterator_pair(insert_or_assign_impl(loc, key, std::forward<M>(obj)));
+    }
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        K&& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return to_iterator_pair(insert_or_assign_impl(loc, std::move(key), std::forward<M>(obj)));
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        const K& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        K&& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(std::move(key), std::forward<M>(obj), loc).first;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
+    {
+        return to_iterator_pair(try_emplace_impl(
+            std_transition::source_location::current(), key, std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) noexcept
+    {
+        return to_iterator_pair(try_emplace_impl(std_transition::source_location::current(),
+                                                 std::move(key),
+                                                 std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    const K& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    K&& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
+    {
+        std::pair<K, V> as_pair{std::forward<Args>(args)...};
+        return try_emplace(std::move(as_pair.first), std::move(as_pair.second));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator hint,
+                                                     Args&&... args) noexcept
+    {
+        std::pair<K, V> as_pair{std::forward<Args>(args)...};
+        return try_emplace(hint, std::move(as_pair.first), std::move(as_pair.second));
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        return create_iterator(tree().erase_at(position_of(pos)));
+    }
+    constexpr iterator erase(iterator pos) noexcept
+    {
+        assert(pos != end());
+        return erase(const_iterator{pos});
+    }
+
+    // Entries move between leaves as they are removed, so count them first
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        auto count = std::distance(first, last);
+        Position position = position_of(first);
+        for (; count > 0; count--)
+        {
+            position = tree().erase_at(position);
+        }
+        return create_iterator(position);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const Position position = tree().find_position(key);
+        if (position == Tree::end_position())
+        {
+            return 0;
+        }
+        tree().erase_at(position);
+        return 1;
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(tree().find_position(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().find_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator find(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().find_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().find_position(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return tree().find_position(key) != Tree::end_position();
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return tree().find_position(key) != Tree::end_position();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr iterator lower_bound(const K& key) noexcept
+    {
+        return create_iterator(tree().lower_bound_position(key));
+    }
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().lower_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator lower_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().lower_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().lower_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr iterator upper_bound(const K& key) noexcept
+    {
+        return create_iterator(tree().upper_bound_position(key));
+    }
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().upper_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator upper_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().upper_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().upper_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        const auto [first, last] = equal_range_positions(key);
+        return {create_iterator(first), create_iterator(last)};
+    }
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const auto [first, last] = equal_range_positions(key);
+        return {create_const_iterator(first), create_const_iterator(last)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        const auto [first, last] = equal_range_positions(key);
+        return {create_iterator(first), create_iterator(last)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        const auto [first, last] = equal_range_positions(key);
+        return {create_const_iterator(first), create_const_iterator(last)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_btree_map_customize::FixedBTreeMapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedBTreeMap<K, V, MAXIMUM_SIZE_2, Compare2, CheckingType2>& other) const
+    {
+        if (this->size() != other.size())
+        {
+            return false;
+        }
+
+        auto it = other.cbegin();
+        for (auto&& [key, value] : *this)
+        {
+            if (key != it->first() || value != it->second())
+            {
+                return false;
+            }
+            std::advance(it, 1);
+        }
+        return true;
+    }
+
+private:
+    constexpr const Tree& tree() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+    constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+
+    template <class KeyType, class... Args>
+    constexpr std::pair<Position, bool> try_emplace_impl(
+        const std_transition::source_location& loc, KeyType&& key, Args&&... args)
+    {
+        auto point = tree().locate(key);
+        if (point.is_present)
+        {
+            return {Position{point.leaf, point.slot}, false};
+        }
+
+        check_not_full(loc);
+        return {tree().emplace_at(point, std::forward<KeyType>(key), std::forward<Args>(args)...),
+                true};
+    }
+
+    template <class KeyType, class M>
+    constexpr std::pair<Position, bool> insert_or_assign_impl(
+        const std_transition::source_location& loc, KeyType&& key, M&& obj)
+    {
+        auto point = tree().locate(key);
+        if (point.is_present)
+        {
+            const Position position{point.leaf, point.slot};
+            tree().value_at(position) = std::forward<M>(obj);
+            return {position, false};
+        }
+
+        check_not_full(loc);
+        return {tree().emplace_at(point, std::forward<KeyType>(key), std::forward<M>(obj)), true};
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<Position, Position> equal_range_positions(
+        const K0& key) const noexcept
+    {
+        const Position first = tree().lower_bound_position(key);
+        if (first == Tree::end_position() || tree().comparator()(key, tree().key_at(first)))
+        {
+            return {first, first};
+        }
+        Position last = first;
+        tree().advance(last);
+        return {first, last};
+    }
+
+    constexpr std::pair<iterator, bool> to_iterator_pair(
+        const std::pair<Position, bool>& position_and_was_inserted)
+    {
+        return {create_iterator(position_and_was_inserted.first), position_and_was_inserted.second};
+    }
+
+    static constexpr Position position_of(const const_iterator& it) noexcept
+    {
+        return it.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().position_;
+    }
+
+    constexpr iterator create_iterator(const Position& position) noexcept
+    {
+        return iterator{PairProvider<false>{&tree(), position}};
+    }
+    constexpr const_iterator create_const_iterator(const Position& position) const noexcept
+    {
+        return const_iterator{PairProvider<true>{&tree(), position}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_btree_map_customize::FixedBTreeMapChecking<K> CheckingType>
+constexpr typename FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>::size_type is_full(
+    const FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_btree_map_customize::FixedBTreeMapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>::size_type erase_if(
+    FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>& c, Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(c, predicate);
+}
+
+/**
+ * Construct a FixedBTreeMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          fixed_btree_map_customize::FixedBTreeMapChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedBTreeMapType = FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedBTreeMapType make_fixed_btree_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    FixedBTreeMapType map{comparator};
+    map.insert(std::begin(list), std::end(list), loc);
+    return map;
+}
+
+template <typename K, typename V, typename Compare = std::less<K>, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_btree_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = fixed_btree_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedBTreeMapType = FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>;
+    return make_fixed_btree_map<K, V, Compare, CheckingType, MAXIMUM_SIZE, FixedBTreeMapType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
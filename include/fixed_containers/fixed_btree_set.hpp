@@ -0,0 +1,512 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_btree.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace fixed_containers::fixed_btree_set_customize
+{
+template <class T, class K>
+concept FixedBTreeSetChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::length_error(size, loc);  // ~ std::length_error
+    };
+
+template <class K, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::fixed_btree_set_customize
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity B+tree set with maximum size that is declared at compile-time via template
+ * parameter. See FixedBTreeMap for the layout and the trade-offs against FixedSet. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * Insertion and removal invalidate all iterators. Hints are accepted and ignored.
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_btree_set_customize::FixedBTreeSetChecking<K> CheckingType =
+              fixed_btree_set_customize::AbortChecking<K, MAXIMUM_SIZE>>
+class FixedBTreeSet
+{
+public:
+    using key_type = K;
+    using value_type = K;
+    using const_reference = const value_type&;
+    using reference = const_reference;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using pointer = const_pointer;
+
+private:
+    using Tree = fixed_btree_detail::FixedBTreeSet<K, MAXIMUM_SIZE, Compare>;
+    using Position = fixed_btree_detail::BTreePosition;
+
+    struct ReferenceProvider
+    {
+        const Tree* tree_{nullptr};
+        Position position_{Tree::end_position()};
+
+        constexpr void advance() noexcept { tree_->advance(position_); }
+        constexpr void recede() noexcept { tree_->recede(position_); }
+
+        constexpr const_reference get() const noexcept { return tree_->key_at(position_); }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept
+        {
+            return tree_ == other.tree_ && position_ == other.position_;
+        }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = typename Tree::size_type;
+    using difference_type = typename Tree::difference_type;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Tree IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+
+public:
+    constexpr FixedBTreeSet() noexcept
+      : FixedBTreeSet{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeSet(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedBTreeSet(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeSet{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedBTreeSet(std::initializer_list<value_type> list,
+                            const Compare& comparator = {},
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current()) noexcept
+      : FixedBTreeSet{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`, in linear time.
+     * See `insert_sorted()`.
+     */
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedBTreeSet from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        FixedBTreeSet out{comparator};
+        out.insert_sorted(first, last, loc);
+        return out;
+    }
+    [[nodiscard]] static constexpr FixedBTreeSet from_sorted_unique(
+        std::initializer_list<value_type> list,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return from_sorted_unique(list.begin(), list.end(), comparator, loc);
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree().begin_position());
+    }
+    constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(Tree::end_position());
+    }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{&tree(), Tree::end_position()}};
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{&tree(), tree().begin_position()}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
+
+    /**
+     * Number of nodes visited by a lookup: the internal levels plus the leaf level. 0 when empty.
+     */
+    [[nodiscard]] constexpr std::size_t depth() const noexcept { return tree().depth(); }
+
+    constexpr void clear() noexcept { tree().clear(); }
+
+    constexpr std::pair<const_iterator, bool> insert(
+        const K& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, value);
+    }
+    constexpr std::pair<const_iterator, bool> insert(
+        K&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, std::move(value));
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    const K& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, key).first;
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    K&& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, std::move(key)).first;
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    /**
+     * Insert entries that are sorted and unique according to the comparator. If the container is
+     * empty and the range is forward-iterable, the tree is built bottom-up in linear time, with
+     * leaves that are as full as possible. Otherwise, this is equivalent to `insert(first, last)`.
+     * Passing entries that are not sorted and unique is undefined behavior when the fast path is
+     * taken.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert_sorted(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            if (empty())
+            {
+                const auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (preconditions::test(count <= MAXIMUM_SIZE))
+                {
+                    CheckingType::length_error(count, loc);
+                }
+                tree().build_from_sorted_unique(count,
+                                                [&](typename Tree::LeafNode& leaf)
+                                                {
+                                                    leaf.emplace_back(*first);
+                                                    std::advance(first, 1);
+                                                });
+                return;
+            }
+        }
+
+        this->insert(first, last, loc);
+    }
+    constexpr void insert_sorted(std::initializer_list<value_type> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        this->insert_sorted(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr std::pair<const_iterator, bool> emplace(Args&&... args) noexcept
+    {
+        return insert(K(std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr const_iterator emplace_hint(const_iterator hint, Args&&... args) noexcept
+    {
+        return insert(hint, K(std::forward<Args>(args)...));
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        return create_const_iterator(tree().erase_at(position_of(pos)));
+    }
+
+    // Entries move between leaves as they are removed, so count them first
+    constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        auto count = std::distance(first, last);
+        Position position = position_of(first);
+        for (; count > 0; count--)
+        {
+            position = tree().erase_at(position);
+        }
+        return create_const_iterator(position);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const Position position = tree().find_position(key);
+        if (position == Tree::end_position())
+        {
+            return 0;
+        }
+        tree().erase_at(position);
+        return 1;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().find_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().find_position(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return tree().find_position(key) != Tree::end_position();
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return tree().find_position(key) != Tree::end_position();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().lower_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().lower_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().upper_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().upper_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        return equal_range_impl(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return equal_range_impl(key);
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_btree_set_customize::FixedBTreeSetChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedBTreeSet<K, MAXIMUM_SIZE_2, Compare2, CheckingType2>& other) const
+    {
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr const Tree& tree() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+    constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+
+    template <class KeyType>
+    constexpr std::pair<const_iterator, bool> insert_impl(
+        const std_transition::source_location& loc, KeyType&& key)
+    {
+        auto point = tree().locate(key);
+        if (point.is_present)
+        {
+            return {create_const_iterator({point.leaf, point.slot}), false};
+        }
+
+        check_not_full(loc);
+        return {create_const_iterator(tree().emplace_at(point, std::forward<KeyType>(key))), true};
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range_impl(
+        const K0& key) const noexcept
+    {
+        const Position first = tree().lower_bound_position(key);
+        if (first == Tree::end_position() || tree().comparator()(key, tree().key_at(first)))
+        {
+            return {create_const_iterator(first), create_const_iterator(first)};
+        }
+        Position last = first;
+        tree().advance(last);
+        return {create_const_iterator(first), create_const_iterator(last)};
+    }
+
+    static constexpr Position position_of(const const_iterator& it) noexcept
+    {
+        return it.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().position_;
+    }
+
+    constexpr const_iterator create_const_iterator(const Position& position) const noexcept
+    {
+        return const_iterator{ReferenceProvider{&tree(), position}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_btree_set_customize::FixedBTreeSetChecking<K> CheckingType>
+constexpr typename FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>::size_type is_full(
+    const FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_btree_set_customize::FixedBTreeSetChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>::size_type erase_if(
+    FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>& c, Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(c, predicate);
+}
+
+/**
+ * Construct a FixedBTreeSet with its capacity being deduced from the number of items being passed.
+ */
+template <typename K,
+          typename Compare = std::less<K>,
+          fixed_btree_set_customize::FixedBTreeSetChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedBTreeSetType = FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedBTreeSetType make_fixed_btree_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    FixedBTreeSetType set{comparator};
+    for (const auto& item : list)
+    {
+        set.insert(item, loc);
+    }
+    return set;
+}
+
+template <typename K, typename Compare = std::less<K>, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_btree_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = fixed_btree_set_customize::AbortChecking<K, MAXIMUM_SIZE>;
+    using FixedBTreeSetType = FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>;
+    return make_fixed_btree_set<K, Compare, CheckingType, MAXIMUM_SIZE, FixedBTreeSetType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
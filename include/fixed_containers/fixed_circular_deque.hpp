@@ -0,0 +1,850 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/optional_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator_transformer.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_literal.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_circular_deque_customize
+{
+template <class T>
+concept FixedCircularDequeChecking = requires(std::size_t i,
+                                              std::size_t s,
+                                              const StringLiteral& error_message,
+                                              const std_transition::source_location& loc) {
+    T::out_of_range(i, s, loc);  // ~ std::out_of_range
+    T::length_error(s, loc);     // ~ std::length_error
+    T::empty_container_access(loc);
+    T::invalid_argument(error_message, loc);  // ~ std::invalid_argument
+};
+
+template <typename T, std::size_t /*MAXIMUM_SIZE*/>
+struct AbortChecking
+{
+    static constexpr auto TYPE_NAME = fixed_containers::type_name<T>();
+
+    [[noreturn]] static constexpr void out_of_range(const std::size_t /*index*/,
+                                                    const std::size_t /*size*/,
+                                                    const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static constexpr void empty_container_access(
+        const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static constexpr void invalid_argument(
+        const fixed_containers::StringLiteral& /*error_message*/,
+        const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+}  // namespace fixed_containers::fixed_circular_deque_customize
+
+namespace fixed_containers::fixed_circular_deque_detail
+{
+/**
+ * Random-access iterator over the logical positions of a ring buffer. Dereferencing yields the
+ * position itself; the container's mapper turns it into the element stored for that position.
+ * Used instead of std::ranges::iota_view, whose difference_type can be wider than std::ptrdiff_t.
+ */
+class PositionIterator
+{
+public:
+    using value_type = std::size_t;
+    using reference = std::size_t;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+private:
+    std::size_t position_;
+
+public:
+    constexpr PositionIterator() noexcept
+      : position_{0}
+    {
+    }
+
+    explicit constexpr PositionIterator(const std::size_t position) noexcept
+      : position_{position}
+    {
+    }
+
+    constexpr reference operator*() const noexcept { return position_; }
+    constexpr reference operator[](const difference_type off) const noexcept
+    {
+        return position_ + static_cast<std::size_t>(off);
+    }
+
+    constexpr PositionIterator& operator++() noexcept
+    {
+        ++position_;
+        return *this;
+    }
+    constexpr PositionIterator operator++(int) & noexcept
+    {
+        PositionIterator tmp = *this;
+        ++position_;
+        return tmp;
+    }
+    constexpr PositionIterator& operator--() noexcept
+    {
+        --position_;
+        return *this;
+    }
+    constexpr PositionIterator operator--(int) & noexcept
+    {
+        PositionIterator tmp = *this;
+        --position_;
+        return tmp;
+    }
+
+    constexpr PositionIterator& operator+=(const difference_type off) noexcept
+    {
+        position_ += static_cast<std::size_t>(off);
+        return *this;
+    }
+    constexpr PositionIterator& operator-=(const difference_type off) noexcept
+    {
+        position_ -= static_cast<std::size_t>(off);
+        return *this;
+    }
+    constexpr PositionIterator operator+(const difference_type off) const noexcept
+    {
+        return PositionIterator{position_ + static_cast<std::size_t>(off)};
+    }
+    friend constexpr PositionIterator operator+(const difference_type off,
+                                                const PositionIterator& other) noexcept
+    {
+        return other + off;
+    }
+    constexpr PositionIterator operator-(const difference_type off) const noexcept
+    {
+        return PositionIterator{position_ - static_cast<std::size_t>(off)};
+    }
+    constexpr difference_type operator-(const PositionIterator& other) const noexcept
+    {
+        return static_cast<difference_type>(position_ - other.position_);
+    }
+
+    constexpr std::strong_ordering operator<=>(const PositionIterator& other) const noexcept
+    {
+        return position_ <=> other.position_;
+    }
+    constexpr bool operator==(const PositionIterator& other) const noexcept
+    {
+        return position_ == other.position_;
+    }
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_circular_deque_customize::FixedCircularDequeChecking CheckingType>
+class FixedCircularDequeBase
+{
+    using OptionalT = optional_storage_detail::OptionalStorage<T>;
+    static_assert(consteval_compare::equal<sizeof(OptionalT), sizeof(T)>);
+    // std::deque has the following restrictions too
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "Deque must have a non-const, non-volatile value_type");
+    using Checking = CheckingType;
+
+    // With a power-of-two capacity, wrapping around the end of the storage is a single mask.
+    static constexpr bool WRAPS_WITH_MASK = std::has_single_bit(MAXIMUM_SIZE);
+
+    struct ConstMapper
+    {
+        const FixedCircularDequeBase* self_;
+
+        constexpr const T& operator()(const std::size_t position) const noexcept
+        {
+            return self_->unchecked_at(position);
+        }
+    };
+    struct MutableMapper
+    {
+        FixedCircularDequeBase* self_;
+
+        constexpr T& operator()(const std::size_t position) const noexcept
+        {
+            return self_->unchecked_at(position);
+        }
+        constexpr operator ConstMapper() const noexcept { return ConstMapper{self_}; }
+    };
+
+    template <IteratorConstness CONSTNESS>
+    using IteratorImpl = RandomAccessIteratorTransformer<PositionIterator,
+                                                         PositionIterator,
+                                                         ConstMapper,
+                                                         MutableMapper,
+                                                         CONSTNESS>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using const_iterator = IteratorImpl<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = IteratorImpl<IteratorConstness::MUTABLE_ITERATOR>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    static constexpr void check_target_size(size_type target_size,
+                                            const std_transition::source_location& loc)
+    {
+        if (preconditions::test(target_size <= MAXIMUM_SIZE))
+        {
+            Checking::length_error(target_size, loc);
+        }
+    }
+
+    // Maps an index in [0, 2 * MAXIMUM_SIZE) back into the storage. Every caller stays within
+    // that range, so the general case needs a single conditional subtraction instead of a modulo.
+    static constexpr std::size_t wrap(const std::size_t i) noexcept
+    {
+        if constexpr (WRAPS_WITH_MASK)
+        {
+            return i & (MAXIMUM_SIZE - 1);
+        }
+        else
+        {
+            return i < MAXIMUM_SIZE ? i : i - MAXIMUM_SIZE;
+        }
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_start_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    std::array<OptionalT, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+    static constexpr std::size_t capacity() noexcept { return max_size(); }
+
+    constexpr FixedCircularDequeBase() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_start_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+    // Don't initialize the array
+    {
+    }
+
+    constexpr FixedCircularDequeBase(std::size_t count,
+                                     const T& value,
+                                     const std_transition::source_location& loc =
+                                         std_transition::source_location::current()) noexcept
+      : FixedCircularDequeBase()
+    {
+        check_target_size(count, loc);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            push_back_internal(value);
+        }
+    }
+
+    constexpr FixedCircularDequeBase(std::initializer_list<T> list,
+                                     const std_transition::source_location& loc =
+                                         std_transition::source_location::current()) noexcept
+      : FixedCircularDequeBase(list.begin(), list.end(), loc)
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedCircularDequeBase(InputIt first,
+                                     InputIt last,
+                                     const std_transition::source_location& loc =
+                                         std_transition::source_location::current()) noexcept
+      : FixedCircularDequeBase()
+    {
+        for (; first != last; ++first)
+        {
+            check_not_full(loc);
+            push_back_internal(*first);
+        }
+    }
+
+    /**
+     * Appends the given element value to the end of the container.
+     * Calling push_back on a full container is undefined.
+     */
+    constexpr void push_back(
+        const value_type& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        this->push_back_internal(v);
+    }
+    constexpr void push_back(
+        value_type&& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        this->push_back_internal(std::move(v));
+    }
+    /**
+     * Emplace the given element at the end of the container.
+     * Calling emplace_back on a full container is undefined.
+     */
+    template <class... Args>
+    constexpr reference emplace_back(Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        emplace_at_physical(physical_index_of(size()), std::forward<Args>(args)...);
+        increment_size();
+        return this->back();
+    }
+
+    /**
+     * Prepends the given element value to the beginning of the container, without moving any of
+     * the existing elements.
+     * Calling push_front on a full container is undefined.
+     */
+    constexpr void push_front(
+        const value_type& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        this->push_front_internal(v);
+    }
+    constexpr void push_front(
+        value_type&& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        this->push_front_internal(std::move(v));
+    }
+    /**
+     * Emplace the given element at the beginning of the container.
+     * Calling emplace_front on a full container is undefined.
+     */
+    template <class... Args>
+    constexpr reference emplace_front(Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        const std::size_t new_start = wrap(start() + MAXIMUM_SIZE - 1);
+        emplace_at_physical(new_start, std::forward<Args>(args)...);
+        set_start(new_start);
+        increment_size();
+        return this->front();
+    }
+
+    /**
+     * Removes the last element of the container.
+     * Calling pop_back on an empty container is undefined.
+     */
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        destroy_at_physical(physical_index_of(size() - 1));
+        decrement_size();
+    }
+
+    /**
+     * Removes the first element of the container, without moving any of the remaining elements.
+     * Calling pop_front on an empty container is undefined.
+     */
+    constexpr void pop_front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        destroy_at_physical(start());
+        set_start(wrap(start() + 1));
+        decrement_size();
+    }
+
+    /**
+     * Erases all elements from the container. After this call, size() returns zero.
+     */
+    constexpr FixedCircularDequeBase& clear() noexcept
+    {
+        destroy_all();
+        set_start(0);
+        set_size(0);
+        return *this;
+    }
+
+    /**
+     * Regular accessors.
+     */
+    constexpr reference operator[](size_type i) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        // This operator should not range-check according to the spec, but we want the extra safety.
+        return at(i, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type i) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        // This operator should not range-check according to the spec, but we want the extra safety.
+        return at(i, std_transition::source_location::current());
+    }
+
+    constexpr reference at(size_type i,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(i < size()))
+        {
+            Checking::out_of_range(i, size(), loc);
+        }
+        return unchecked_at(i);
+    }
+    constexpr const_reference at(size_type i,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const noexcept
+    {
+        if (preconditions::test(i < size()))
+        {
+            Checking::out_of_range(i, size(), loc);
+        }
+        return unchecked_at(i);
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return unchecked_at(0);
+    }
+    constexpr const_reference front(const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return unchecked_at(0);
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return unchecked_at(size() - 1);
+    }
+    constexpr const_reference back(const std_transition::source_location& loc =
+                                       std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return unchecked_at(size() - 1);
+    }
+
+    /**
+     * Iterators
+     */
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(size()); }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(cend());
+    }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /**
+     * Size
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * Equality.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_circular_deque_customize::FixedCircularDequeChecking CheckingType2>
+    constexpr bool operator==(
+        const FixedCircularDequeBase<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        return std::equal(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_circular_deque_customize::FixedCircularDequeChecking CheckingType2>
+    constexpr auto operator<=>(
+        const FixedCircularDequeBase<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        using OrderingType = decltype(std::declval<T>() <=> std::declval<T>());
+        const std::size_t min_size = (std::min)(this->size(), other.size());
+        for (std::size_t i = 0; i < min_size; i++)
+        {
+            if (unchecked_at(i) < other.at(i))
+            {
+                return OrderingType::less;
+            }
+            if (unchecked_at(i) > other.at(i))
+            {
+                return OrderingType::greater;
+            }
+        }
+
+        return this->size() <=> other.size();
+    }
+
+private:
+    constexpr iterator create_iterator(const std::size_t position) noexcept
+    {
+        return iterator{PositionIterator{position}, MutableMapper{this}};
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t position) const noexcept
+    {
+        return const_iterator{PositionIterator{position}, ConstMapper{this}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+
+    // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of FixedCircularDeque
+protected:
+    [[nodiscard]] constexpr std::size_t start() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_start_;
+    }
+    constexpr void set_start(const std::size_t start)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_start_ = start;
+    }
+    constexpr void increment_size(const std::size_t n = 1)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
+    }
+    constexpr void decrement_size(const std::size_t n = 1)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
+    }
+    constexpr void set_size(const std::size_t size)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+    }
+
+    // Storage index of the element at the given logical position
+    [[nodiscard]] constexpr std::size_t physical_index_of(const std::size_t position) const
+    {
+        return wrap(start() + position);
+    }
+
+    constexpr const T& unchecked_at(const std::size_t position) const
+    {
+        return optional_storage_detail::get(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[physical_index_of(position)]);
+    }
+    constexpr T& unchecked_at(const std::size_t position)
+    {
+        return optional_storage_detail::get(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[physical_index_of(position)]);
+    }
+
+    constexpr void destroy_at_physical(std::size_t)
+        requires TriviallyDestructible<T>
+    {
+    }
+    constexpr void destroy_at_physical(std::size_t i)
+        requires NotTriviallyDestructible<T>
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[i].value.~T();
+    }
+
+    constexpr void destroy_all()
+        requires TriviallyDestructible<T>
+    {
+    }
+    constexpr void destroy_all()
+        requires NotTriviallyDestructible<T>
+    {
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            destroy_at_physical(physical_index_of(i));
+        }
+    }
+
+    template <class U>
+    constexpr void push_back_internal(U&& v)
+    {
+        emplace_at_physical(physical_index_of(size()), std::forward<U>(v));
+        increment_size();
+    }
+
+    template <class U>
+    constexpr void push_front_internal(U&& v)
+    {
+        const std::size_t new_start = wrap(start() + MAXIMUM_SIZE - 1);
+        emplace_at_physical(new_start, std::forward<U>(v));
+        set_start(new_start);
+        increment_size();
+    }
+
+    template <class... Args>
+    constexpr void emplace_at_physical(const std::size_t i, Args&&... args)
+    {
+        optional_storage_detail::construct_at(&IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[i],
+                                              std::forward<Args>(args)...);
+    }
+};
+
+}  // namespace fixed_containers::fixed_circular_deque_detail
+
+namespace fixed_containers::fixed_circular_deque_detail::specializations
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_circular_deque_customize::FixedCircularDequeChecking CheckingType>
+class FixedCircularDeque
+  : public fixed_circular_deque_detail::FixedCircularDequeBase<T, MAXIMUM_SIZE, CheckingType>
+{
+    using Base = fixed_circular_deque_detail::FixedCircularDequeBase<T, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    constexpr FixedCircularDeque() noexcept
+      : Base()
+    {
+    }
+    constexpr FixedCircularDeque(std::initializer_list<T> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(list, loc)
+    {
+    }
+    constexpr FixedCircularDeque(std::size_t count,
+                                 const T& value,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(count, value, loc)
+    {
+    }
+    template <InputIterator InputIt>
+    constexpr FixedCircularDeque(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(first, last, loc)
+    {
+    }
+
+    constexpr FixedCircularDeque(const FixedCircularDeque& other)
+        requires TriviallyCopyConstructible<T>
+    = default;
+    constexpr FixedCircularDeque(FixedCircularDeque&& other) noexcept
+        requires TriviallyMoveConstructible<T>
+    = default;
+    constexpr FixedCircularDeque& operator=(const FixedCircularDeque& other)
+        requires TriviallyCopyAssignable<T>
+    = default;
+    constexpr FixedCircularDeque& operator=(FixedCircularDeque&& other) noexcept
+        requires TriviallyMoveAssignable<T>
+    = default;
+
+    // The copies are laid out from the start of the storage, regardless of where `other` starts.
+    constexpr FixedCircularDeque(const FixedCircularDeque& other)
+      : FixedCircularDeque()
+    {
+        for (std::size_t i = 0; i < other.size(); i++)
+        {
+            this->push_back_internal(other.unchecked_at(i));
+        }
+    }
+    constexpr FixedCircularDeque(FixedCircularDeque&& other) noexcept
+      : FixedCircularDeque()
+    {
+        for (std::size_t i = 0; i < other.size(); i++)
+        {
+            this->push_back_internal(std::move(other.unchecked_at(i)));
+        }
+        // Clear the moved-out-of-deque. This is consistent with both std::deque
+        // as well as the trivial move constructor of this class.
+        other.clear();
+    }
+    constexpr FixedCircularDeque& operator=(const FixedCircularDeque& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        for (std::size_t i = 0; i < other.size(); i++)
+        {
+            this->push_back_internal(other.unchecked_at(i));
+        }
+        return *this;
+    }
+    constexpr FixedCircularDeque& operator=(FixedCircularDeque&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        for (std::size_t i = 0; i < other.size(); i++)
+        {
+            this->push_back_internal(std::move(other.unchecked_at(i)));
+        }
+        // Same as FixedVector: the trivial assignment operator does not `other.clear()`, so
+        // don't do it here either.
+        return *this;
+    }
+
+    constexpr ~FixedCircularDeque() noexcept { this->clear(); }
+};
+
+template <TriviallyCopyable T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_circular_deque_customize::FixedCircularDequeChecking CheckingType>
+class FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>
+  : public fixed_circular_deque_detail::FixedCircularDequeBase<T, MAXIMUM_SIZE, CheckingType>
+{
+    using Base = fixed_circular_deque_detail::FixedCircularDequeBase<T, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    constexpr FixedCircularDeque() noexcept
+      : Base()
+    {
+    }
+    constexpr FixedCircularDeque(std::initializer_list<T> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(list, loc)
+    {
+    }
+    constexpr FixedCircularDeque(std::size_t count,
+                                 const T& value,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(count, value, loc)
+    {
+    }
+    template <InputIterator InputIt>
+    constexpr FixedCircularDeque(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(first, last, loc)
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_circular_deque_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity double-ended queue backed by a ring buffer, with maximum size that is declared at
+ * compile-time via template parameter. Properties:
+ *  - constexpr
+ *  - retains the properties of T (e.g. if T is trivially copyable, then so is
+ *    FixedCircularDeque<T>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - O(1) push/pop at both ends; existing elements never move
+ *  - a power-of-two MAXIMUM_SIZE wraps indices with a mask
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_circular_deque_customize::FixedCircularDequeChecking CheckingType =
+              fixed_circular_deque_customize::AbortChecking<T, MAXIMUM_SIZE>>
+class FixedCircularDeque
+  : public fixed_circular_deque_detail::specializations::
+        FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>
+{
+    using Base = fixed_circular_deque_detail::specializations::
+        FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>;
+
+public:
+    constexpr FixedCircularDeque() noexcept
+      : Base()
+    {
+    }
+    constexpr FixedCircularDeque(std::initializer_list<T> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(list, loc)
+    {
+    }
+    constexpr FixedCircularDeque(std::size_t count,
+                                 const T& value,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(count, value, loc)
+    {
+    }
+    template <InputIterator InputIt>
+    constexpr FixedCircularDeque(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : Base(first, last, loc)
+    {
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+constexpr typename FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>::size_type is_full(
+    const FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/iterator_utils.hpp"
 #include "fixed_containers/optional_storage.hpp"
@@ -216,19 +217,15 @@ public:
         const std::size_t read_start = this->index_of(last);
         const std::size_t write_start = this->index_of(first);
 
-        std::size_t entry_count_to_move = size() - read_start;
+        const std::size_t entry_count_to_move = size() - read_start;
         const std::size_t entry_count_to_remove = read_start - write_start;
 
         // Clean out the gap
         destroy_index_range(write_start, write_start + entry_count_to_remove);
 
         // Do the move
-        for (std::size_t i = 0; i < entry_count_to_move; ++i)
-        {
-            place_at(write_start + i,
-                     std::move(optional_storage_detail::get(array_unchecked_at(read_start + i))));
-            destroy_at(read_start + i);
-        }
+        optional_storage_detail::relocate_range(
+            array_, read_start, write_start, entry_count_to_move);
 
         decrement_size(entry_count_to_remove);
         return iterator{this->begin() + static_cast<difference_type>(write_start)};
@@ -383,14 +380,8 @@ private:
         const std::size_t write_start = read_start + n;
         const std::size_t value_count_to_move = size() - read_start;
 
-        const std::size_t read_end = read_start + value_count_to_move - 1;
-        const std::size_t write_end = write_start + value_count_to_move - 1;
-
-        for (std::size_t i = 0; i < value_count_to_move; i++)
-        {
-            place_at(write_end - i, std::move(array_[read_end - i].value));
-            destroy_at(read_end - i);
-        }
+        optional_storage_detail::relocate_range(
+            array_, read_start, write_start, value_count_to_move);
 
         increment_size(n);
 
@@ -0,0 +1,905 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/flat_sorted_keys.hpp"
+#include "fixed_containers/pair_view.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace fixed_containers::fixed_flat_map_customize
+{
+template <class T, class K>
+concept FixedFlatMapChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::out_of_range(key, size, loc);  // ~ std::out_of_range
+        T::length_error(size, loc);       // ~ std::length_error
+    };
+
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+    static constexpr auto VALUE_TYPE_NAME = fixed_containers::type_name<V>();
+
+    [[noreturn]] static constexpr void out_of_range(const K& /*key*/,
+                                                    const std::size_t /*size*/,
+                                                    const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::fixed_flat_map_customize
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity sorted-vector map with maximum size that is declared at compile-time via
+ * template parameter. Keys and values are kept in two separate FixedVectors, sorted by key, so a
+ * lookup is a binary search that only touches keys. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * Since there is no `std::pair<const K, V>` in storage, iterators dereference to a `PairView`:
+ * use `it->first()`/`it->second()` or structured bindings.
+ *
+ * Unlike FixedMap, insertion and removal shift the entries after the affected position, so they
+ * are linear and invalidate iterators to those entries. Prefer `insert(first, last)` for bulk
+ * insertion: it sorts the new entries and merges them in once.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_flat_map_customize::FixedFlatMapChecking<K> CheckingType =
+              fixed_flat_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedFlatMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = PairView<const K, V>;
+    using const_reference = PairView<const K, const V>;
+    using key_compare = Compare;
+
+private:
+    using KeyStorage = FixedVector<K, MAXIMUM_SIZE>;
+    using ValueStorage = FixedVector<V, MAXIMUM_SIZE>;
+
+    template <bool IS_CONST>
+    struct PairProvider
+    {
+        using ConstOrMutableMap = std::conditional_t<IS_CONST, const FixedFlatMap, FixedFlatMap>;
+
+        ConstOrMutableMap* map_;
+        // rend() is one before the first entry, i.e. the maximum value after wrapping around
+        std::size_t current_index_;
+
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, 0}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableMap* const map,
+                               const std::size_t current_index) noexcept
+          : map_{map}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.map_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept { current_index_++; }
+        constexpr void recede() noexcept { current_index_--; }
+
+        constexpr const_reference get() const noexcept
+            requires IS_CONST
+        {
+            return {&map_->keys()[current_index_], &map_->values()[current_index_]};
+        }
+        constexpr reference get() const noexcept
+            requires(not IS_CONST)
+        {
+            return {&map_->keys()[current_index_], &map_->mutable_values()[current_index_]};
+        }
+
+        constexpr bool operator==(const PairProvider& other) const noexcept
+        {
+            return map_ == other.map_ && current_index_ == other.current_index_;
+        }
+        constexpr bool operator==(const PairProvider<!IS_CONST>& other) const noexcept
+        {
+            return map_ == other.map_ && current_index_ == other.current_index_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        BidirectionalIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using pointer = typename iterator::pointer;
+    using const_pointer = typename const_iterator::pointer;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    KeyStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    ValueStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedFlatMap() noexcept
+      : FixedFlatMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedFlatMap(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatMap(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatMap{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedFlatMap(std::initializer_list<value_type> list,
+                           const Compare& comparator = {},
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+      : FixedFlatMap{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`, in linear time.
+     * See `insert_sorted()`.
+     */
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedFlatMap from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        FixedFlatMap out{comparator};
+        out.insert_sorted(first, last, loc);
+        return out;
+    }
+    [[nodiscard]] static constexpr FixedFlatMap from_sorted_unique(
+        std::initializer_list<value_type> list,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return from_sorted_unique(list.begin(), list.end(), comparator, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const std::size_t i = index_of_key_or_size(key);
+        if (preconditions::test(i != size()))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return mutable_values()[i];
+    }
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t i = index_of_key_or_size(key);
+        if (preconditions::test(i != size()))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return values()[i];
+    }
+
+    constexpr V& operator[](const K& key) noexcept
+    {
+        const std::size_t i = index_of_lower_bound(key);
+        if (!is_key_at(i, key))
+        {
+            // Cannot capture real source_location for operator[]
+            check_not_full(std_transition::source_location::current());
+            insert_new_at(i, key);
+        }
+        return mutable_values()[i];
+    }
+    constexpr V& operator[](K&& key) noexcept
+    {
+        const std::size_t i = index_of_lower_bound(key);
+        if (!is_key_at(i, key))
+        {
+            // Cannot capture real source_location for operator[]
+            check_not_full(std_transition::source_location::current());
+            insert_new_at(i, std::move(key));
+        }
+        return mutable_values()[i];
+    }
+
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(size()); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{end_provider()}; }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{end_provider()};
+    }
+    constexpr reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{this, 0}};
+    }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{this, 0}};
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    /**
+     * The keys, in sorted order. Entry `i` of `keys()` and of `values()` form one key-value pair.
+     */
+    [[nodiscard]] constexpr const KeyStorage& keys() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    [[nodiscard]] constexpr const ValueStorage& values() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+
+    constexpr void clear() noexcept
+    {
+        mutable_keys().clear();
+        mutable_values().clear();
+    }
+
+    constexpr std::pair<iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return try_emplace_at(index_of_lower_bound(value.first), loc, value.first, value.second);
+    }
+    constexpr std::pair<iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return try_emplace_at(
+            index_of_lower_bound(value.first), loc, value.first, std::move(value.second));
+    }
+
+    /**
+     * Bulk insertion. The entries are appended, sorted among themselves and merged with the
+     * existing ones in one pass: O(n log n + size()) instead of the O(n * size()) of one
+     * `insert()` per entry. As with one `insert()` per entry, an entry whose key is already
+     * present (or appears earlier in the range) is ignored.
+     *
+     * If the appended entries fill the map, they are merged early, which drops the ignored ones,
+     * and the rest of the range is inserted one entry at a time. So only the resulting size is
+     * limited by `MAXIMUM_SIZE`. The merge uses `MAXIMUM_SIZE` indices of scratch space on the
+     * stack.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        const std::size_t sorted_count = size();
+        for (; first != last && size() < MAXIMUM_SIZE; std::advance(first, 1))
+        {
+            const value_type& value = *first;
+            mutable_keys().push_back(value.first);
+            mutable_values().push_back(value.second);
+        }
+        merge_appended_entries(sorted_count);
+
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    /**
+     * Same as `insert(std::ranges::begin(range), std::ranges::end(range))`.
+     */
+    template <std::ranges::input_range Range>
+    constexpr void insert_range(Range&& range,
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+    {
+        this->insert(std::ranges::begin(range), std::ranges::end(range), loc);
+    }
+
+    /**
+     * Insert entries that are sorted and unique according to the comparator. If the container is
+     * empty, the entries are appended as they are, in linear time. Otherwise, this is equivalent
+     * to `insert(first, last)`.
+     * Passing entries that are not sorted and unique is undefined behavior when the fast path is
+     * taken.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert_sorted(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        if (!empty())
+        {
+            this->insert(first, last, loc);
+            return;
+        }
+
+        for (; first != last; std::advance(first, 1))
+        {
+            check_not_full(loc);
+            const value_type& value = *first;
+            mutable_keys().push_back(value.first);
+            mutable_values().push_back(value.second);
+        }
+    }
+    constexpr void insert_sorted(std::initializer_list<value_type> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        this->insert_sorted(list.begin(), list.end(), loc);
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        const K& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_at(index_of_lower_bound(key), loc, key, std::forward<M>(obj));
+    }
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        K&& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_at(
+            index_of_lower_bound(key), loc, std::move(key), std::forward<M>(obj));
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator hint,
+                                        const K& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_at(
+                   index_of_lower_bound_near(hint, key), loc, key, std::forward<M>(obj))
+            .first;
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator hint,
+                                        K&& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_at(
+                   index_of_lower_bound_near(hint, key), loc, std::move(key), std::forward<M>(obj))
+            .first;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
+    {
+        return try_emplace_at(index_of_lower_bound(key),
+                              std_transition::source_location::current(),
+                              key,
+                              std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) noexcept
+    {
+        return try_emplace_at(index_of_lower_bound(key),
+                              std_transition::source_location::current(),
+                              std::move(key),
+                              std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
+                                                    const K& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace_at(index_of_lower_bound_near(hint, key),
+                              std_transition::source_location::current(),
+                              key,
+                              std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
+                                                    K&& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace_at(index_of_lower_bound_near(hint, key),
+                              std_transition::source_location::current(),
+                              std::move(key),
+                              std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
+    {
+        std::pair<K, V> as_pair{std::forward<Args>(args)...};
+        return try_emplace(std::move(as_pair.first), std::move(as_pair.second));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator hint,
+                                                     Args&&... args) noexcept
+    {
+        std::pair<K, V> as_pair{std::forward<Args>(args)...};
+        return try_emplace(hint, std::move(as_pair.first), std::move(as_pair.second));
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        return erase(pos, std::next(pos));
+    }
+    constexpr iterator erase(iterator pos) noexcept
+    {
+        assert(pos != end());
+        return erase(const_iterator{pos});
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const std::size_t from = index_of(first);
+        const std::size_t to = index_of(last);
+        mutable_keys().erase(keys().cbegin() + static_cast<difference_type>(from),
+                             keys().cbegin() + static_cast<difference_type>(to));
+        mutable_values().erase(values().cbegin() + static_cast<difference_type>(from),
+                               values().cbegin() + static_cast<difference_type>(to));
+        return create_iterator(from);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const std::size_t i = index_of_key_or_size(key);
+        if (i == size())
+        {
+            return 0;
+        }
+        erase(create_const_iterator(i));
+        return 1;
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(index_of_key_or_size(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(index_of_key_or_size(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator find(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(index_of_key_or_size(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(index_of_key_or_size(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return index_of_key_or_size(key) != size();
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return index_of_key_or_size(key) != size();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr iterator lower_bound(const K& key) noexcept
+    {
+        return create_iterator(index_of_lower_bound(key));
+    }
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(index_of_lower_bound(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator lower_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(index_of_lower_bound(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(index_of_lower_bound(key));
+    }
+
+    [[nodiscard]] constexpr iterator upper_bound(const K& key) noexcept
+    {
+        return create_iterator(index_of_upper_bound(key));
+    }
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(index_of_upper_bound(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator upper_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(index_of_upper_bound(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(index_of_upper_bound(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        const std::size_t l = index_of_lower_bound(key);
+        return {create_iterator(l), create_iterator(is_key_at(l, key) ? l + 1 : l)};
+    }
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const std::size_t l = index_of_lower_bound(key);
+        return {create_const_iterator(l), create_const_iterator(is_key_at(l, key) ? l + 1 : l)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        const std::size_t l = index_of_lower_bound(key);
+        return {create_iterator(l), create_iterator(is_key_at(l, key) ? l + 1 : l)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        const std::size_t l = index_of_lower_bound(key);
+        return {create_const_iterator(l), create_const_iterator(is_key_at(l, key) ? l + 1 : l)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_flat_map_customize::FixedFlatMapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedFlatMap<K, V, MAXIMUM_SIZE_2, Compare2, CheckingType2>& other) const
+    {
+        return keys() == other.keys() && values() == other.values();
+    }
+
+private:
+    constexpr KeyStorage& mutable_keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    constexpr ValueStorage& mutable_values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    constexpr const Compare& comparator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    // At runtime, search through a plain pointer rather than the (range-checked) vector iterators
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_lower_bound(const K0& key) const noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return flat_sorted_keys_detail::lower_bound_index(
+                keys().cbegin(), size(), key, comparator());
+        }
+        return flat_sorted_keys_detail::lower_bound_index(
+            keys().data(), size(), key, comparator());
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_upper_bound(const K0& key) const noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return flat_sorted_keys_detail::upper_bound_index(
+                keys().cbegin(), size(), key, comparator());
+        }
+        return flat_sorted_keys_detail::upper_bound_index(
+            keys().data(), size(), key, comparator());
+    }
+
+    // The lower bound of `key`, in constant time if `hint` already points to it
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_lower_bound_near(
+        const const_iterator& hint, const K0& key) const noexcept
+    {
+        const std::size_t h = index_of(hint);
+        if ((h == 0 || comparator()(keys()[h - 1], key)) &&
+            (h == size() || !comparator()(keys()[h], key)))
+        {
+            return h;
+        }
+        return index_of_lower_bound(key);
+    }
+
+    // Whether the lower bound `i` of `key` is an exact match
+    template <class K0>
+    [[nodiscard]] constexpr bool is_key_at(const std::size_t i, const K0& key) const noexcept
+    {
+        return i != size() && !comparator()(key, keys()[i]);
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_key_or_size(const K0& key) const noexcept
+    {
+        const std::size_t i = index_of_lower_bound(key);
+        return is_key_at(i, key) ? i : size();
+    }
+
+    template <class KeyType, class... Args>
+    constexpr void insert_new_at(const std::size_t i, KeyType&& key, Args&&... args)
+    {
+        mutable_keys().emplace(keys().cbegin() + static_cast<difference_type>(i),
+                               std::forward<KeyType>(key));
+        mutable_values().emplace(values().cbegin() + static_cast<difference_type>(i),
+                                 std::forward<Args>(args)...);
+    }
+
+    template <class KeyType, class... Args>
+    constexpr std::pair<iterator, bool> try_emplace_at(const std::size_t i,
+                                                       const std_transition::source_location& loc,
+                                                       KeyType&& key,
+                                                       Args&&... args)
+    {
+        if (is_key_at(i, key))
+        {
+            return {create_iterator(i), false};
+        }
+
+        check_not_full(loc);
+        insert_new_at(i, std::forward<KeyType>(key), std::forward<Args>(args)...);
+        return {create_iterator(i), true};
+    }
+
+    template <class KeyType, class M>
+    constexpr std::pair<iterator, bool> insert_or_assign_at(
+        const std::size_t i, const std_transition::source_location& loc, KeyType&& key, M&& obj)
+    {
+        if (is_key_at(i, key))
+        {
+            mutable_values()[i] = std::forward<M>(obj);
+            return {create_iterator(i), false};
+        }
+
+        check_not_full(loc);
+        insert_new_at(i, std::forward<KeyType>(key), std::forward<M>(obj));
+        return {create_iterator(i), true};
+    }
+
+    // Merges the entries from `sorted_count` onwards (in arbitrary order, possibly repeated) into
+    // the sorted entries before them.
+    constexpr void merge_appended_entries(const std::size_t sorted_count)
+    {
+        if (sorted_count == size())
+        {
+            return;
+        }
+
+        flat_sorted_keys_detail::Order<MAXIMUM_SIZE> order{};
+        const std::size_t kept_count = flat_sorted_keys_detail::compute_merge_order<MAXIMUM_SIZE>(
+            keys(), sorted_count, comparator(), order);
+        flat_sorted_keys_detail::apply_order<MAXIMUM_SIZE>(order, size(), mutable_keys());
+        flat_sorted_keys_detail::apply_order<MAXIMUM_SIZE>(order, size(), mutable_values());
+
+        mutable_keys().erase(keys().cbegin() + static_cast<difference_type>(kept_count),
+                             keys().cend());
+        mutable_values().erase(values().cbegin() + static_cast<difference_type>(kept_count),
+                               values().cend());
+    }
+
+    static constexpr std::size_t index_of(const const_iterator& it) noexcept
+    {
+        return it.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().current_index_;
+    }
+
+    constexpr iterator create_iterator(const std::size_t i) noexcept
+    {
+        return iterator{PairProvider<false>{this, i}};
+    }
+    constexpr const_iterator create_const_iterator(const std::size_t i) const noexcept
+    {
+        return const_iterator{PairProvider<true>{this, i}};
+    }
+
+    constexpr PairProvider<false> end_provider() noexcept { return {this, size()}; }
+    constexpr PairProvider<true> end_provider() const noexcept { return {this, size()}; }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_flat_map_customize::FixedFlatMapChecking<K> CheckingType>
+constexpr typename FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>::size_type is_full(
+    const FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+/**
+ * Removes every entry for which `predicate(PairView<const K, V>)` is true, in a single pass.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_flat_map_customize::FixedFlatMapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>::size_type erase_if(
+    FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>& c, Predicate predicate)
+{
+    auto& keys = c.IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    auto& values = c.IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    const std::size_t original_size = c.size();
+
+    std::size_t write = 0;
+    for (std::size_t read = 0; read < original_size; read++)
+    {
+        if (predicate(PairView<const K, V>{&keys[read], &values[read]}))
+        {
+            continue;
+        }
+        if (write != read)
+        {
+            keys[write] = std::move(keys[read]);
+            values[write] = std::move(values[read]);
+        }
+        write++;
+    }
+
+    const auto write_offset = static_cast<std::ptrdiff_t>(write);
+    keys.erase(keys.cbegin() + write_offset, keys.cend());
+    values.erase(values.cbegin() + write_offset, values.cend());
+    return original_size - write;
+}
+
+/**
+ * Construct a FixedFlatMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          fixed_flat_map_customize::FixedFlatMapChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedFlatMapType = FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedFlatMapType make_fixed_flat_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    FixedFlatMapType map{comparator};
+    map.insert(std::begin(list), std::end(list), loc);
+    return map;
+}
+
+template <typename K, typename V, typename Compare = std::less<K>, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_flat_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = fixed_flat_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedFlatMapType = FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>;
+    return make_fixed_flat_map<K, V, Compare, CheckingType, MAXIMUM_SIZE, FixedFlatMapType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
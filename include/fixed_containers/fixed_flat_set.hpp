@@ -0,0 +1,554 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/flat_sorted_keys.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace fixed_containers::fixed_flat_set_customize
+{
+template <class T, class K>
+concept FixedFlatSetChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::length_error(size, loc);  // ~ std::length_error
+    };
+
+template <class K, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::fixed_flat_set_customize
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity sorted-vector set with maximum size that is declared at compile-time via
+ * template parameter. The keys are kept sorted in a FixedVector, so lookups are binary searches
+ * over contiguous memory and iterators are random-access. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * Unlike FixedSet, insertion and removal shift the entries after the affected position, so they
+ * are linear and invalidate iterators to those entries. Prefer `insert(first, last)` for bulk
+ * insertion: it sorts the new entries and merges them in once.
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_flat_set_customize::FixedFlatSetChecking<K> CheckingType =
+              fixed_flat_set_customize::AbortChecking<K, MAXIMUM_SIZE>>
+class FixedFlatSet
+{
+    using KeyStorage = FixedVector<K, MAXIMUM_SIZE>;
+
+public:
+    using key_type = K;
+    using value_type = K;
+    using const_reference = const value_type&;
+    using reference = const_reference;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using pointer = const_pointer;
+    using key_compare = Compare;
+    using const_iterator = typename KeyStorage::const_iterator;
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    KeyStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedFlatSet() noexcept
+      : FixedFlatSet{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedFlatSet(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatSet(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatSet{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedFlatSet(std::initializer_list<value_type> list,
+                           const Compare& comparator = {},
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+      : FixedFlatSet{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`, in linear time.
+     * See `insert_sorted()`.
+     */
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedFlatSet from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        FixedFlatSet out{comparator};
+        out.insert_sorted(first, last, loc);
+        return out;
+    }
+    [[nodiscard]] static constexpr FixedFlatSet from_sorted_unique(
+        std::initializer_list<value_type> list,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return from_sorted_unique(list.begin(), list.end(), comparator, loc);
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept { return keys().cbegin(); }
+    constexpr const_iterator cend() const noexcept { return keys().cend(); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{cend()};
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{cbegin()};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    /**
+     * The keys, in sorted order.
+     */
+    [[nodiscard]] constexpr const KeyStorage& keys() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+
+    constexpr void clear() noexcept { mutable_keys().clear(); }
+
+    constexpr std::pair<const_iterator, bool> insert(
+        const K& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_at(index_of_lower_bound(value), loc, value);
+    }
+    constexpr std::pair<const_iterator, bool> insert(
+        K&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_at(index_of_lower_bound(value), loc, std::move(value));
+    }
+    constexpr const_iterator insert(const_iterator hint,
+                                    const K& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert_at(index_of_lower_bound_near(hint, key), loc, key).first;
+    }
+    constexpr const_iterator insert(const_iterator hint,
+                                    K&& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert_at(index_of_lower_bound_near(hint, key), loc, std::move(key)).first;
+    }
+
+    /**
+     * Bulk insertion. The entries are appended, sorted among themselves and merged with the
+     * existing ones in one pass: O(n log n + size()) instead of the O(n * size()) of one
+     * `insert()` per entry. Entries that are already present are ignored.
+     *
+     * If the appended entries fill the set, they are merged early, which drops the ignored ones,
+     * and the rest of the range is inserted one entry at a time. So only the resulting size is
+     * limited by `MAXIMUM_SIZE`. The merge uses `MAXIMUM_SIZE` indices of scratch space on the
+     * stack.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        const std::size_t sorted_count = size();
+        for (; first != last && size() < MAXIMUM_SIZE; std::advance(first, 1))
+        {
+            mutable_keys().push_back(*first);
+        }
+        merge_appended_entries(sorted_count);
+
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    /**
+     * Same as `insert(std::ranges::begin(range), std::ranges::end(range))`.
+     */
+    template <std::ranges::input_range Range>
+    constexpr void insert_range(Range&& range,
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+    {
+        this->insert(std::ranges::begin(range), std::ranges::end(range), loc);
+    }
+
+    /**
+     * Insert entries that are sorted and unique according to the comparator. If the container is
+     * empty, the entries are appended as they are, in linear time. Otherwise, this is equivalent
+     * to `insert(first, last)`.
+     * Passing entries that are not sorted and unique is undefined behavior when the fast path is
+     * taken.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert_sorted(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        if (!empty())
+        {
+            this->insert(first, last, loc);
+            return;
+        }
+
+        for (; first != last; std::advance(first, 1))
+        {
+            check_not_full(loc);
+            mutable_keys().push_back(*first);
+        }
+    }
+    constexpr void insert_sorted(std::initializer_list<value_type> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        this->insert_sorted(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr std::pair<const_iterator, bool> emplace(Args&&... args) noexcept
+    {
+        return insert(K(std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr const_iterator emplace_hint(const_iterator hint, Args&&... args) noexcept
+    {
+        return insert(hint, K(std::forward<Args>(args)...));
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        return mutable_keys().erase(pos);
+    }
+
+    constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        return mutable_keys().erase(first, last);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const std::size_t i = index_of_key_or_size(key);
+        if (i == size())
+        {
+            return 0;
+        }
+        erase(cbegin() + static_cast<difference_type>(i));
+        return 1;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return iterator_at(index_of_key_or_size(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return iterator_at(index_of_key_or_size(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return index_of_key_or_size(key) != size();
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return index_of_key_or_size(key) != size();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return iterator_at(index_of_lower_bound(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return iterator_at(index_of_lower_bound(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return iterator_at(index_of_upper_bound(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return iterator_at(index_of_upper_bound(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const std::size_t l = index_of_lower_bound(key);
+        return {iterator_at(l), iterator_at(is_key_at(l, key) ? l + 1 : l)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        const std::size_t l = index_of_lower_bound(key);
+        return {iterator_at(l), iterator_at(is_key_at(l, key) ? l + 1 : l)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_flat_set_customize::FixedFlatSetChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedFlatSet<K, MAXIMUM_SIZE_2, Compare2, CheckingType2>& other) const
+    {
+        return keys() == other.keys();
+    }
+
+private:
+    constexpr KeyStorage& mutable_keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    constexpr const Compare& comparator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    constexpr const_iterator iterator_at(const std::size_t i) const noexcept
+    {
+        return cbegin() + static_cast<difference_type>(i);
+    }
+
+    // At runtime, search through a plain pointer rather than the (range-checked) vector iterators
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_lower_bound(const K0& key) const noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return flat_sorted_keys_detail::lower_bound_index(cbegin(), size(), key, comparator());
+        }
+        return flat_sorted_keys_detail::lower_bound_index(
+            keys().data(), size(), key, comparator());
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_upper_bound(const K0& key) const noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return flat_sorted_keys_detail::upper_bound_index(cbegin(), size(), key, comparator());
+        }
+        return flat_sorted_keys_detail::upper_bound_index(
+            keys().data(), size(), key, comparator());
+    }
+
+    // The lower bound of `key`, in constant time if `hint` already points to it
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_lower_bound_near(
+        const const_iterator& hint, const K0& key) const noexcept
+    {
+        const auto h = static_cast<std::size_t>(std::distance(cbegin(), hint));
+        if ((h == 0 || comparator()(keys()[h - 1], key)) &&
+            (h == size() || !comparator()(keys()[h], key)))
+        {
+            return h;
+        }
+        return index_of_lower_bound(key);
+    }
+
+    // Whether the lower bound `i` of `key` is an exact match
+    template <class K0>
+    [[nodiscard]] constexpr bool is_key_at(const std::size_t i, const K0& key) const noexcept
+    {
+        return i != size() && !comparator()(key, keys()[i]);
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_key_or_size(const K0& key) const noexcept
+    {
+        const std::size_t i = index_of_lower_bound(key);
+        return is_key_at(i, key) ? i : size();
+    }
+
+    template <class KeyType>
+    constexpr std::pair<const_iterator, bool> insert_at(const std::size_t i,
+                                                        const std_transition::source_location& loc,
+                                                        KeyType&& key)
+    {
+        if (is_key_at(i, key))
+        {
+            return {iterator_at(i), false};
+        }
+
+        check_not_full(loc);
+        return {mutable_keys().emplace(iterator_at(i), std::forward<KeyType>(key)), true};
+    }
+
+    // Merges the entries from `sorted_count` onwards (in arbitrary order, possibly repeated) into
+    // the sorted entries before them.
+    constexpr void merge_appended_entries(const std::size_t sorted_count)
+    {
+        if (sorted_count == size())
+        {
+            return;
+        }
+
+        flat_sorted_keys_detail::Order<MAXIMUM_SIZE> order{};
+        const std::size_t kept_count = flat_sorted_keys_detail::compute_merge_order<MAXIMUM_SIZE>(
+            keys(), sorted_count, comparator(), order);
+        flat_sorted_keys_detail::apply_order<MAXIMUM_SIZE>(order, size(), mutable_keys());
+        mutable_keys().erase(iterator_at(kept_count), cend());
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_flat_set_customize::FixedFlatSetChecking<K> CheckingType>
+constexpr typename FixedFlatSet<K, MAXIMUM_SIZE, Compare, CheckingType>::size_type is_full(
+    const FixedFlatSet<K, MAXIMUM_SIZE, Compare, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+/**
+ * Removes every key for which `predicate(key)` is true, in a single pass.
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_flat_set_customize::FixedFlatSetChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedFlatSet<K, MAXIMUM_SIZE, Compare, CheckingType>::size_type erase_if(
+    FixedFlatSet<K, MAXIMUM_SIZE, Compare, CheckingType>& c, Predicate predicate)
+{
+    // Removing keys keeps the rest sorted, so this is the same as for the underlying vector
+    return erase_if(c.IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_, predicate);
+}
+
+/**
+ * Construct a FixedFlatSet with its capacity being deduced from the number of keys being passed.
+ */
+template <typename K,
+          typename Compare = std::less<K>,
+          fixed_flat_set_customize::FixedFlatSetChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedFlatSetType = FixedFlatSet<K, MAXIMUM_SIZE, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedFlatSetType make_fixed_flat_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    FixedFlatSetType set{comparator};
+    set.insert(std::begin(list), std::end(list), loc);
+    return set;
+}
+
+template <typename K, typename Compare = std::less<K>, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_flat_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = fixed_flat_set_customize::AbortChecking<K, MAXIMUM_SIZE>;
+    using FixedFlatSetType = FixedFlatSet<K, MAXIMUM_SIZE, Compare, CheckingType>;
+    return make_fixed_flat_set<K, Compare, CheckingType, MAXIMUM_SIZE, FixedFlatSetType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
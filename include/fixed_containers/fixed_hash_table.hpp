@@ -0,0 +1,496 @@
+#pragma once
+
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/smallest_unsigned_integer.hpp"
+#include "fixed_containers/value_or_reference_storage.hpp"
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_hash_table_detail
+{
+struct EmptyValue
+{
+    constexpr EmptyValue() = delete;
+};
+
+template <class K, class V = EmptyValue>
+class HashTableEntry
+{
+public:
+    using KeyType = K;
+    using ValueType = V;
+    static constexpr bool HAS_ASSOCIATED_VALUE = true;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
+    value_or_reference_storage_detail::ValueOrReferenceStorage<V>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
+
+public:
+    template <typename... Args>
+    explicit(sizeof...(Args) == 0) constexpr HashTableEntry(const K& k, Args&&... args) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_key_(k)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_value_(std::forward<Args>(args)...)
+    {
+    }
+    template <typename... Args>
+    explicit(sizeof...(Args) == 0) constexpr HashTableEntry(K&& k, Args&&... args) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_key_(std::move(k))
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_value_(std::forward<Args>(args)...)
+    {
+    }
+
+    [[nodiscard]] constexpr const K& key() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_; }
+    constexpr K& key() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_; }
+    [[nodiscard]] constexpr const V& value() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_.get();
+    }
+    constexpr V& value() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_.get(); }
+};
+
+template <class K>
+class HashTableEntry<K, EmptyValue>
+{
+public:
+    using KeyType = K;
+    using ValueType = EmptyValue;
+    static constexpr bool HAS_ASSOCIATED_VALUE = false;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
+
+public:
+    explicit constexpr HashTableEntry(const K& k) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_key_(k)
+    {
+    }
+    explicit constexpr HashTableEntry(K&& k) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_key_(std::move(k))
+    {
+    }
+
+    [[nodiscard]] constexpr const K& key() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_; }
+    constexpr K& key() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_; }
+};
+
+inline constexpr std::size_t NULL_INDEX = (std::numeric_limits<std::size_t>::max)();
+
+// Smallest unsigned type that can address every entry.
+template <std::size_t MAXIMUM_SIZE>
+using EntryIndexType = smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>;
+
+// Control bytes follow the SwissTable encoding: the most significant bit is set for empty and
+// deleted slots, full slots store the 7 low bits of the hash (H2).
+// https://abseil.io/about/design/swisstables
+inline constexpr std::uint8_t CONTROL_EMPTY = 0b10000000;
+inline constexpr std::uint8_t CONTROL_DELETED = 0b11111110;
+
+// Groups of control bytes are scanned with SWAR arithmetic on a std::uint64_t instead of SIMD
+// intrinsics, so that probing is identical during constant evaluation and at runtime.
+inline constexpr std::size_t GROUP_WIDTH = 8;
+inline constexpr std::uint64_t GROUP_LSBS = 0x0101010101010101ULL;
+inline constexpr std::uint64_t GROUP_MSBS = 0x8080808080808080ULL;
+
+// Each returned mask has the most significant bit of every matching byte set.
+constexpr std::uint64_t match_byte(const std::uint64_t group, const std::uint8_t h2) noexcept
+{
+    // May yield false positives above a real match, which are discarded by the key comparison.
+    const std::uint64_t x = group ^ (GROUP_LSBS * h2);
+    return (x - GROUP_LSBS) & ~x & GROUP_MSBS;
+}
+constexpr std::uint64_t match_empty(const std::uint64_t group) noexcept
+{
+    return group & ~(group << 6) & GROUP_MSBS;
+}
+constexpr std::uint64_t match_empty_or_deleted(const std::uint64_t group) noexcept
+{
+    return group & ~(group << 7) & GROUP_MSBS;
+}
+constexpr std::size_t lowest_matched_byte(const std::uint64_t mask) noexcept
+{
+    return static_cast<std::size_t>(std::countr_zero(mask)) / 8;
+}
+
+// Smallest power-of-two slot count (in whole groups) that keeps the load factor at or below 7/8.
+constexpr std::size_t slot_count_for(const std::size_t maximum_size) noexcept
+{
+    std::size_t out = GROUP_WIDTH;
+    while (out - out / 8 < maximum_size)
+    {
+        out *= 2;
+    }
+    return out;
+}
+
+struct SlotLookup
+{
+    // The slot holding the key if found, otherwise the first slot where it can be inserted
+    std::size_t slot;
+    std::uint64_t hash;
+    bool found;
+};
+
+/**
+ * Open-addressing hash table with SwissTable-style group probing. Control bytes and entry indices
+ * live in slot-indexed arrays, while the entries themselves are kept contiguous in a FixedVector.
+ * This keeps the special members of the table trivial/defaulted (FixedVector takes care of
+ * propagating the properties of K and V) and makes iteration a linear walk over the entries.
+ * Erasing moves the last entry into the hole, so indices are invalidated on removal.
+ *
+ * Tombstones (deleted slots) are dropped by re-inserting all entries in place once no empty slot
+ * can be consumed without exceeding the maximum load factor.
+ */
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Hash, class KeyEqual>
+class FixedHashTable
+{
+public:
+    using KeyType = K;
+    using ValueType = V;
+    static constexpr bool HAS_ASSOCIATED_VALUE = !std::is_same_v<V, EmptyValue>;
+    using EntryType = HashTableEntry<K, V>;
+    using EntryIndex = EntryIndexType<MAXIMUM_SIZE>;
+
+    static constexpr std::size_t SLOT_COUNT = slot_count_for(MAXIMUM_SIZE);
+    static constexpr std::size_t GROUP_COUNT = SLOT_COUNT / GROUP_WIDTH;
+    static constexpr std::size_t GROWTH_LIMIT = SLOT_COUNT - SLOT_COUNT / 8;
+    static_assert(GROWTH_LIMIT >= MAXIMUM_SIZE);
+    static_assert(std::has_single_bit(GROUP_COUNT));
+
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    static constexpr std::size_t GROUP_MASK = GROUP_COUNT - 1;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<std::uint8_t, SLOT_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_control_;
+    std::array<EntryIndex, SLOT_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_growth_left_;
+    FixedVector<EntryType, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{};
+
+public:
+    constexpr FixedHashTable() noexcept
+      : FixedHashTable(Hash{}, KeyEqual{})
+    {
+    }
+
+    constexpr FixedHashTable(const Hash& hash, const KeyEqual& key_equal) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_control_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_growth_left_{GROWTH_LIMIT}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{key_equal}
+    {
+        control().fill(CONTROL_EMPTY);
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return entries().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return size() == MAXIMUM_SIZE; }
+
+    constexpr void clear() noexcept
+    {
+        entries().clear();
+        control().fill(CONTROL_EMPTY);
+        set_growth_left(GROWTH_LIMIT);
+    }
+
+    [[nodiscard]] constexpr const Hash& hash_function() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+    [[nodiscard]] constexpr const KeyEqual& key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    constexpr EntryType& entry_at(const std::size_t i) { return entries()[i]; }
+    [[nodiscard]] constexpr const EntryType& entry_at(const std::size_t i) const
+    {
+        return entries()[i];
+    }
+
+    [[nodiscard]] constexpr std::size_t entry_index_at_slot(const std::size_t slot) const
+    {
+        return slots()[slot];
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of_entry_or_null(const K0& key) const
+    {
+        const std::size_t slot = slot_of_key_or_null(key);
+        return slot == NULL_INDEX ? NULL_INDEX : slots()[slot];
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t slot_of_key_or_null(const K0& key) const
+    {
+        const std::uint64_t h = hash_of(key);
+        std::size_t group = h1(h) & GROUP_MASK;
+        for (std::size_t probe = 0; probe < GROUP_COUNT; probe++)
+        {
+            const std::uint64_t word = load_group(group);
+            for (std::uint64_t bits = match_byte(word, h2(h)); bits != 0; bits &= bits - 1)
+            {
+                const std::size_t slot = group * GROUP_WIDTH + lowest_matched_byte(bits);
+                if (key_eq()(entry_at(slots()[slot]).key(), key))
+                {
+                    return slot;
+                }
+            }
+            if (match_empty(word) != 0)
+            {
+                break;
+            }
+            group = (group + probe + 1) & GROUP_MASK;
+        }
+        return NULL_INDEX;
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr bool contains_key(const K0& key) const
+    {
+        return index_of_entry_or_null(key) != NULL_INDEX;
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr SlotLookup lookup_for_insertion(const K0& key) const
+    {
+        const std::uint64_t h = hash_of(key);
+        std::size_t group = h1(h) & GROUP_MASK;
+        std::size_t insertion_slot = NULL_INDEX;
+        for (std::size_t probe = 0; probe < GROUP_COUNT; probe++)
+        {
+            const std::uint64_t word = load_group(group);
+            for (std::uint64_t bits = match_byte(word, h2(h)); bits != 0; bits &= bits - 1)
+            {
+                const std::size_t slot = group * GROUP_WIDTH + lowest_matched_byte(bits);
+                if (key_eq()(entry_at(slots()[slot]).key(), key))
+                {
+                    return {slot, h, true};
+                }
+            }
+            if (insertion_slot == NULL_INDEX)
+            {
+                const std::uint64_t available = match_empty_or_deleted(word);
+                if (available != 0)
+                {
+                    insertion_slot = group * GROUP_WIDTH + lowest_matched_byte(available);
+                }
+            }
+            if (match_empty(word) != 0)
+            {
+                break;
+            }
+            group = (group + probe + 1) & GROUP_MASK;
+        }
+        return {insertion_slot, h, false};
+    }
+
+    // Returns the index of the new entry
+    template <class... Args>
+    constexpr std::size_t insert_new_at(const SlotLookup& lookup, Args&&... args)
+    {
+        assert(!lookup.found);
+        assert(!full());
+        std::size_t slot = lookup.slot;
+        if (control()[slot] == CONTROL_EMPTY && growth_left() == 0)
+        {
+            rehash_in_place();
+            slot = first_available_slot(lookup.hash);
+        }
+
+        const std::size_t i = size();
+        entries().emplace_back(std::forward<Args>(args)...);
+        occupy_slot(slot, lookup.hash, i);
+        return i;
+    }
+
+    // Returns the number of erased entries (0 or 1)
+    template <class K0>
+    constexpr std::size_t erase_key(const K0& key)
+    {
+        const std::size_t slot = slot_of_key_or_null(key);
+        if (slot == NULL_INDEX)
+        {
+            return 0;
+        }
+        erase_slot(slot);
+        return 1;
+    }
+
+    // The last entry is moved into position `i`
+    constexpr void erase_at(const std::size_t i) { erase_slot(slot_of_entry(i)); }
+
+private:
+    constexpr std::array<std::uint8_t, SLOT_COUNT>& control()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_control_;
+    }
+    [[nodiscard]] constexpr const std::array<std::uint8_t, SLOT_COUNT>& control() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_control_;
+    }
+    constexpr std::array<EntryIndex, SLOT_COUNT>& slots()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    }
+    [[nodiscard]] constexpr const std::array<EntryIndex, SLOT_COUNT>& slots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    }
+    constexpr FixedVector<EntryType, MAXIMUM_SIZE>& entries()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    }
+    [[nodiscard]] constexpr const FixedVector<EntryType, MAXIMUM_SIZE>& entries() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    }
+    [[nodiscard]] constexpr std::size_t growth_left() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_growth_left_;
+    }
+    constexpr void set_growth_left(const std::size_t n)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_growth_left_ = n;
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::uint64_t hash_of(const K0& key) const
+    {
+        // Fibonacci hashing, so that weak hashes (e.g. identity for integers) still spread
+        // across groups and H2.
+        const std::uint64_t m =
+            static_cast<std::uint64_t>(hash_function()(key)) * 0x9E3779B97F4A7C15ULL;
+        return m ^ (m >> 32);
+    }
+    static constexpr std::size_t h1(const std::uint64_t h)
+    {
+        return static_cast<std::size_t>(h >> 7);
+    }
+    static constexpr std::uint8_t h2(const std::uint64_t h)
+    {
+        return static_cast<std::uint8_t>(h & 0x7F);
+    }
+
+    [[nodiscard]] constexpr std::uint64_t load_group(const std::size_t group) const
+    {
+        const std::size_t first = group * GROUP_WIDTH;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                std::uint64_t out{};
+                std::memcpy(&out, &control()[first], sizeof(out));
+                return out;
+            }
+        }
+        std::uint64_t out = 0;
+        for (std::size_t k = 0; k < GROUP_WIDTH; k++)
+        {
+            out |= static_cast<std::uint64_t>(control()[first + k]) << (k * 8);
+        }
+        return out;
+    }
+
+    [[nodiscard]] constexpr std::size_t first_available_slot(const std::uint64_t h) const
+    {
+        std::size_t group = h1(h) & GROUP_MASK;
+        for (std::size_t probe = 0; probe < GROUP_COUNT; probe++)
+        {
+            const std::uint64_t available = match_empty_or_deleted(load_group(group));
+            if (available != 0)
+            {
+                return group * GROUP_WIDTH + lowest_matched_byte(available);
+            }
+            group = (group + probe + 1) & GROUP_MASK;
+        }
+        assert(false);
+        return NULL_INDEX;
+    }
+
+    [[nodiscard]] constexpr std::size_t slot_of_entry(const std::size_t i) const
+    {
+        const std::uint64_t h = hash_of(entry_at(i).key());
+        std::size_t group = h1(h) & GROUP_MASK;
+        for (std::size_t probe = 0; probe < GROUP_COUNT; probe++)
+        {
+            const std::uint64_t word = load_group(group);
+            for (std::uint64_t bits = match_byte(word, h2(h)); bits != 0; bits &= bits - 1)
+            {
+                const std::size_t slot = group * GROUP_WIDTH + lowest_matched_byte(bits);
+                if (slots()[slot] == i)
+                {
+                    return slot;
+                }
+            }
+            group = (group + probe + 1) & GROUP_MASK;
+        }
+        assert(false);
+        return NULL_INDEX;
+    }
+
+    constexpr void occupy_slot(const std::size_t slot, const std::uint64_t h, const std::size_t i)
+    {
+        if (control()[slot] == CONTROL_EMPTY)
+        {
+            set_growth_left(growth_left() - 1);
+        }
+        control()[slot] = h2(h);
+        slots()[slot] = static_cast<EntryIndex>(i);
+    }
+
+    constexpr void erase_slot(const std::size_t slot)
+    {
+        const std::size_t i = slots()[slot];
+
+        // If the group still has an empty slot, no probe sequence has ever continued past it, so
+        // the slot can go back to empty instead of becoming a tombstone.
+        if (match_empty(load_group(slot / GROUP_WIDTH)) != 0)
+        {
+            control()[slot] = CONTROL_EMPTY;
+            set_growth_left(growth_left() + 1);
+        }
+        else
+        {
+            control()[slot] = CONTROL_DELETED;
+        }
+
+        const std::size_t last = size() - 1;
+        if (i != last)
+        {
+            slots()[slot_of_entry(last)] = static_cast<EntryIndex>(i);
+            std::destroy_at(&entry_at(i));
+            std::construct_at(&entry_at(i), std::move(entry_at(last)));
+        }
+        entries().pop_back();
+    }
+
+    constexpr void rehash_in_place()
+    {
+        control().fill(CONTROL_EMPTY);
+        set_growth_left(GROWTH_LIMIT);
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            const std::uint64_t h = hash_of(entry_at(i).key());
+            occupy_slot(first_available_slot(h), h, i);
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_hash_table_detail
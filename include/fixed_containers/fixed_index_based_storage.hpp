@@ -3,6 +3,7 @@
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/fixed_vector.hpp"
 #include "fixed_containers/index_or_value_storage.hpp"
+#include "fixed_containers/smallest_unsigned_integer.hpp"
 
 #include <array>
 #include <cassert>
@@ -25,10 +26,28 @@ concept IsFixedIndexBasedStorage =
         b.delete_at_and_return_repositioned_index(i);
     };
 
+// Storages that keep unused slots in a free list, can move an entry into any of them, and can
+// forget all of their entries at once
+template <class StorageType>
+concept IsFixedIndexBasedStorageWithFreeList =
+    IsFixedIndexBasedStorage<StorageType> &&
+    requires(const StorageType& a, StorageType& b, const std::size_t i) {
+        a.first_free_index();
+        a.next_free_index(i);
+        b.move_to_free_slot(i, i, i);
+        b.reset();
+    };
+
+// Slots that were never handed out are not linked into the free list. They are all at or above
+// the high-water mark and are handed out in order once the free list runs out, so construction
+// does not need to touch the array at runtime.
 template <class T, std::size_t MAXIMUM_SIZE>
 class FixedIndexBasedPoolStorage
 {
-    using IndexOrValueT = index_or_value_storage_detail::IndexOrValueStorage<T>;
+    // The free list links only ever need to address [0, MAXIMUM_SIZE], so keep them narrow to
+    // avoid inflating small elements.
+    using IndexType = smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>;
+    using IndexOrValueT = index_or_value_storage_detail::IndexOrValueStorage<T, IndexType>;
     using IndexOrValueArray = std::array<IndexOrValueT, MAXIMUM_SIZE>;
 
 public:
@@ -37,16 +56,21 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     IndexOrValueArray IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
-    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_;
+    // Head of the free list. The last freed slot links to the high-water mark, past which every
+    // slot is free.
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_;
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_high_water_mark_;
 
 public:
     constexpr FixedIndexBasedPoolStorage() noexcept
-      : IMPLEMENTATION_DETAIL_DO_NOT_USE_array_{}
-      , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_{}
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_high_water_mark_{}
+    // Don't initialize the array
     {
-        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        // A constexpr context requires everything to be initialized.
+        if (std::is_constant_evaluated())
         {
-            array_unchecked_at(i).index = i + 1;
+            std::construct_at(&IMPLEMENTATION_DETAIL_DO_NOT_USE_array_);
         }
     }
 
@@ -63,7 +87,15 @@ public:
     {
         assert(!full());
         const std::size_t i = next_index();
-        set_next_index(array_unchecked_at(next_index()).index);
+        if (i == high_water_mark())
+        {
+            set_high_water_mark(i + 1);
+            set_next_index(i + 1);
+        }
+        else
+        {
+            set_next_index(array_unchecked_at(i).index);
+        }
         emplace_at(i, std::forward<Args>(args)...);
         return i;
     }
@@ -71,11 +103,54 @@ public:
     constexpr std::size_t delete_at_and_return_repositioned_index(const std::size_t i) noexcept
     {
         destroy_at(i);
-        array_unchecked_at(i).index = next_index();
+        array_unchecked_at(i).index = static_cast<IndexType>(next_index());
         set_next_index(i);
         return i;
     }
 
+    // Forgets all entries in O(1), without destroying them. Slots are then handed out in order
+    // again, starting from 0.
+    constexpr void reset() noexcept
+    {
+        set_next_index(0);
+        set_high_water_mark(0);
+    }
+
+    // Walks the free list. Both return MAXIMUM_SIZE past its end.
+    [[nodiscard]] constexpr std::size_t first_free_index() const noexcept { return next_index(); }
+    [[nodiscard]] constexpr std::size_t next_free_index(const std::size_t i) const noexcept
+    {
+        if (i >= high_water_mark())
+        {
+            return i + 1;
+        }
+        return array_unchecked_at(i).index;
+    }
+
+    // Moves the entry at `from` into the free slot `to`, and `from` takes the place of `to` in the
+    // free list. `previous_free` is the slot before `to` in the free list, or MAXIMUM_SIZE if `to`
+    // is the first one. This is meant for defragmentation: unlike deleting and emplacing, it does
+    // not change the order in which free slots are handed out.
+    // `to` must be below the high-water mark, which is always the case for slots below `from`.
+    constexpr void move_to_free_slot(const std::size_t from,
+                                     const std::size_t to,
+                                     const std::size_t previous_free) noexcept
+    {
+        assert(to < high_water_mark());
+        const std::size_t next_free = next_free_index(to);
+        emplace_at(to, std::move(at(from)));
+        destroy_at(from);
+        array_unchecked_at(from).index = static_cast<IndexType>(next_free);
+        if (previous_free == MAXIMUM_SIZE)
+        {
+            set_next_index(from);
+        }
+        else
+        {
+            array_unchecked_at(previous_free).index = static_cast<IndexType>(from);
+        }
+    }
+
 private:
     constexpr const IndexOrValueT& array_unchecked_at(const std::size_t i) const
     {
@@ -91,7 +166,15 @@ private:
     }
     constexpr void set_next_index(const std::size_t n)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_ = n;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_ = static_cast<IndexType>(n);
+    }
+    [[nodiscard]] constexpr std::size_t high_water_mark() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_high_water_mark_;
+    }
+    constexpr void set_high_water_mark(const std::size_t n)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_high_water_mark_ = static_cast<IndexType>(n);
     }
 
     template <class... Args>
@@ -103,6 +186,36 @@ private:
     constexpr void destroy_at(std::size_t i) { std::destroy_at(&array_unchecked_at(i).value); }
 };
 
+// Same as FixedIndexBasedPoolStorage when used on its own.
+// When used as the StorageTemplate of a red-black tree (FixedMap), the tree splits every entry in
+// two: the nodes in this pool only hold the key and the links, and the values are stored in a
+// parallel array indexed by the same node index. Lookups and rebalancing only ever read keys and
+// links, so they no longer pull value payloads into the cache. This pays off for large values.
+template <class T, std::size_t MAXIMUM_SIZE>
+class FixedIndexBasedSplitPoolStorage : public FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>
+{
+public:
+    constexpr FixedIndexBasedSplitPoolStorage() noexcept
+      : FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>()
+    {
+    }
+};
+
+// Same as FixedIndexBasedPoolStorage when used on its own.
+// When used as the StorageTemplate of a red-black tree (FixedMap/FixedSet), every node also keeps
+// the size of its subtree, which enables O(log n) order statistics (nth(), rank_of(),
+// count_in_range()) at the cost of a slightly larger node and of updating the sizes on every
+// insertion, deletion and rotation.
+template <class T, std::size_t MAXIMUM_SIZE>
+class FixedIndexBasedOrderStatisticPoolStorage : public FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>
+{
+public:
+    constexpr FixedIndexBasedOrderStatisticPoolStorage() noexcept
+      : FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>()
+    {
+    }
+};
+
 // This allocator keeps entries contiguous in memory - no gaps.
 // To achieve that, every time an entry is removed, it is filled by moving the last entry in its
 // place (this is O(1)).
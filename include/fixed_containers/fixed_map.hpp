@@ -7,8 +7,14 @@
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
 
 namespace fixed_containers::fixed_map_customize
 {
@@ -82,6 +88,8 @@ private:
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
         FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    static constexpr bool HAS_ORDER_STATISTICS =
+        fixed_red_black_tree_detail::TRACKS_SUBTREE_SIZES<StorageTemplate>;
 
     template <bool IS_CONST>
     struct PairProvider
@@ -226,6 +234,31 @@ public:
         this->insert(list, loc);
     }
 
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`, in linear time.
+     * See `insert_sorted()`.
+     */
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedMap from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        FixedMap out{comparator};
+        out.insert_sorted(first, last, loc);
+        return out;
+    }
+    [[nodiscard]] static constexpr FixedMap from_sorted_unique(
+        std::initializer_list<value_type> list,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return from_sorted_unique(list.begin(), list.end(), comparator, loc);
+    }
+
 public:
     [[nodiscard]] constexpr V& at(const K& key,
                                   const std_transition::source_location& loc =
@@ -358,6 +391,56 @@ public:
         this->insert(list.begin(), list.end(), loc);
     }
 
+    /**
+     * Insert entries that are sorted and unique according to the comparator. If the range is
+     * forward-iterable, this takes linear time instead of O(n log n) with rebalancing:
+     *  - if the container is empty, the tree is built directly, with nodes laid out in iteration
+     *    order where the storage allows it.
+     *  - otherwise, the entries are merged in place into the in-order sequence of the existing
+     *    entries, which is then relinked as a balanced tree. Entries already present are not
+     *    moved, so iterators to them remain valid, and entries whose key is already present are
+     *    not inserted.
+     * Otherwise, this is equivalent to `insert(first, last)`.
+     * Passing entries that are not sorted and unique is undefined behavior when the fast path is
+     * taken.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert_sorted(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            // More unique keys than MAXIMUM_SIZE can never fit, whatever is already present
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            if (preconditions::test(count <= MAXIMUM_SIZE))
+            {
+                CheckingType::length_error(count, loc);
+            }
+            if (empty())
+            {
+                tree().build_from_sorted_unique(first, count);
+                return;
+            }
+
+            if (preconditions::test(tree().merge_sorted_unique(first, last)))
+            {
+                CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+            }
+        }
+        else
+        {
+            this->insert(first, last, loc);
+        }
+    }
+    constexpr void insert_sorted(std::initializer_list<value_type> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        this->insert_sorted(list.begin(), list.end(), loc);
+    }
+
     template <class M>
     constexpr std::pair<iterator, bool> insert_or_assign(
         const K& key,
@@ -397,24 +480,44 @@ public:
         return {create_iterator(np.i), true};
     }
     template <class M>
-    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+    constexpr iterator insert_or_assign(const_iterator hint,
                                         const K& key,
                                         M&& obj,
                                         const std_transition::source_location& loc =
                                             std_transition::source_location::current()) noexcept
         requires std::is_assignable_v<mapped_type&, M&&>
     {
-        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+        NodeIndexAndParentIndex np =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np.i))
+        {
+            tree().node_at(np.i).value() = std::forward<M>(obj);
+            return create_iterator(np.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np, key, std::forward<M>(obj));
+        return create_iterator(np.i);
     }
     template <class M>
-    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+    constexpr iterator insert_or_assign(const_iterator hint,
                                         K&& key,
                                         M&& obj,
                                         const std_transition::source_location& loc =
                                             std_transition::source_location::current()) noexcept
         requires std::is_assignable_v<mapped_type&, M&&>
     {
-        return insert_or_assign(std::move(key), std::forward<M>(obj), loc).first;
+        NodeIndexAndParentIndex np =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np.i))
+        {
+            tree().node_at(np.i).value() = std::forward<M>(obj);
+            return create_iterator(np.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np, std::move(key), std::forward<M>(obj));
+        return create_iterator(np.i);
     }
 
     template <class... Args>
@@ -444,18 +547,36 @@ public:
         return {create_iterator(np.i), true};
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
                                                     const K& key,
                                                     Args&&... args) noexcept
     {
-        return try_emplace(key, std::forward<Args>(args)...);
+        NodeIndexAndParentIndex np =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np.i))
+        {
+            return {create_iterator(np.i), false};
+        }
+
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np, key, std::forward<Args>(args)...);
+        return {create_iterator(np.i), true};
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
                                                     K&& key,
                                                     Args&&... args) noexcept
     {
-        return try_emplace(std::move(key), std::forward<Args>(args)...);
+        NodeIndexAndParentIndex np =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np.i))
+        {
+            return {create_iterator(np.i), false};
+        }
+
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np, std::move(key), std::forward<Args>(args)...);
+        return {create_iterator(np.i), true};
     }
 
     template <class... Args>
@@ -465,10 +586,11 @@ public:
         return try_emplace(std::move(as_pair.first), std::move(as_pair.second));
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator hint,
                                                      Args&&... args) noexcept
     {
-        return emplace(std::forward<Args>(args)...);
+        std::pair<K, V> as_pair{std::forward<Args>(args)...};
+        return try_emplace(hint, std::move(as_pair.first), std::move(as_pair.second));
     }
 
     constexpr iterator erase(const_iterator pos) noexcept
@@ -502,6 +624,89 @@ public:
 
     constexpr size_type erase(const K& key) noexcept { return tree().delete_node(key); }
 
+    /**
+     * Removes the entry at `pos` and returns it. Along with insert(), this moves entries between
+     * containers the way node handles do for std::map.
+     */
+    [[nodiscard]] constexpr value_type extract(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        const NodeIndex i = index_of_hint(pos);
+        fixed_red_black_tree_detail::RedBlackTreeNodeView node = tree().node_at(i);
+        value_type out{std::move(node.key()), std::move(node.value())};
+        tree().delete_at_and_return_successor(i);
+        return out;
+    }
+    /**
+     * Removes the entry with the given key, if any, and returns it.
+     */
+    [[nodiscard]] constexpr std::optional<value_type> extract(const K& key) noexcept
+    {
+        const NodeIndex i = tree().index_of_node_or_null(key);
+        if (!tree().contains_at(i))
+        {
+            return std::nullopt;
+        }
+        fixed_red_black_tree_detail::RedBlackTreeNodeView node = tree().node_at(i);
+        std::optional<value_type> out{
+            std::in_place, std::move(node.key()), std::move(node.value())};
+        tree().delete_at_and_return_successor(i);
+        return out;
+    }
+
+    /**
+     * Moves the entries of `other` whose key is not in this map into it. The other entries stay
+     * in `other`. Unlike std::map::merge(), entries are moved rather than spliced, but this is
+     * done in linear time: both trees are flattened, merged and relinked as balanced trees, with
+     * no per-entry lookup or rebalancing. Entries of this map are not moved, so iterators to
+     * them remain valid.
+     */
+    constexpr void merge(FixedMap& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(tree().merge_from(other.tree())))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void merge(FixedMap&& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        merge(other, loc);
+    }
+
+    /**
+     * Linear-time set algebra between FixedMaps of the same type. The in-order sequences are merged
+     * and the result is built directly as a balanced tree, instead of inserting (and rebalancing)
+     * one entry at a time. Entries are copied from `a`, except for the ones that are only in `b`.
+     */
+    [[nodiscard]] friend constexpr FixedMap set_union(
+        const FixedMap& a,
+        const FixedMap& b,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return merged(a, b, fixed_red_black_tree_detail::SortedMergeKind::UNION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedMap set_intersection(
+        const FixedMap& a,
+        const FixedMap& b,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return merged(a, b, fixed_red_black_tree_detail::SortedMergeKind::INTERSECTION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedMap set_difference(
+        const FixedMap& a,
+        const FixedMap& b,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return merged(a, b, fixed_red_black_tree_detail::SortedMergeKind::DIFFERENCE, loc);
+    }
+
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
         const NodeIndex i = tree().index_of_node_or_null(key);
@@ -550,6 +755,34 @@ public:
         return create_const_iterator(i);
     }
 
+    // Batched lookups: `out[j]` receives the result of looking up `keys[j]`.
+    // Several descents are run in lockstep, with the next node of each prefetched, so this is
+    // faster than a loop of find() when the map does not fit in the cache.
+    constexpr void find_batch(const std::span<const K> keys,
+                              const std::span<iterator> out) noexcept
+    {
+        find_batch_impl(keys, out);
+    }
+    constexpr void find_batch(const std::span<const K> keys,
+                              const std::span<const_iterator> out) const noexcept
+    {
+        find_batch_impl(keys, out);
+    }
+    template <class K0>
+    constexpr void find_batch(const std::span<const K0> keys,
+                              const std::span<iterator> out) noexcept
+        requires IsTransparent<Compare>
+    {
+        find_batch_impl(keys, out);
+    }
+    template <class K0>
+    constexpr void find_batch(const std::span<const K0> keys,
+                              const std::span<const_iterator> out) const noexcept
+        requires IsTransparent<Compare>
+    {
+        find_batch_impl(keys, out);
+    }
+
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
         return tree().contains_node(key);
@@ -562,6 +795,19 @@ public:
         return tree().contains_node(key);
     }
 
+    constexpr void contains_batch(const std::span<const K> keys,
+                                  const std::span<bool> out) const noexcept
+    {
+        contains_batch_impl(keys, out);
+    }
+    template <class K0>
+    constexpr void contains_batch(const std::span<const K0> keys,
+                                  const std::span<bool> out) const noexcept
+        requires IsTransparent<Compare>
+    {
+        contains_batch_impl(keys, out);
+    }
+
     [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
     {
         return static_cast<std::size_t>(contains(key));
@@ -647,6 +893,65 @@ public:
         return equal_range_impl(np);
     }
 
+    // Order statistics, in O(log n). Only available with FixedIndexBasedOrderStatisticPoolStorage,
+    // whose nodes keep the size of their subtree.
+    // `nth(n)` is the n-th smallest entry (0-based), or end() if n >= size().
+    [[nodiscard]] constexpr iterator nth(const std::size_t n) noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return create_iterator(tree().index_of_nth_at(n));
+    }
+    [[nodiscard]] constexpr const_iterator nth(const std::size_t n) const noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return create_const_iterator(tree().index_of_nth_at(n));
+    }
+    // Number of entries whose key is less than `key`
+    [[nodiscard]] constexpr std::size_t rank_of(const K& key) const noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return tree().rank_of(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t rank_of(const K0& key) const noexcept
+        requires HAS_ORDER_STATISTICS && IsTransparent<Compare>
+    {
+        return tree().rank_of(key);
+    }
+    // Number of entries whose key is in [lo, hi)
+    [[nodiscard]] constexpr std::size_t count_in_range(const K& lo, const K& hi) const noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return count_in_range_impl(lo, hi);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr std::size_t count_in_range(const K0& lo, const K1& hi) const noexcept
+        requires HAS_ORDER_STATISTICS && IsTransparent<Compare>
+    {
+        return count_in_range_impl(lo, hi);
+    }
+
+    // Storage layout. After many insertions and erasures, entries that are next to each other in
+    // iteration order can end up scattered across the storage, and iterating becomes random access.
+    // `fragmentation()` is the number of entries whose successor is not stored right after them.
+    // `compact_in_order()` relocates the entries so that iteration walks the storage linearly
+    // again, which brings fragmentation() down to 0. The overload taking `max_moves` stops after
+    // moving that many entries and returns whether it is done, so it can be spread over idle
+    // periods. Each of those calls still walks all the entries.
+    // Relocating entries invalidates all iterators and references.
+    [[nodiscard]] constexpr std::size_t fragmentation() const noexcept
+    {
+        return tree().fragmentation();
+    }
+    constexpr void compact_in_order() noexcept
+    {
+        tree().compact_in_order((std::numeric_limits<std::size_t>::max)());
+    }
+    constexpr bool compact_in_order(const std::size_t max_moves) noexcept
+    {
+        return tree().compact_in_order(max_moves);
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -684,6 +989,19 @@ private:
     constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
     constexpr const Tree& tree() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
 
+    static constexpr FixedMap merged(const FixedMap& a,
+                                  const FixedMap& b,
+                                  const fixed_red_black_tree_detail::SortedMergeKind kind,
+                                  const std_transition::source_location& loc) noexcept
+    {
+        FixedMap out{a.tree().key_comp()};
+        if (preconditions::test(out.tree().assign_merged(a.tree(), b.tree(), kind)))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+        return out;
+    }
+
     constexpr iterator create_iterator(const NodeIndex& start_index) noexcept
     {
         const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
@@ -696,6 +1014,51 @@ private:
         return const_iterator{PairProvider<true>{&tree(), i}};
     }
 
+    template <class K0, class K1>
+    [[nodiscard]] constexpr std::size_t count_in_range_impl(const K0& lo,
+                                                            const K1& hi) const noexcept
+    {
+        const std::size_t lo_rank = tree().rank_of(lo);
+        const std::size_t hi_rank = tree().rank_of(hi);
+        return hi_rank > lo_rank ? hi_rank - lo_rank : 0;
+    }
+
+    template <class K0>
+    constexpr void find_batch_impl(const std::span<const K0> keys,
+                                   const std::span<iterator> out) noexcept
+    {
+        assert(keys.size() == out.size());
+        tree().for_each_index_of_node_or_null(keys,
+                                              [this, &out](const std::size_t j, const NodeIndex& i)
+                                              { out[j] = create_iterator(i); });
+    }
+    template <class K0>
+    constexpr void find_batch_impl(const std::span<const K0> keys,
+                                   const std::span<const_iterator> out) const noexcept
+    {
+        assert(keys.size() == out.size());
+        tree().for_each_index_of_node_or_null(keys,
+                                              [this, &out](const std::size_t j, const NodeIndex& i)
+                                              { out[j] = create_const_iterator(i); });
+    }
+    template <class K0>
+    constexpr void contains_batch_impl(const std::span<const K0> keys,
+                                       const std::span<bool> out) const noexcept
+    {
+        assert(keys.size() == out.size());
+        tree().for_each_index_of_node_or_null(keys,
+                                              [this, &out](const std::size_t j, const NodeIndex& i)
+                                              { out[j] = tree().contains_at(i); });
+    }
+
+    // Inverse of replace_null_index_with_max_size_for_end_iterator()
+    static constexpr NodeIndex index_of_hint(const const_iterator& hint) noexcept
+    {
+        const NodeIndex i =
+            hint.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().current_index_;
+        return i == MAXIMUM_SIZE ? NULL_INDEX : i;
+    }
+
     constexpr reverse_iterator create_reverse_iterator(const NodeIndex& start_index) noexcept
     {
         return reverse_iterator{PairProvider<false>{&tree(), start_index}};
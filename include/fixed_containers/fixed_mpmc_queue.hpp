@@ -0,0 +1,267 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_mpmc_queue_detail
+{
+using cache_line_detail::CACHE_LINE_SIZE;
+
+template <typename T, std::size_t CAPACITY>
+class FixedMpmcQueueBase
+{
+    using OptionalT = optional_storage_detail::OptionalStorage<T>;
+    static_assert(consteval_compare::equal<sizeof(OptionalT), sizeof(T)>);
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "Queue must have a non-const, non-volatile value_type");
+    // With a single slot, the sequence a pop republishes (`p + CAPACITY`) would equal the one
+    // that means "filled" (`p + 1`)
+    static_assert(CAPACITY >= 2, "The queue needs at least two slots");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+    // Vyukov's bounded queue: every slot carries a sequence number saying whose turn it is.
+    // For the slot of position `p`, sequence `p` means "free for the producer of p" and `p + 1`
+    // means "filled, ready for the consumer of p".
+    //
+    // The sequence is stored relative to the slot's index (the textbook version initializes slot
+    // `i` to `i`), so that all slots start at zero and the constructor can be constexpr.
+    struct Slot
+    {
+        std::atomic<std::size_t> relative_sequence{0};
+        OptionalT storage{};
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    // Positions count pushes/pops and are never wrapped themselves; only the slot is.
+    static constexpr std::size_t slot_of(const std::size_t position) noexcept
+    {
+        if constexpr (std::has_single_bit(CAPACITY))
+        {
+            return position & (CAPACITY - 1);
+        }
+        else
+        {
+            return position % CAPACITY;
+        }
+    }
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueue_position_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeue_position_;
+    alignas(CACHE_LINE_SIZE) std::array<Slot, CAPACITY> slots_;
+
+public:
+    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
+    static constexpr std::size_t max_size() noexcept { return capacity(); }
+
+    constexpr FixedMpmcQueueBase() noexcept
+      : enqueue_position_{0}
+      , dequeue_position_{0}
+      , slots_{}
+    {
+    }
+
+    FixedMpmcQueueBase(const FixedMpmcQueueBase&) = delete;
+    FixedMpmcQueueBase(FixedMpmcQueueBase&&) = delete;
+    FixedMpmcQueueBase& operator=(const FixedMpmcQueueBase&) = delete;
+    FixedMpmcQueueBase& operator=(FixedMpmcQueueBase&&) = delete;
+
+    /**
+     * Returns false, without touching `v`, if the queue is full.
+     */
+    bool try_push(const value_type& v) { return try_emplace(v); }
+    bool try_push(value_type&& v) { return try_emplace(std::move(v)); }
+
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = slots_[slot_of(position)];
+            const std::size_t sequence = sequence_of(slot, position);
+            if (sequence == position)
+            {
+                if (enqueue_position_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed))
+                {
+                    optional_storage_detail::construct_at(&slot.storage,
+                                                          std::forward<Args>(args)...);
+                    publish(slot, position, position + 1);
+                    return true;
+                }
+                // `position` was reloaded by the failed exchange
+            }
+            else if (sequence < position)
+            {
+                // The consumer of the previous lap has not released this slot yet: full.
+                return false;
+            }
+            else
+            {
+                // Another producer took this position
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Returns std::nullopt if the queue is empty.
+     */
+    std::optional<value_type> try_pop()
+    {
+        std::size_t position = dequeue_position_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = slots_[slot_of(position)];
+            const std::size_t sequence = sequence_of(slot, position);
+            if (sequence == position + 1)
+            {
+                if (dequeue_position_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed))
+                {
+                    std::optional<value_type> out{std::move(slot.storage.value)};
+                    destroy_at(slot);
+                    publish(slot, position, position + CAPACITY);
+                    return out;
+                }
+            }
+            else if (sequence < position + 1)
+            {
+                // The producer of this position has not filled the slot yet: empty.
+                return std::nullopt;
+            }
+            else
+            {
+                // Another consumer took this position
+                position = dequeue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Size. Exact when no thread is using the queue; otherwise a snapshot that may already be
+     * stale (and that counts elements whose push or pop is still in progress).
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        // Dequeue first: it never overtakes the enqueue position, so the difference can't wrap.
+        const std::size_t dequeue_position = dequeue_position_.load(std::memory_order_acquire);
+        const std::size_t enqueue_position = enqueue_position_.load(std::memory_order_acquire);
+        return enqueue_position - dequeue_position;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    static std::size_t sequence_of(const Slot& slot, const std::size_t position)
+    {
+        return slot.relative_sequence.load(std::memory_order_acquire) + slot_of(position);
+    }
+    static void publish(Slot& slot, const std::size_t position, const std::size_t sequence)
+    {
+        slot.relative_sequence.store(sequence - slot_of(position), std::memory_order_release);
+    }
+
+    // [WORKAROUND-1] - Needed by the non-trivially-destructible flavor of FixedMpmcQueue
+protected:
+    static void destroy_at(Slot&)
+        requires TriviallyDestructible<T>
+    {
+    }
+    static void destroy_at(Slot& slot)
+        requires NotTriviallyDestructible<T>
+    {
+        slot.storage.value.~T();
+    }
+
+    // Destroys whatever is still queued. Only valid when no other thread is using the queue.
+    void destroy_remaining()
+    {
+        const std::size_t dequeue_position = dequeue_position_.load(std::memory_order_acquire);
+        const std::size_t enqueue_position = enqueue_position_.load(std::memory_order_acquire);
+        for (std::size_t i = dequeue_position; i != enqueue_position; i++)
+        {
+            destroy_at(slots_[slot_of(i)]);
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_mpmc_queue_detail
+
+namespace fixed_containers::fixed_mpmc_queue_detail::specializations
+{
+template <typename T, std::size_t CAPACITY>
+class FixedMpmcQueue : public fixed_mpmc_queue_detail::FixedMpmcQueueBase<T, CAPACITY>
+{
+    using Base = fixed_mpmc_queue_detail::FixedMpmcQueueBase<T, CAPACITY>;
+
+public:
+    constexpr FixedMpmcQueue() noexcept
+      : Base()
+    {
+    }
+
+    FixedMpmcQueue(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue(FixedMpmcQueue&&) = delete;
+    FixedMpmcQueue& operator=(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue& operator=(FixedMpmcQueue&&) = delete;
+
+    ~FixedMpmcQueue() noexcept { this->destroy_remaining(); }
+};
+
+template <TriviallyDestructible T, std::size_t CAPACITY>
+class FixedMpmcQueue<T, CAPACITY> : public fixed_mpmc_queue_detail::FixedMpmcQueueBase<T, CAPACITY>
+{
+    using Base = fixed_mpmc_queue_detail::FixedMpmcQueueBase<T, CAPACITY>;
+
+public:
+    constexpr FixedMpmcQueue() noexcept
+      : Base()
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_mpmc_queue_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity, lock-free, multi-producer/multi-consumer queue with maximum size that is
+ * declared at compile-time via template parameter. Properties:
+ *  - any number of threads may call try_push/try_emplace/try_pop concurrently
+ *  - per-slot sequence numbers, so producers and consumers only contend on their own position
+ *    counter and on the slot they are handing over
+ *  - constexpr construction, so a global queue can be `constinit` and needs no dynamic
+ *    initialization
+ *  - no pointers stored and no dynamic allocations
+ */
+template <typename T, std::size_t CAPACITY>
+class FixedMpmcQueue : public fixed_mpmc_queue_detail::specializations::FixedMpmcQueue<T, CAPACITY>
+{
+    using Base = fixed_mpmc_queue_detail::specializations::FixedMpmcQueue<T, CAPACITY>;
+
+public:
+    constexpr FixedMpmcQueue() noexcept
+      : Base()
+    {
+    }
+};
+
+}  // namespace fixed_containers
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed_containers/cache_line.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_ops.hpp"
@@ -7,9 +8,16 @@
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -30,6 +38,13 @@ namespace fixed_containers::fixed_red_black_tree_detail
 //
 // A good resource for visualizing all RedBlackTree operations as well as generating examples is:
 // https://www.cs.usfca.edu/~galles/visualization/RedBlack.html
+enum class SortedMergeKind
+{
+    UNION,
+    INTERSECTION,
+    DIFFERENCE,
+};
+
 template <class K,
           class V,
           std::size_t MAXIMUM_SIZE,
@@ -51,6 +66,11 @@ protected:  // [WORKAROUND-1]
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTreeBase>;
     friend Ops;
 
+    // Descents kept in flight by for_each_index_of_node_or_null(). Wider batches overlap more
+    // misses but add bookkeeping and branch mispredictions to every step; 4 measured best for
+    // maps of up to 64K entries (8 and 16 were slower, see fixed_map_batch_lookup_benchmark).
+    static constexpr std::size_t BATCH_LOOKUP_WIDTH = 4;
+
 public:
     using size_type = std::size_t;
     using difference_type = std::ptrdiff_t;
@@ -59,6 +79,10 @@ public:  // Public so this type is a structural type and can thus be used in tem
     TreeStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_;
     NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
     NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    // Index of the node with the greatest key, so that appending (e.g. with an end() hint) does
+    // not need a descent along the right spine. Narrowed like the node links, so that it fits in
+    // what would otherwise be padding.
+    typename TreeStorage::NodeIndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_;
     Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{};
 
 public:
@@ -71,6 +95,8 @@ public:
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_{}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{NULL_INDEX}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_{
+            narrow_node_index<typename TreeStorage::NodeIndexType>(NULL_INDEX)}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
     {
     }
@@ -85,7 +111,19 @@ public:
 
     constexpr void clear() noexcept
     {
-        delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
+        // When there is nothing to destroy, the pool can forget all nodes in O(1)
+        if constexpr (TreeStorage::HAS_FREE_LIST && std::is_trivially_destructible_v<K> &&
+                      std::is_trivially_destructible_v<V>)
+        {
+            tree_storage().reset();
+            set_root_index(NULL_INDEX);
+            set_max_index(NULL_INDEX);
+            set_size(0);
+        }
+        else
+        {
+            delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
+        }
     }
 
     constexpr void insert_node(const K& key) noexcept
@@ -138,6 +176,7 @@ public:
         if (np.parent == NULL_INDEX)
         {
             set_root_index(np.i);
+            set_max_index(np.i);
             fix_after_insertion(root_index());
             return;
         }
@@ -150,11 +189,736 @@ public:
         else
         {
             parent.set_right_index(np.i);
+            // Rotations relink nodes but never change their index, so this stays valid
+            if (np.parent == max_index())
+            {
+                set_max_index(np.i);
+            }
         }
+        add_to_subtree_sizes_up_to_root(np.parent, 1);
 
         fix_after_insertion(np.i);
     }
 
+    // Builds the tree out of `count` entries that are sorted and unique according to Compare,
+    // in linear time and without any rotations. The shape is the one obtained by recursively
+    // picking the middle entry as the root, so every level is full except possibly the last one.
+    // Coloring that last level red (when it is not full) and everything else black satisfies all
+    // red-black invariants.
+    //
+    // Entries are emplaced in sorted order, so for storages that hand out indexes sequentially
+    // (FixedIndexBasedContiguousStorage, or a FixedIndexBasedPoolStorage that was never erased
+    // from) the nodes end up contiguous in memory in iteration order.
+    //
+    // The traversal uses an explicit stack bounded by the height of the tree instead of recursion.
+    // For maps, each entry must have `.first` and `.second` (e.g. std::pair).
+    template <class InputIt>
+    constexpr void build_from_sorted_unique(InputIt first, const std::size_t count) noexcept
+    {
+        assert(empty());
+        assert(count <= MAXIMUM_SIZE);
+        link_as_balanced_tree(count,
+                              [this, &first]()
+                              {
+                                  const NodeIndex i = emplace_entry(*first);
+                                  std::advance(first, 1);
+                                  return i;
+                              });
+        increment_size(count);
+    }
+
+    // Linear-time set algebra. Both work by merging the in-order sequences into a list of nodes
+    // and linking that list as a balanced tree (see build_from_sorted_unique()), so there is no
+    // per-entry descent or rebalancing.
+    //
+    // Fills this empty tree with copies of the entries in the union, intersection or difference
+    // of `a` and `b`. Entries are copied from `a`, except for the ones that are only in `b`.
+    // Returns false if the result did not fit, in which case this holds its first MAXIMUM_SIZE
+    // entries.
+    constexpr bool assign_merged(const FixedRedBlackTreeBase& a,
+                                 const FixedRedBlackTreeBase& b,
+                                 const SortedMergeKind kind) noexcept
+    {
+        assert(empty());
+        SortedNodeList merged{};
+        bool fits = true;
+        const auto copy_into_merged = [this, &merged, &fits](const FixedRedBlackTreeBase& source,
+                                                             const NodeIndex& k)
+        {
+            if (merged.count == MAXIMUM_SIZE)
+            {
+                fits = false;
+                return;
+            }
+            append_to_sorted_list(merged, emplace_copy_of(source, k));
+        };
+
+        NodeIndex i = a.index_of_min_at();
+        NodeIndex j = b.index_of_min_at();
+        while (fits && i != NULL_INDEX && j != NULL_INDEX)
+        {
+            const int cmp = compare(a.tree_storage().key(i), b.tree_storage().key(j));
+            if (cmp < 0)
+            {
+                if (kind != SortedMergeKind::INTERSECTION)
+                {
+                    copy_into_merged(a, i);
+                }
+                i = a.index_of_successor_at(i);
+            }
+            else if (cmp > 0)
+            {
+                if (kind == SortedMergeKind::UNION)
+                {
+                    copy_into_merged(b, j);
+                }
+                j = b.index_of_successor_at(j);
+            }
+            else
+            {
+                if (kind != SortedMergeKind::DIFFERENCE)
+                {
+                    copy_into_merged(a, i);
+                }
+                i = a.index_of_successor_at(i);
+                j = b.index_of_successor_at(j);
+            }
+        }
+        for (; fits && i != NULL_INDEX && kind != SortedMergeKind::INTERSECTION;
+             i = a.index_of_successor_at(i))
+        {
+            copy_into_merged(a, i);
+        }
+        for (; fits && j != NULL_INDEX && kind == SortedMergeKind::UNION;
+             j = b.index_of_successor_at(j))
+        {
+            copy_into_merged(b, j);
+        }
+
+        build_from_sorted_list(merged);
+        return fits;
+    }
+
+    // Moves the entries of `other` whose key is not in this tree into it, and leaves the others in
+    // `other` (as std::set::merge() does). Existing nodes of this tree are relinked but never
+    // moved, so their indexes stay valid.
+    // Returns false if not everything fit, in which case `other` keeps what did not.
+    constexpr bool merge_from(FixedRedBlackTreeBase& other) noexcept
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        std::size_t merged_size = size();
+        NodeIndex i = flatten_to_sorted_list().head;
+        NodeIndex j = other.flatten_to_sorted_list().head;
+        SortedNodeList merged{};
+        SortedNodeList kept{};
+        SortedNodeList moved_out{};
+        bool fits = true;
+        while (j != NULL_INDEX)
+        {
+            const NodeIndex next_j = other.tree_storage().right_index(j);
+            if (i != NULL_INDEX)
+            {
+                const int cmp = compare(tree_storage().key(i), other.tree_storage().key(j));
+                if (cmp < 0)
+                {
+                    const NodeIndex next_i = tree_storage().right_index(i);
+                    append_to_sorted_list(merged, i);
+                    i = next_i;
+                    continue;
+                }
+                if (cmp == 0)
+                {
+                    other.append_to_sorted_list(kept, j);
+                    j = next_j;
+                    continue;
+                }
+            }
+
+            if (merged_size == MAXIMUM_SIZE)
+            {
+                fits = false;
+                other.append_to_sorted_list(kept, j);
+            }
+            else
+            {
+                merged_size++;
+                append_to_sorted_list(merged, emplace_moved_from(other, j));
+                other.append_to_sorted_list(moved_out, j);
+            }
+            j = next_j;
+        }
+        while (i != NULL_INDEX)
+        {
+            const NodeIndex next_i = tree_storage().right_index(i);
+            append_to_sorted_list(merged, i);
+            i = next_i;
+        }
+
+        build_from_sorted_list(merged);
+        other.delete_sorted_list(
+            moved_out,
+            [&other, &kept](const NodeIndex& old_index, const NodeIndex& new_index)
+            {
+                other.fixup_repositioned_index(kept.head, old_index, new_index);
+                other.fixup_repositioned_index(kept.tail, old_index, new_index);
+            });
+        other.build_from_sorted_list(kept);
+        return fits;
+    }
+
+    // Inserts the entries of a range that is sorted and unique according to Compare, in linear
+    // time, by merging them into the sorted list of the existing nodes, as merge_from() does
+    // with another tree. Existing nodes are relinked but never moved, and entries whose key is
+    // already present are not inserted.
+    // Returns false if not everything fit, in which case the entries that did not fit are not
+    // inserted either.
+    template <class ForwardIt>
+    constexpr bool merge_sorted_unique(ForwardIt first, const ForwardIt last) noexcept
+    {
+        std::size_t merged_size = size();
+        NodeIndex i = flatten_to_sorted_list().head;
+        SortedNodeList merged{};
+        bool fits = true;
+        for (; first != last; std::advance(first, 1))
+        {
+            const auto& entry = *first;
+            int cmp = -1;
+            while (i != NULL_INDEX && (cmp = compare(tree_storage().key(i), key_of(entry))) < 0)
+            {
+                const NodeIndex next_i = tree_storage().right_index(i);
+                append_to_sorted_list(merged, i);
+                i = next_i;
+            }
+            if (i != NULL_INDEX && cmp == 0)
+            {
+                continue;
+            }
+
+            if (merged_size == MAXIMUM_SIZE)
+            {
+                fits = false;
+                break;
+            }
+            merged_size++;
+            append_to_sorted_list(merged, emplace_entry(entry));
+        }
+        while (i != NULL_INDEX)
+        {
+            const NodeIndex next_i = tree_storage().right_index(i);
+            append_to_sorted_list(merged, i);
+            i = next_i;
+        }
+
+        build_from_sorted_list(merged);
+        return fits;
+    }
+
+    // Split/join. A tree can be taken apart into detached subtrees and put back together in
+    // O(log n), which is what makes delete_range_and_return_successor() independent of the length
+    // of the range. Detached subtrees stay in the storage of this tree (and are still counted by
+    // size()) but are not reachable from the root. They are identified by their root and their
+    // black height, so that joins do not have to measure it again.
+    struct Subtree
+    {
+        NodeIndex root = NULL_INDEX;
+        std::size_t black_height = 0;
+    };
+    struct SplitSubtrees
+    {
+        Subtree less{};
+        NodeIndex pivot = NULL_INDEX;
+        Subtree greater{};
+    };
+
+    // Detaches all nodes into the ones less than `key`, the node with that key (NULL_INDEX if not
+    // present) and the ones greater than it. The tree is left without a root until join() is used.
+    template <class K0>
+    constexpr SplitSubtrees split(const K0& key) noexcept
+    {
+        return split_along_path_to(index_of_node_with_parent(key));
+    }
+
+    // Same as split(), around the node at `i`. Also works if `i` is in a detached subtree, in
+    // which case only that subtree is split.
+    constexpr SplitSubtrees split_at(const NodeIndex& i) noexcept
+    {
+        assert(i != NULL_INDEX);
+        const NodeIndex parent = tree_storage().parent_index(i);
+        return split_along_path_to(
+            {.i = i,
+             .parent = parent,
+             .is_left_child = parent == NULL_INDEX || tree_storage().left_index(parent) == i});
+    }
+
+    // Links `less`, the node at `pivot` and `greater`, which must be detached and ordered, as one
+    // subtree. That subtree also becomes the root of the tree.
+    constexpr Subtree join(const Subtree& less,
+                           const NodeIndex& pivot,
+                           const Subtree& greater) noexcept
+    {
+        const Subtree out = join_subtrees(less, pivot, greater);
+        set_max_index(index_of_max_at(root_index()));
+        return out;
+    }
+
+    // Storage layout maintenance. Erasing and inserting in a storage with a free list hands out
+    // slots in whatever order they were freed, so over time neighbours in iteration order end up
+    // scattered across the storage.
+    //
+    // Number of nodes whose in-order successor is not stored right after them. It is 0 when
+    // iterating walks the storage linearly.
+    [[nodiscard]] constexpr std::size_t fragmentation() const noexcept
+    {
+        std::size_t out = 0;
+        for (NodeIndex i = index_of_min_at(); i != NULL_INDEX;)
+        {
+            const NodeIndex successor = index_of_successor_at(i);
+            if (successor != NULL_INDEX && successor != i + 1)
+            {
+                out++;
+            }
+            i = successor;
+        }
+        return out;
+    }
+
+    // Relocates nodes so that the one with rank r is stored at index r, which brings
+    // fragmentation() down to 0. Moves at most `max_moves` nodes, and returns whether the layout
+    // is complete, so that it can be spread over several calls. Every call walks all the nodes
+    // (and the free list while some nodes are stored past index size()), but that is cheap
+    // compared to the moves once the layout is mostly in order.
+    //
+    // Nodes move, so this invalidates all indexes into the tree, even for storages that otherwise
+    // never reposition nodes.
+    constexpr bool compact_in_order(std::size_t max_moves) noexcept
+    {
+        const std::size_t count = size();
+        if constexpr (TreeStorage::HAS_FREE_LIST)
+        {
+            // First, move the nodes stored at or past `count` into the free slots below it, so
+            // that the nodes occupy exactly [0, count). There are as many such free slots as
+            // there are such nodes.
+            std::size_t previous_free = MAXIMUM_SIZE;
+            std::size_t free = tree_storage().first_free_index();
+            for (NodeIndex i = index_of_min_at(); i != NULL_INDEX; i = index_of_successor_at(i))
+            {
+                if (i < count)
+                {
+                    continue;
+                }
+                if (max_moves == 0)
+                {
+                    return false;
+                }
+                while (free >= count)
+                {
+                    assert(free != MAXIMUM_SIZE);
+                    previous_free = free;
+                    free = tree_storage().next_free_index(free);
+                }
+
+                // The vacated index takes the place of `free` in the free list
+                const NodeIndex vacated = i;
+                tree_storage().move_to_free_slot(vacated, free, previous_free);
+                Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
+                    *this, tree_storage_at(free), vacated, free);
+                fixup_repositioned_index(
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, vacated, free);
+                if (max_index() == vacated)
+                {
+                    set_max_index(free);
+                }
+                i = free;
+                previous_free = vacated;
+                free = tree_storage().next_free_index(vacated);
+                max_moves--;
+            }
+        }
+
+        // Then, swap every node with the one stored where it belongs. All indexes below `count`
+        // hold nodes at this point, and the ones below `rank` are already in place.
+        std::size_t rank = 0;
+        for (NodeIndex i = index_of_min_at(); i != NULL_INDEX; i = index_of_successor_at(i))
+        {
+            if (i != rank)
+            {
+                if (max_moves == 0)
+                {
+                    return false;
+                }
+                // Exchange the positions of the two nodes in the tree, then their contents
+                Ops::swap_nodes_excluding_key_and_value(*this, i, rank);
+                using std::swap;
+                swap(tree_storage().key(i), tree_storage().key(rank));
+                if constexpr (HAS_ASSOCIATED_VALUE)
+                {
+                    swap(tree_storage().value(i), tree_storage().value(rank));
+                }
+                if (max_index() == i || max_index() == rank)
+                {
+                    set_max_index(max_index() == i ? rank : i);
+                }
+                i = rank;
+                max_moves--;
+            }
+            rank++;
+        }
+        return true;
+    }
+
+private:
+    // Nodes linked in iteration order through their right index, with their parent index pointing
+    // to the previous node. This is only used transiently, while nodes are not part of the tree.
+    struct SortedNodeList
+    {
+        NodeIndex head = NULL_INDEX;
+        NodeIndex tail = NULL_INDEX;
+        std::size_t count = 0;
+    };
+
+    constexpr void append_to_sorted_list(SortedNodeList& list, const NodeIndex& i)
+    {
+        RedBlackTreeNodeView node = tree_storage_at(i);
+        node.set_parent_index(list.tail);
+        node.set_left_index(NULL_INDEX);
+        node.set_right_index(NULL_INDEX);
+        if (list.tail == NULL_INDEX)
+        {
+            list.head = i;
+        }
+        else
+        {
+            tree_storage().set_right_index(list.tail, i);
+        }
+        list.tail = i;
+        list.count++;
+    }
+
+    // Unlinks all nodes of the subtree at `subtree_root` and appends them to `list`, in linear time
+    // and without extra space. This is the "tree to vine" step of the Day-Stout-Warren algorithm:
+    // right rotations until no node has a left child.
+    constexpr void append_subtree_to_sorted_list(SortedNodeList& list,
+                                                 const NodeIndex& subtree_root)
+    {
+        NodeIndex rest = subtree_root;
+        while (rest != NULL_INDEX)
+        {
+            RedBlackTreeNodeView node = tree_storage_at(rest);
+            const NodeIndex left = node.left_index();
+            if (left == NULL_INDEX)
+            {
+                const NodeIndex next = node.right_index();
+                append_to_sorted_list(list, rest);
+                rest = next;
+                continue;
+            }
+
+            RedBlackTreeNodeView left_node = tree_storage_at(left);
+            node.set_left_index(left_node.right_index());
+            left_node.set_right_index(rest);
+            rest = left;
+        }
+    }
+
+    // Unlinks all nodes into a sorted list. The tree is left empty, and the nodes must be linked
+    // back with build_from_sorted_list() or deleted.
+    constexpr SortedNodeList flatten_to_sorted_list()
+    {
+        SortedNodeList list{};
+        append_subtree_to_sorted_list(list, root_index());
+        set_root_index(NULL_INDEX);
+        set_max_index(NULL_INDEX);
+        set_size(0);
+        return list;
+    }
+
+    constexpr void build_from_sorted_list(const SortedNodeList& list)
+    {
+        assert(empty());
+        NodeIndex cursor = list.head;
+        link_as_balanced_tree(list.count,
+                              [this, &cursor]()
+                              {
+                                  const NodeIndex i = cursor;
+                                  cursor = tree_storage().right_index(i);
+                                  return i;
+                              });
+        increment_size(list.count);
+    }
+
+    // Removes the nodes of `doomed` from the storage. Storages that reposition nodes on deletion
+    // may move any other node, whose neighbours (and the root index) are kept up to date.
+    // `on_repositioned(old_index, new_index)` is called for every move, so that the caller can
+    // update the indexes it holds.
+    template <class OnRepositioned>
+    constexpr void delete_sorted_list(SortedNodeList& doomed, OnRepositioned&& on_repositioned)
+    {
+        NodeIndex i = doomed.head;
+        while (i != NULL_INDEX)
+        {
+            NodeIndex next = tree_storage().right_index(i);
+            if (next != NULL_INDEX)
+            {
+                // So that no node refers to the deleted one
+                tree_storage().set_parent_index(next, NULL_INDEX);
+            }
+
+            const NodeIndex repositioned =
+                tree_storage().delete_at_and_return_repositioned_index(i);
+            if (repositioned != i)
+            {
+                Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
+                    *this, tree_storage_at(i), repositioned, i);
+                fixup_repositioned_index(
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, repositioned, i);
+                fixup_repositioned_index(next, repositioned, i);
+                on_repositioned(repositioned, i);
+            }
+            i = next;
+        }
+        doomed = {};
+    }
+
+    [[nodiscard]] constexpr std::size_t black_height_of(const NodeIndex& i) const
+    {
+        std::size_t black_height = 0;
+        for (NodeIndex j = i; j != NULL_INDEX; j = tree_storage().left_index(j))
+        {
+            if (tree_storage().color(j) == COLOR_BLACK)
+            {
+                black_height++;
+            }
+        }
+        return black_height;
+    }
+
+    // Same as join(), without updating the index of the maximum. The pivot is placed on the inner
+    // spine of the taller side, so the cost is proportional to the difference in black heights.
+    constexpr Subtree join_subtrees(Subtree less, const NodeIndex& pivot, Subtree greater) noexcept
+    {
+        assert(parent_index_of(less.root) == NULL_INDEX);
+        assert(parent_index_of(greater.root) == NULL_INDEX);
+
+        // Any red root can be made black, it only adds one to the black height
+        for (Subtree* subtree : {&less, &greater})
+        {
+            if (color_of(subtree->root) == COLOR_RED)
+            {
+                tree_storage().set_color(subtree->root, COLOR_BLACK);
+                subtree->black_height++;
+            }
+        }
+
+        const bool into_less = less.black_height >= greater.black_height;
+        const Subtree& taller = into_less ? less : greater;
+        const Subtree& shorter = into_less ? greater : less;
+
+        // Find the first black node of the spine that has the black height of the shorter side.
+        // Replacing it with a red pivot that has both of them as children keeps all black heights
+        // equal, and leaves at most a red-red violation with the parent.
+        NodeIndex parent = NULL_INDEX;
+        NodeIndex i = taller.root;
+        std::size_t black_height = taller.black_height;
+        while (color_of(i) == COLOR_RED || black_height != shorter.black_height)
+        {
+            assert(i != NULL_INDEX);
+            if (color_of(i) == COLOR_BLACK)
+            {
+                black_height--;
+            }
+            parent = i;
+            i = into_less ? right_index_of(i) : left_index_of(i);
+        }
+
+        RedBlackTreeNodeView node = tree_storage_at(pivot);
+        node.set_parent_index(parent);
+        node.set_left_index(into_less ? i : shorter.root);
+        node.set_right_index(into_less ? shorter.root : i);
+        for (const NodeIndex& child : {i, shorter.root})
+        {
+            if (child != NULL_INDEX)
+            {
+                tree_storage().set_parent_index(child, pivot);
+            }
+        }
+        recompute_subtree_size(pivot);
+
+        if (parent == NULL_INDEX)
+        {
+            set_root_index(pivot);
+        }
+        else
+        {
+            set_root_index(taller.root);
+            if (into_less)
+            {
+                tree_storage().set_right_index(parent, pivot);
+            }
+            else
+            {
+                tree_storage().set_left_index(parent, pivot);
+            }
+            if constexpr (TreeStorage::HAS_SUBTREE_SIZES)
+            {
+                add_to_subtree_sizes_up_to_root(
+                    parent, static_cast<std::ptrdiff_t>(subtree_size_of(shorter.root) + 1));
+            }
+        }
+
+        const bool black_height_grew = fix_after_insertion(pivot);
+        return {root_index(), taller.black_height + (black_height_grew ? 1 : 0)};
+    }
+
+    // Splits bottom-up along the path from the root to `np`. At every node of that path, the node
+    // and its subtree on the other side are joined to the side of the split they belong to.
+    // Subtrees joined this way grow in black height as the path goes up, so all the joins
+    // together cost O(log n).
+    constexpr SplitSubtrees split_along_path_to(const NodeIndexAndParentIndex& np) noexcept
+    {
+        const auto detached = [this](const NodeIndex& i, const std::size_t black_height)
+        {
+            if (i != NULL_INDEX)
+            {
+                tree_storage().set_parent_index(i, NULL_INDEX);
+            }
+            return Subtree{i, black_height};
+        };
+
+        SplitSubtrees out{.less = {}, .pivot = np.i, .greater = {}};
+        // Black height of the subtree that the path goes through at the current level, as it was
+        // before the split. Both children of a node have the same black height, so this is also
+        // the black height of the subtree on the other side.
+        std::size_t path_black_height = 0;
+        if (np.i != NULL_INDEX)
+        {
+            RedBlackTreeNodeView node = tree_storage_at(np.i);
+            path_black_height = black_height_of(np.i);
+            const std::size_t children_black_height =
+                path_black_height - (node.color() == COLOR_BLACK ? 1 : 0);
+            out.less = detached(node.left_index(), children_black_height);
+            out.greater = detached(node.right_index(), children_black_height);
+            node.set_parent_index(NULL_INDEX);
+            node.set_left_index(NULL_INDEX);
+            node.set_right_index(NULL_INDEX);
+        }
+
+        NodeIndex i = np.parent;
+        bool path_is_left_child = np.is_left_child;
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            const NodeIndex parent = node.parent_index();
+            const bool is_left_child =
+                parent == NULL_INDEX || tree_storage().left_index(parent) == i;
+            const bool is_black = node.color() == COLOR_BLACK;
+            if (path_is_left_child)
+            {
+                out.greater = join_subtrees(
+                    out.greater, i, detached(node.right_index(), path_black_height));
+            }
+            else
+            {
+                out.less =
+                    join_subtrees(detached(node.left_index(), path_black_height), i, out.less);
+            }
+            path_black_height += is_black ? 1 : 0;
+            path_is_left_child = is_left_child;
+            i = parent;
+        }
+
+        set_root_index(NULL_INDEX);
+        set_max_index(NULL_INDEX);
+        return out;
+    }
+
+    // Links `count` nodes, handed out in iteration order by `next_node()`, as a balanced tree
+    template <class NextNode>
+    constexpr void link_as_balanced_tree(const std::size_t count, NextNode&& next_node)
+    {
+        struct PendingNode
+        {
+            std::size_t begin;
+            std::size_t end;
+            std::size_t depth;
+            NodeIndex right_child_of;
+            NodeIndex left_child;
+            bool is_left_child;
+        };
+
+        const std::size_t red_depth =
+            std::has_single_bit(count + 1) ? NULL_INDEX : std::bit_width(count) - 1;
+
+        std::array<PendingNode, std::bit_width(MAXIMUM_SIZE) + 1> stack{};
+        std::size_t stack_size = 0;
+        PendingNode current{0, count, 0, NULL_INDEX, NULL_INDEX, false};
+        // The last node is the maximum
+        NodeIndex previous = NULL_INDEX;
+        while (true)
+        {
+            // Descend to the leftmost pending node
+            while (current.begin < current.end)
+            {
+                stack[stack_size] = current;
+                stack_size++;
+                const std::size_t mid = current.begin + (current.end - current.begin - 1) / 2;
+                current = {current.begin, mid, current.depth + 1, NULL_INDEX, NULL_INDEX, true};
+            }
+
+            if (stack_size == 0)
+            {
+                break;
+            }
+
+            stack_size--;
+            const PendingNode pending = stack[stack_size];
+            const std::size_t mid = pending.begin + (pending.end - pending.begin - 1) / 2;
+
+            const NodeIndex i = next_node();
+            assert(previous == NULL_INDEX ||
+                   compare(tree_storage().key(previous), tree_storage().key(i)) < 0);
+            previous = i;
+
+            RedBlackTreeNodeView node_i = tree_storage_at(i);
+            node_i.set_color(pending.depth == red_depth ? COLOR_RED : COLOR_BLACK);
+            if constexpr (TreeStorage::HAS_SUBTREE_SIZES)
+            {
+                node_i.set_subtree_size(pending.end - pending.begin);
+            }
+            node_i.set_left_index(pending.left_child);
+            node_i.set_right_index(NULL_INDEX);
+            if (pending.left_child != NULL_INDEX)
+            {
+                tree_storage().set_parent_index(pending.left_child, i);
+            }
+
+            if (pending.is_left_child)
+            {
+                // The parent is still pending and directly below on the stack. It will set our
+                // parent index when it gets emplaced.
+                stack[stack_size - 1].left_child = i;
+            }
+            else if (pending.right_child_of != NULL_INDEX)
+            {
+                node_i.set_parent_index(pending.right_child_of);
+                tree_storage().set_right_index(pending.right_child_of, i);
+            }
+            else
+            {
+                node_i.set_parent_index(NULL_INDEX);
+                set_root_index(i);
+            }
+
+            current = {mid + 1, pending.end, pending.depth + 1, i, NULL_INDEX, false};
+        }
+        set_max_index(previous);
+    }
+
+public:
+
     constexpr size_type delete_node(const K& key) noexcept
     {
         const NodeIndex i = index_of_node_or_null(key);
@@ -172,6 +936,9 @@ public:
         return delete_at_and_return_successor_and_repositioned(i).successor;
     }
 
+    // Detaches [from_index, to_index) with split_at(), joins what is left back around `to_index`
+    // and deletes the detached nodes in one pass. There is no rebalancing per deleted node, so this
+    // is O(log n + k) for k deleted nodes.
     constexpr NodeIndex delete_range_and_return_successor(const NodeIndex& from_index,
                                                           const NodeIndex& to_index) noexcept
     {
@@ -180,23 +947,39 @@ public:
             assert(compare(tree_storage().key(from_index), tree_storage().key(to_index)) <= 0);
         }
 
-        NodeIndex i = from_index;
         NodeIndex to = to_index;
-
-        while (i != to)
+        if (from_index == to)
         {
-            SuccessorIndexAndRepositionedIndex d =
-                delete_at_and_return_successor_and_repositioned(i);
-            if (empty())
-            {
-                break;
-            }
+            return to;
+        }
+        assert(from_index != NULL_INDEX);
 
-            fixup_repositioned_index(to, d.repositioned, i);
+        SplitSubtrees around_to{};
+        if (to != NULL_INDEX)
+        {
+            around_to = split_at(to);
+        }
+        // `from_index` is in `around_to.less`, or in the whole tree if `to` is past-the-end
+        const SplitSubtrees around_from = split_at(from_index);
 
-            i = d.successor;
+        if (to != NULL_INDEX)
+        {
+            join_subtrees(around_from.less, to, around_to.greater);
+        }
+        else
+        {
+            set_root_index(around_from.less.root);
+            set_color(root_index(), COLOR_BLACK);
         }
 
+        SortedNodeList doomed{};
+        append_to_sorted_list(doomed, from_index);
+        append_subtree_to_sorted_list(doomed, around_from.greater.root);
+        decrement_size(doomed.count);
+        delete_sorted_list(doomed,
+                           [this, &to](const NodeIndex& old_index, const NodeIndex& new_index)
+                           { fixup_repositioned_index(to, old_index, new_index); });
+        set_max_index(index_of_max_at(root_index()));
         return to;
     }
 
@@ -204,6 +987,10 @@ public:
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
     }
+    [[nodiscard]] constexpr NodeIndex max_index() const
+    {
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_);
+    }
     constexpr RedBlackTreeNodeView<const TreeStorage> node_at(const NodeIndex& i) const
     {
         return tree_storage_at(i);
@@ -243,12 +1030,188 @@ public:
         return np;
     }
 
+    // Same result as index_of_node_with_parent(), but first tries to place `key` right next to
+    // the node at `hint` (NULL_INDEX meaning past-the-end). When the hint and its in-order
+    // neighbour bracket the key, the attachment point is one of those two nodes and no descent
+    // from the root is needed. Otherwise, falls back to the regular lookup.
+    //
+    // Appending after the maximum (ascending keys, with end() or the previously inserted entry as
+    // the hint) is O(1), since the maximum is tracked and has no successor. Other hints need the
+    // in-order neighbour, which is O(1) amortized over a traversal but O(log n) in the worst case.
+    template <class K0>
+    constexpr NodeIndexAndParentIndex index_of_node_with_parent_near(const NodeIndex& hint,
+                                                                     const K0& key) const
+    {
+        const auto& tree = this->tree_storage();
+        if (hint == NULL_INDEX || hint == max_index())
+        {
+            if (max_index() == NULL_INDEX)
+            {
+                return {.i = NULL_INDEX, .parent = NULL_INDEX, .is_left_child = true};
+            }
+            if (compare(key, tree.key(max_index())) > 0)
+            {
+                return {.i = NULL_INDEX, .parent = max_index(), .is_left_child = false};
+            }
+            if (hint == NULL_INDEX)
+            {
+                return index_of_node_with_parent(key);
+            }
+        }
+
+        const int cmp = compare(key, tree.key(hint));
+        if (cmp < 0)
+        {
+            const NodeIndex predecessor = index_of_predecessor_at(hint);
+            if (predecessor == NULL_INDEX || compare(key, tree.key(predecessor)) > 0)
+            {
+                // If the hint has a left subtree, its predecessor is the maximum of that subtree
+                // and has no right child.
+                if (tree.left_index(hint) == NULL_INDEX)
+                {
+                    return {.i = NULL_INDEX, .parent = hint, .is_left_child = true};
+                }
+                return {.i = NULL_INDEX, .parent = predecessor, .is_left_child = false};
+            }
+            return index_of_node_with_parent(key);
+        }
+        if (cmp > 0)
+        {
+            const NodeIndex successor = index_of_successor_at(hint);
+            if (successor == NULL_INDEX || compare(key, tree.key(successor)) < 0)
+            {
+                if (tree.right_index(hint) == NULL_INDEX)
+                {
+                    return {.i = NULL_INDEX, .parent = hint, .is_left_child = false};
+                }
+                return {.i = NULL_INDEX, .parent = successor, .is_left_child = true};
+            }
+            return index_of_node_with_parent(key);
+        }
+
+        // cmp == 0, the hint is the existing entry
+        const NodeIndex parent = tree.parent_index(hint);
+        return {.i = hint,
+                .parent = parent,
+                .is_left_child = parent == NULL_INDEX || tree.left_index(parent) == hint};
+    }
+
     template <class K0>
     constexpr NodeIndex index_of_node_or_null(const K0& key) const
     {
         return index_of_node_with_parent(key).i;
     }
 
+    // Calls `consumer(j, index_of_node_or_null(keys[j]))` for every j, in order.
+    //
+    // A single descent is a chain of dependent loads: the next node is only known once the
+    // current one has arrived from memory. Here, up to BATCH_LOOKUP_WIDTH descents advance one
+    // level at a time in lockstep, and the node that each of them visits next is prefetched right
+    // away. By the time a descent is advanced again, its node is likely in the cache, and the
+    // misses of independent descents overlap instead of adding up.
+    //
+    // To keep the lockstep loop uniform, every descent goes all the way down with a single
+    // comparison per level (as lower_bound does), and equality is only checked at the end.
+    template <class K0, class Consumer>
+    constexpr void for_each_index_of_node_or_null(const std::span<const K0> keys,
+                                                  Consumer&& consumer) const
+    {
+        for (std::size_t begin = 0; begin < keys.size(); begin += BATCH_LOOKUP_WIDTH)
+        {
+            const std::size_t count = (std::min)(BATCH_LOOKUP_WIDTH, keys.size() - begin);
+            std::array<NodeIndex, BATCH_LOOKUP_WIDTH> cursors{};
+            // Smallest node not less than the key, among the ones visited so far
+            std::array<NodeIndex, BATCH_LOOKUP_WIDTH> candidates{};
+            for (std::size_t j = 0; j < count; j++)
+            {
+                cursors[j] = root_index();
+                candidates[j] = NULL_INDEX;
+            }
+
+            bool any_in_flight = root_index() != NULL_INDEX;
+            while (any_in_flight)
+            {
+                any_in_flight = false;
+                for (std::size_t j = 0; j < count; j++)
+                {
+                    if (cursors[j] == NULL_INDEX)
+                    {
+                        continue;
+                    }
+                    const RedBlackTreeNodeView node = tree_storage_at(cursors[j]);
+                    const bool go_right =
+                        IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), keys[begin + j]);
+                    candidates[j] = go_right ? candidates[j] : cursors[j];
+                    cursors[j] = go_right ? node.right_index() : node.left_index();
+                    if (cursors[j] != NULL_INDEX)
+                    {
+                        cache_line_detail::prefetch_for_read(&tree_storage().key(cursors[j]));
+                        any_in_flight = true;
+                    }
+                }
+            }
+
+            for (std::size_t j = 0; j < count; j++)
+            {
+                const NodeIndex candidate = candidates[j];
+                const bool found =
+                    candidate != NULL_INDEX &&
+                    !IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(keys[begin + j],
+                                                                  tree_storage().key(candidate));
+                consumer(begin + j, found ? candidate : NULL_INDEX);
+            }
+        }
+    }
+
+    // Order statistics, for storages whose nodes keep the size of their subtree.
+    // Index of the n-th smallest node (0-based), or NULL_INDEX if n >= size().
+    [[nodiscard]] constexpr NodeIndex index_of_nth_at(std::size_t n) const noexcept
+        requires TreeStorage::HAS_SUBTREE_SIZES
+    {
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            const std::size_t left_size = subtree_size_of(node.left_index());
+            if (n < left_size)
+            {
+                i = node.left_index();
+            }
+            else if (n == left_size)
+            {
+                return i;
+            }
+            else
+            {
+                n -= left_size + 1;
+                i = node.right_index();
+            }
+        }
+        return NULL_INDEX;
+    }
+    // Number of nodes whose key is less than `key`
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t rank_of(const K0& key) const noexcept
+        requires TreeStorage::HAS_SUBTREE_SIZES
+    {
+        std::size_t rank = 0;
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), key))
+            {
+                rank += subtree_size_of(node.left_index()) + 1;
+                i = node.right_index();
+            }
+            else
+            {
+                i = node.left_index();
+            }
+        }
+        return rank;
+    }
+
     [[nodiscard]] constexpr NodeIndex index_of_node_lower(
         const NodeIndexAndParentIndex& np) const noexcept
     {
@@ -373,7 +1336,8 @@ public:
     }
     [[nodiscard]] constexpr NodeIndex index_of_max_at() const noexcept
     {
-        return index_of_max_at(this->root_index());
+        assert(max_index() == index_of_max_at(this->root_index()));
+        return max_index();
     }
 
     [[nodiscard]] constexpr NodeIndex index_of_successor_at(const NodeIndex& i) const
@@ -431,7 +1395,63 @@ public:
         return s;
     }
 
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
 private:
+    constexpr NodeIndex emplace_copy_of(const FixedRedBlackTreeBase& source, const NodeIndex& k)
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return tree_storage().emplace_and_return_index(source.tree_storage().key(k),
+                                                           source.tree_storage().value(k));
+        }
+        else
+        {
+            return tree_storage().emplace_and_return_index(source.tree_storage().key(k));
+        }
+    }
+    constexpr NodeIndex emplace_moved_from(FixedRedBlackTreeBase& source, const NodeIndex& k)
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return tree_storage().emplace_and_return_index(
+                std::move(source.tree_storage().key(k)), std::move(source.tree_storage().value(k)));
+        }
+        else
+        {
+            return tree_storage().emplace_and_return_index(std::move(source.tree_storage().key(k)));
+        }
+    }
+
+    template <class Entry>
+    constexpr NodeIndex emplace_entry(const Entry& entry)
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return tree_storage().emplace_and_return_index(entry.first, entry.second);
+        }
+        else
+        {
+            return tree_storage().emplace_and_return_index(entry);
+        }
+    }
+
+    template <class Entry>
+    static constexpr const auto& key_of(const Entry& entry)
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return entry.first;
+        }
+        else
+        {
+            return entry;
+        }
+    }
+
     constexpr void increment_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
@@ -483,6 +1503,37 @@ private:
         if (i == NULL_INDEX) return;
         tree_storage().set_color(i, color);
     }
+    [[nodiscard]] constexpr std::size_t subtree_size_of(const NodeIndex& i) const
+        requires TreeStorage::HAS_SUBTREE_SIZES
+    {
+        return i == NULL_INDEX ? 0 : tree_storage().subtree_size(i);
+    }
+
+    // Subtree size maintenance. All of these are no-ops for storages that do not track them.
+    constexpr void recompute_subtree_size(const NodeIndex& i)
+    {
+        if constexpr (TreeStorage::HAS_SUBTREE_SIZES)
+        {
+            tree_storage().set_subtree_size(i,
+                                             subtree_size_of(tree_storage().left_index(i)) +
+                                                 subtree_size_of(tree_storage().right_index(i)) +
+                                                 1);
+        }
+    }
+    constexpr void add_to_subtree_sizes_up_to_root([[maybe_unused]] const NodeIndex& from,
+                                                   [[maybe_unused]] const std::ptrdiff_t delta)
+    {
+        if constexpr (TreeStorage::HAS_SUBTREE_SIZES)
+        {
+            for (NodeIndex i = from; i != NULL_INDEX; i = tree_storage().parent_index(i))
+            {
+                tree_storage().set_subtree_size(
+                    i,
+                    static_cast<std::size_t>(
+                        static_cast<std::ptrdiff_t>(tree_storage().subtree_size(i)) + delta));
+            }
+        }
+    }
 
     constexpr void rotate_left(const NodeIndex& i)
     {
@@ -517,6 +1568,10 @@ private:
 
         right.set_left_index(i);
         node.set_parent_index(r);
+
+        // `i` is now the left child of `r`, so its size must be recomputed first
+        recompute_subtree_size(i);
+        recompute_subtree_size(r);
     }
 
     constexpr void rotate_right(const NodeIndex& i)
@@ -552,9 +1607,13 @@ private:
 
         left.set_right_index(i);
         node.set_parent_index(l);
+
+        recompute_subtree_size(i);
+        recompute_subtree_size(l);
     }
 
-    constexpr void fix_after_insertion(const NodeIndex& index_of_newly_added)
+    // Returns whether the root had to be recolored, which adds one to the black height of the tree
+    constexpr bool fix_after_insertion(const NodeIndex& index_of_newly_added)
     {
         NodeIndex i = index_of_newly_added;
         tree_storage().set_color(i, COLOR_RED);
@@ -608,7 +1667,10 @@ private:
             }
         }
 
-        tree_storage_at(root_index()).set_color(COLOR_BLACK);
+        RedBlackTreeNodeView root = tree_storage_at(root_index());
+        const bool root_was_red = root.color() == COLOR_RED;
+        root.set_color(COLOR_BLACK);
+        return root_was_red;
     }
 
     constexpr SuccessorIndexAndRepositionedIndex delete_at_and_return_successor_and_repositioned(
@@ -621,6 +1683,7 @@ private:
         {
             tree_storage().delete_at_and_return_repositioned_index(i);
             set_root_index(NULL_INDEX);
+            set_max_index(NULL_INDEX);
             set_size(0);
             return {NULL_INDEX, NULL_INDEX};
         }
@@ -628,6 +1691,12 @@ private:
         decrement_size();
         const NodeIndex index_to_delete = i;
         const NodeIndex successor_index = index_of_successor_at(index_to_delete);
+        if (index_to_delete == max_index())
+        {
+            // The maximum has no right child, so its predecessor is either its only (left) child
+            // or its parent
+            set_max_index(index_of_predecessor_at(index_to_delete));
+        }
 
         // The canonical way to handle the case where the node_for_deletion has two children is to
         // move successor's element to the original deletion spot, then proceed to delete the
@@ -678,6 +1747,9 @@ private:
                 parent_node.set_right_index(replacement_node_index);
             }
 
+            // The rebalancing below relies on the sizes of the remaining nodes being correct
+            add_to_subtree_sizes_up_to_root(node_to_delete.parent_index(), -1);
+
             node_to_delete.set_parent_index(NULL_INDEX);
             node_to_delete.set_left_index(NULL_INDEX);
             node_to_delete.set_right_index(NULL_INDEX);
@@ -698,6 +1770,7 @@ private:
 
             if (node_to_delete.parent_index() != NULL_INDEX)
             {
+                add_to_subtree_sizes_up_to_root(node_to_delete.parent_index(), -1);
                 RedBlackTreeNodeView parent_node = tree_storage_at(node_to_delete.parent_index());
                 if (index_to_delete == parent_node.left_index())
                 {
@@ -722,6 +1795,10 @@ private:
                 *this, tree_storage_at(index_to_delete), ret.repositioned, index_to_delete);
             fixup_repositioned_index(
                 IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, ret.repositioned, index_to_delete);
+            if (max_index() == ret.repositioned)
+            {
+                set_max_index(index_to_delete);
+            }
             fixup_repositioned_index(ret.successor, ret.repositioned, index_to_delete);
         }
 
@@ -835,6 +1912,11 @@ protected:  // [WORKAROUND-1]
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = r;
     }
+    constexpr void set_max_index(const std::size_t m)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_ =
+            narrow_node_index<typename TreeStorage::NodeIndexType>(m);
+    }
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -14,6 +14,14 @@ enum class RedBlackTreeNodeColorCompactness : bool
     EMBEDDED_COLOR = true,
 };
 
+// Smallest unsigned type that can hold the links of a tree with up to MAXIMUM_SIZE nodes, along
+// with the null sentinel and, for compact nodes, the embedded color bit.
+template <std::size_t MAXIMUM_SIZE, RedBlackTreeNodeColorCompactness COMPACTNESS>
+using NodeIndexStorageType =
+    SmallestUnsignedIntegerFor<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR
+                                   ? 2 * MAXIMUM_SIZE + 1
+                                   : MAXIMUM_SIZE>;
+
 template <class T>
 concept IsRedBlackTreeNode = requires(const T& const_s,
                                       std::remove_const_t<T>& mutable_s,
@@ -46,7 +54,7 @@ concept IsRedBlackTreeNodeWithValue =
         mutable_s.value();
     };
 
-template <class K, class V = EmptyValue>
+template <class K, class V = EmptyValue, class IndexType = NodeIndex>
 class DefaultRedBlackTreeNode
 {
 public:
@@ -57,9 +65,12 @@ public:
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
     V IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
     NodeColor IMPLEMENTATION_DETAIL_DO_NOT_USE_color_ = COLOR_BLACK;
 
 public:
@@ -87,27 +98,27 @@ public:
 
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_);
     }
     constexpr void set_parent_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -119,8 +130,8 @@ public:
     }
 };
 
-template <class K>
-class DefaultRedBlackTreeNode<K, EmptyValue>
+template <class K, class IndexType>
+class DefaultRedBlackTreeNode<K, EmptyValue, IndexType>
 {
 public:
     using KeyType = K;
@@ -129,9 +140,12 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
     NodeColor IMPLEMENTATION_DETAIL_DO_NOT_USE_color_ = COLOR_BLACK;
 
 public:
@@ -149,27 +163,27 @@ public:
 
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_);
     }
     constexpr void set_parent_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -185,7 +199,7 @@ public:
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/detail/rbtree_node.hpp#L44
 // This is very good not just for the 1 byte saved, but because it improves alignment
 // characteristics.
-template <class K, class V = EmptyValue>
+template <class K, class V = EmptyValue, class IndexType = NodeIndex>
 class CompactRedBlackTreeNode
 {
 public:
@@ -197,10 +211,12 @@ public:  // Public so this type is a structural type and can thus be used in tem
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
     value_or_reference_storage_detail::ValueOrReferenceStorage<V>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
-    NodeIndexWithColorEmbeddedInTheMostSignificantBit
+    NodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexType>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_{};
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
 
 public:
     template <typename... Args>
@@ -235,19 +251,19 @@ public:
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -259,8 +275,8 @@ public:
     }
 };
 
-template <class K>
-class CompactRedBlackTreeNode<K, EmptyValue>
+template <class K, class IndexType>
+class CompactRedBlackTreeNode<K, EmptyValue, IndexType>
 {
 public:
     using KeyType = K;
@@ -269,10 +285,12 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
-    NodeIndexWithColorEmbeddedInTheMostSignificantBit
+    NodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexType>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_{};
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        narrow_node_index<IndexType>(NULL_INDEX);
 
 public:
     explicit constexpr CompactRedBlackTreeNode(const K& k) noexcept
@@ -297,19 +315,19 @@ public:
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return widen_node_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& i)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = i;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = narrow_node_index<IndexType>(i);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -321,6 +339,28 @@ public:
     }
 };
 
+// Order-statistic augmentation: any of the nodes above, plus the number of nodes in the subtree
+// rooted at this one (itself included). This is enough to find the n-th entry or the rank of a key
+// with a single descent.
+template <IsRedBlackTreeNode Node, class SizeType>
+class RedBlackTreeNodeWithSubtreeSize : public Node
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    SizeType IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_ = 1;
+
+public:
+    using Node::Node;
+
+    [[nodiscard]] constexpr std::size_t subtree_size() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_;
+    }
+    constexpr void set_subtree_size(const std::size_t s)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_ = static_cast<SizeType>(s);
+    }
+};
+
 template <class S>
 class RedBlackTreeNodeView
 {
@@ -331,6 +371,7 @@ public:
     using KeyType = K;
     using ValueType = V;
     static constexpr bool HAS_ASSOCIATED_VALUE = S::HAS_ASSOCIATED_VALUE;
+    static constexpr bool HAS_SUBTREE_SIZES = S::HAS_SUBTREE_SIZES;
     static constexpr bool IS_MUTABLE = !std::is_const_v<S>;
 
 private:
@@ -388,6 +429,17 @@ public:
     {
         return storage->set_color(i, c);
     }
+
+    [[nodiscard]] constexpr std::size_t subtree_size() const
+        requires HAS_SUBTREE_SIZES
+    {
+        return storage->subtree_size(i);
+    }
+    constexpr void set_subtree_size(const std::size_t s)
+        requires IS_MUTABLE && HAS_SUBTREE_SIZES
+    {
+        storage->set_subtree_size(i, s);
+    }
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -4,6 +4,7 @@
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
+#include <cstddef>
 #include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
@@ -67,6 +68,16 @@ class FixedRedBlackTreeOps
             [](RedBlackTreeNodeView<TreeStorage> node) { return node.color(); },
             [](RedBlackTreeNodeView<TreeStorage> node, NodeColor c) { node.set_color(c); });
     }
+    static constexpr void swap_subtree_size(RedBlackTreeNodeView<TreeStorage> node_i,
+                                            RedBlackTreeNodeView<TreeStorage> node_j)
+    {
+        swap_via_getter_and_setter(
+            node_i,
+            node_j,
+            [](RedBlackTreeNodeView<TreeStorage> node) { return node.subtree_size(); },
+            [](RedBlackTreeNodeView<TreeStorage> node, std::size_t s)
+            { node.set_subtree_size(s); });
+    }
 
 public:
     constexpr FixedRedBlackTreeOps() = delete;
@@ -160,6 +171,33 @@ public:
             node_j.set_right_index(node_i.right_index());
             node_i.set_right_index(j);
         }
+        else if (node_i.parent_index() == node_j.parent_index())
+        {
+            /*
+             *               p
+             *             /   \
+             *           i       j
+             */
+
+            // Going through the parent would update the same link twice, so leave it out and
+            // just swap its children
+            const NodeIndex parent_index = node_i.parent_index();
+            node_i.set_parent_index(NULL_INDEX);
+            node_j.set_parent_index(NULL_INDEX);
+
+            fixup_neighbours_of_node_to_point_to_a_new_index(tree, node_i, i, j);
+            fixup_neighbours_of_node_to_point_to_a_new_index(tree, node_j, j, i);
+
+            swap_left_index(node_i, node_j);
+            swap_right_index(node_i, node_j);
+
+            node_i.set_parent_index(parent_index);
+            node_j.set_parent_index(parent_index);
+            RedBlackTreeNodeView parent = tree.node_at(parent_index);
+            const NodeIndex left_of_parent = parent.left_index();
+            parent.set_left_index(parent.right_index());
+            parent.set_right_index(left_of_parent);
+        }
         else
         {
             fixup_neighbours_of_node_to_point_to_a_new_index(tree, node_i, i, j);
@@ -180,6 +218,11 @@ public:
         }
 
         swap_color(node_i, node_j);
+        if constexpr (TreeStorage::HAS_SUBTREE_SIZES)
+        {
+            // Each node takes the place of the other, so it also takes the size of its subtree
+            swap_subtree_size(node_i, node_j);
+        }
     }
 
     static constexpr void swap_nodes_including_key_and_value(RedBlackTreeStorage& tree,
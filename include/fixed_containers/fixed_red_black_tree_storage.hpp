@@ -3,8 +3,13 @@
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/optional_storage.hpp"
 
+#include <array>
 #include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -44,6 +49,12 @@ concept IsFixedRedBlackTreeStorage =
         mutable_s.delete_at_and_return_repositioned_index(i);
     };
 
+// Whether the nodes of a tree using StorageTemplate keep the size of their subtree
+template <template <IsFixedIndexBasedStorage, std::size_t> typename StorageTemplate>
+inline constexpr bool TRACKS_SUBTREE_SIZES = false;
+template <>
+inline constexpr bool TRACKS_SUBTREE_SIZES<FixedIndexBasedOrderStatisticPoolStorage> = true;
+
 template <class K,
           class V,
           std::size_t MAXIMUM_SIZE,
@@ -55,11 +66,23 @@ class FixedRedBlackTreeStorage
 public:
     using KeyType = K;
     using ValueType = V;
-    using NodeType =
+    using NodeIndexType = NodeIndexStorageType<MAXIMUM_SIZE, COMPACTNESS>;
+
+private:
+    using PlainNodeType =
         std::conditional_t<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
-                           CompactRedBlackTreeNode<K, V>,
-                           DefaultRedBlackTreeNode<K, V>>;
+                           CompactRedBlackTreeNode<K, V, NodeIndexType>,
+                           DefaultRedBlackTreeNode<K, V, NodeIndexType>>;
+
+public:
+    static constexpr bool HAS_SUBTREE_SIZES = TRACKS_SUBTREE_SIZES<StorageTemplate>;
+    using NodeType = std::conditional_t<
+        HAS_SUBTREE_SIZES,
+        RedBlackTreeNodeWithSubtreeSize<PlainNodeType, SmallestUnsignedIntegerFor<MAXIMUM_SIZE>>,
+        PlainNodeType>;
     static constexpr bool HAS_ASSOCIATED_VALUE = NodeType::HAS_ASSOCIATED_VALUE;
+    static constexpr bool HAS_FREE_LIST =
+        IsFixedIndexBasedStorageWithFreeList<StorageTemplate<NodeType, MAXIMUM_SIZE>>;
     using size_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::size_type;
     using difference_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::difference_type;
 
@@ -83,53 +106,64 @@ public:
         return {this, i};
     }
 
-    constexpr const K& key(const NodeIndex& i) const { return storage().at(i).key(); }
-    constexpr K& key(const NodeIndex& i) { return storage().at(i).key(); }
+    constexpr const K& key(const NodeIndex& i) const { return node_at(i).key(); }
+    constexpr K& key(const NodeIndex& i) { return node_at(i).key(); }
     constexpr const V& value(const NodeIndex& i) const
         requires HAS_ASSOCIATED_VALUE
     {
-        return storage().at(i).value();
+        return node_at(i).value();
     }
     constexpr V& value(const NodeIndex& i)
         requires HAS_ASSOCIATED_VALUE
     {
-        return storage().at(i).value();
+        return node_at(i).value();
     }
 
     [[nodiscard]] constexpr NodeIndex left_index(const NodeIndex& i) const
     {
-        return storage().at(i).left_index();
+        return node_at(i).left_index();
     }
     constexpr void set_left_index(const NodeIndex& i, const NodeIndex& s)
     {
-        storage().at(i).set_left_index(s);
+        node_at(i).set_left_index(s);
     }
 
     [[nodiscard]] constexpr NodeIndex right_index(const NodeIndex& i) const
     {
-        return storage().at(i).right_index();
+        return node_at(i).right_index();
     }
     constexpr void set_right_index(const NodeIndex& i, const NodeIndex& s)
     {
-        return storage().at(i).set_right_index(s);
+        return node_at(i).set_right_index(s);
     }
 
     [[nodiscard]] constexpr NodeIndex parent_index(const NodeIndex& i) const
     {
-        return storage().at(i).parent_index();
+        return node_at(i).parent_index();
     }
     constexpr void set_parent_index(const NodeIndex& i, const NodeIndex& s)
     {
-        return storage().at(i).set_parent_index(s);
+        return node_at(i).set_parent_index(s);
     }
 
     [[nodiscard]] constexpr NodeColor color(const NodeIndex& i) const
     {
-        return storage().at(i).color();
+        return node_at(i).color();
     }
     constexpr void set_color(const NodeIndex& i, const NodeColor& c)
     {
-        return storage().at(i).set_color(c);
+        return node_at(i).set_color(c);
+    }
+
+    [[nodiscard]] constexpr std::size_t subtree_size(const NodeIndex& i) const
+        requires HAS_SUBTREE_SIZES
+    {
+        return node_at(i).subtree_size();
+    }
+    constexpr void set_subtree_size(const NodeIndex& i, const std::size_t s)
+        requires HAS_SUBTREE_SIZES
+    {
+        node_at(i).set_subtree_size(s);
     }
 
     template <class... Args>
@@ -143,7 +177,42 @@ public:
         return storage().delete_at_and_return_repositioned_index(i);
     }
 
+    [[nodiscard]] constexpr std::size_t first_free_index() const noexcept
+        requires HAS_FREE_LIST
+    {
+        return storage().first_free_index();
+    }
+    [[nodiscard]] constexpr std::size_t next_free_index(const std::size_t i) const noexcept
+        requires HAS_FREE_LIST
+    {
+        return storage().next_free_index(i);
+    }
+    constexpr void move_to_free_slot(const NodeIndex& from,
+                                     const NodeIndex& to,
+                                     const std::size_t previous_free) noexcept
+        requires HAS_FREE_LIST
+    {
+        storage().move_to_free_slot(from, to, previous_free);
+    }
+    // Forgets all nodes without destroying them
+    constexpr void reset() noexcept
+        requires HAS_FREE_LIST
+    {
+        storage().reset();
+    }
+
 private:
+    constexpr const NodeType& node_at(const NodeIndex& i) const
+    {
+        assume_valid_node_index<MAXIMUM_SIZE>(i);
+        return storage().at(i);
+    }
+    constexpr NodeType& node_at(const NodeIndex& i)
+    {
+        assume_valid_node_index<MAXIMUM_SIZE>(i);
+        return storage().at(i);
+    }
+
     constexpr const StorageTemplate<NodeType, MAXIMUM_SIZE>& storage() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
@@ -154,4 +223,96 @@ private:
     }
 };
 
+// Hot/cold split: the nodes (key + links) are those of a set, and live in a dense pool of their
+// own. The values live in a parallel array indexed by the same NodeIndex and are only touched when
+// they are accessed, emplaced or deleted.
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          RedBlackTreeNodeColorCompactness COMPACTNESS>
+    requires(!std::is_same_v<V, EmptyValue>)
+class FixedRedBlackTreeStorage<K, V, MAXIMUM_SIZE, COMPACTNESS, FixedIndexBasedSplitPoolStorage>
+  : public FixedRedBlackTreeStorage<K,
+                                    EmptyValue,
+                                    MAXIMUM_SIZE,
+                                    COMPACTNESS,
+                                    FixedIndexBasedPoolStorage>
+{
+    using Base = FixedRedBlackTreeStorage<K,
+                                          EmptyValue,
+                                          MAXIMUM_SIZE,
+                                          COMPACTNESS,
+                                          FixedIndexBasedPoolStorage>;
+    using ValueStorage = optional_storage_detail::OptionalStorage<V>;
+
+public:
+    using KeyType = K;
+    using ValueType = V;
+    static constexpr bool HAS_ASSOCIATED_VALUE = true;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<ValueStorage, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+
+public:
+    constexpr FixedRedBlackTreeStorage()
+      : Base()
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_()
+    {
+    }
+
+    constexpr RedBlackTreeNodeView<const FixedRedBlackTreeStorage> at(const NodeIndex& i) const
+    {
+        return {this, i};
+    }
+    constexpr RedBlackTreeNodeView<FixedRedBlackTreeStorage> at(const NodeIndex& i)
+    {
+        return {this, i};
+    }
+
+    constexpr const V& value(const NodeIndex& i) const
+    {
+        assume_valid_node_index<MAXIMUM_SIZE>(i);
+        return values()[i].get();
+    }
+    constexpr V& value(const NodeIndex& i)
+    {
+        assume_valid_node_index<MAXIMUM_SIZE>(i);
+        return values()[i].get();
+    }
+
+    template <class Key, class... Args>
+    constexpr NodeIndex emplace_and_return_index(Key&& key, Args&&... args)
+    {
+        const NodeIndex i = Base::emplace_and_return_index(std::forward<Key>(key));
+        std::construct_at(&values()[i], std::in_place, std::forward<Args>(args)...);
+        return i;
+    }
+
+    constexpr NodeIndex delete_at_and_return_repositioned_index(const std::size_t i) noexcept
+    {
+        std::destroy_at(&values()[i].value);
+        // Pool storage never repositions, so the value does not need to follow its node
+        return Base::delete_at_and_return_repositioned_index(i);
+    }
+
+    constexpr void move_to_free_slot(const NodeIndex& from,
+                                     const NodeIndex& to,
+                                     const std::size_t previous_free) noexcept
+    {
+        std::construct_at(&values()[to], std::in_place, std::move(values()[from].get()));
+        std::destroy_at(&values()[from].value);
+        Base::move_to_free_slot(from, to, previous_free);
+    }
+
+private:
+    constexpr const std::array<ValueStorage, MAXIMUM_SIZE>& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr std::array<ValueStorage, MAXIMUM_SIZE>& values()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+};
+
 }  // namespace fixed_containers::fixed_red_black_tree_detail
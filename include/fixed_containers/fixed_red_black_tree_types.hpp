@@ -1,6 +1,10 @@
 #pragma once
 
+#include "fixed_containers/smallest_unsigned_integer.hpp"
+
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <type_traits>
@@ -19,6 +23,53 @@ struct EmptyValue
     constexpr EmptyValue() = delete;
 };
 
+// Nodes do not need to store their links as NodeIndex. The smallest unsigned type that can
+// represent every index in [0, MAXIMUM_SIZE) plus a null sentinel is enough, and for the sizes
+// this library is typically used with, that is 1 or 2 bytes instead of 8. This makes nodes
+// smaller, which puts more of them in each cache line during descent. NodeIndex is still used for
+// all computations; narrowing/widening happens when reading/writing the links.
+using smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor;
+
+template <class IndexType>
+    requires std::is_unsigned_v<IndexType>
+constexpr IndexType narrow_node_index(const NodeIndex i)
+{
+    constexpr IndexType LOCAL_NULL_INDEX = (std::numeric_limits<IndexType>::max)();
+    if (i == NULL_INDEX)
+    {
+        return LOCAL_NULL_INDEX;
+    }
+    assert(i < LOCAL_NULL_INDEX);
+    return static_cast<IndexType>(i);
+}
+
+template <class IndexType>
+    requires std::is_unsigned_v<IndexType>
+constexpr NodeIndex widen_node_index(const IndexType i)
+{
+    constexpr IndexType LOCAL_NULL_INDEX = (std::numeric_limits<IndexType>::max)();
+    if (i == LOCAL_NULL_INDEX)
+    {
+        return NULL_INDEX;
+    }
+    return static_cast<NodeIndex>(i);
+}
+
+// Every index that reaches a node lookup has already been checked against NULL_INDEX, but once
+// links are widened from a narrower type the optimizer can no longer prove it, and gcc reports the
+// NULL_INDEX path as an out-of-bounds array access. This states the invariant where it holds.
+template <std::size_t MAXIMUM_SIZE>
+constexpr void assume_valid_node_index(const NodeIndex i)
+{
+    assert(i < MAXIMUM_SIZE);
+#if defined(__GNUC__) || defined(__clang__)
+    if (i >= MAXIMUM_SIZE)
+    {
+        __builtin_unreachable();
+    }
+#endif
+}
+
 // boost::container::map has the option to embed the color in one of the pointers
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/detail/rbtree_node.hpp#L44
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/pointer_plus_bits.hpp#L79
@@ -27,16 +78,18 @@ struct EmptyValue
 // bits for storing the color. Also, note for subsequent comment: nullptr is at 0.
 //
 // This class does something similar, except it embeds the color in the high bits of the indexes.
-// This is because it is unlikely that we are going to need maps up to NodeIndex::max() and we
+// This is because it is unlikely that we are going to need maps up to IndexType::max() and we
 // care about values 0 to MAXIMUM_SIZE. Furthermore, NULL_INDEX is at max().
+template <class IndexType = NodeIndex>
+    requires std::is_unsigned_v<IndexType>
 class NodeIndexWithColorEmbeddedInTheMostSignificantBit
 {
-    static constexpr std::size_t SHIFT_TO_MOST_SIGNIFICANT_BIT = sizeof(NodeIndex) * 8ULL - 1ULL;
-    static constexpr NodeIndex MASK = 1ULL << SHIFT_TO_MOST_SIGNIFICANT_BIT;
-    static constexpr NodeIndex LOCAL_NULL_INDEX = NULL_INDEX >> 1;
+    static constexpr std::size_t SHIFT_TO_MOST_SIGNIFICANT_BIT = sizeof(IndexType) * 8ULL - 1ULL;
+    static constexpr IndexType MASK = static_cast<IndexType>(1ULL << SHIFT_TO_MOST_SIGNIFICANT_BIT);
+    static constexpr IndexType LOCAL_NULL_INDEX = (std::numeric_limits<IndexType>::max)() >> 1;
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
+    IndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
 
 public:
     constexpr NodeIndexWithColorEmbeddedInTheMostSignificantBit()
@@ -54,7 +107,7 @@ public:
 
     [[nodiscard]] constexpr NodeIndex get_index() const
     {
-        NodeIndex ret = index_and_color() & (~MASK);
+        const IndexType ret = index_and_color() & static_cast<IndexType>(~MASK);
 
         if (ret == LOCAL_NULL_INDEX)
         {
@@ -68,7 +121,7 @@ public:
     {
         const NodeIndex j = i == NULL_INDEX ? LOCAL_NULL_INDEX : i;
         assert(j <= LOCAL_NULL_INDEX);
-        index_and_color() = (index_and_color() & MASK) | j;
+        index_and_color() = (index_and_color() & MASK) | static_cast<IndexType>(j);
     }
 
     [[nodiscard]] constexpr NodeColor get_color() const
@@ -78,16 +131,17 @@ public:
 
     constexpr void set_color(const NodeColor c)
     {
-        index_and_color() = (~MASK & index_and_color()) |
-                            (static_cast<NodeIndex>(c) << SHIFT_TO_MOST_SIGNIFICANT_BIT);
+        index_and_color() =
+            (static_cast<IndexType>(~MASK) & index_and_color()) |
+            static_cast<IndexType>(static_cast<IndexType>(c) << SHIFT_TO_MOST_SIGNIFICANT_BIT);
     }
 
 private:
-    [[nodiscard]] constexpr const NodeIndex& index_and_color() const
+    [[nodiscard]] constexpr const IndexType& index_and_color() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
     }
-    [[nodiscard]] constexpr NodeIndex& index_and_color()
+    [[nodiscard]] constexpr IndexType& index_and_color()
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
     }
@@ -110,6 +164,8 @@ enum class RedBlackTreeStorageType
 {
     FIXED_INDEX_POOL,
     FIXED_INDEX_CONTIGUOUS,
+    FIXED_INDEX_SPLIT_POOL,
+    FIXED_INDEX_ORDER_STATISTIC_POOL,
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -2,10 +2,12 @@
 
 #include "fixed_containers/fixed_red_black_tree.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <unordered_set>
 #include <utility>
@@ -20,11 +22,191 @@ constexpr std::common_type_t<M, N> align_up(M m, N n)
     return m + n - 1 - (m + n - 1) % n;
 }
 
+}  // namespace fixed_containers
+
+namespace fixed_containers::fixed_red_black_tree_view_detail
+{
+/**
+ * Byte offsets of the parts of a FixedRedBlackTree with the given element size and alignment,
+ * capacity, compactness and storage type. Mirrors the data layout of the tree, its storage and its
+ * nodes, so a layout change must be reflected here.
+ *
+ * With FIXED_INDEX_SPLIT_POOL, the nodes only hold the key, so the element is the key alone, and
+ * the value size and alignment describe the parallel array of values. Sets have no such array and
+ * pass a value size of 0.
+ *
+ * An element alignment of 0 stands for natural_alignment_bytes() of the element size.
+ */
+struct RawTreeLayout
+{
+    using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+
+    // Width of the links stored in each node. Mirrors
+    // fixed_red_black_tree_detail::NodeIndexStorageType.
+    std::size_t index_size_bytes;
+    // Offset of the parent link within a node. It is followed by the left and right links.
+    std::size_t links_offset_bytes;
+    // Distance between consecutive nodes in the storage
+    std::size_t node_stride_bytes;
+    // Offset of the node at index 0 within the tree
+    std::size_t nodes_offset_bytes;
+    // Offset of the tree's root index, which directly follows the storage. The size follows it.
+    std::size_t root_index_offset_bytes;
+    std::size_t size_offset_bytes;
+    // Offset and width of the subtree size within a node. Only for
+    // FIXED_INDEX_ORDER_STATISTIC_POOL, 0 otherwise.
+    std::size_t subtree_size_offset_bytes;
+    std::size_t subtree_size_bytes;
+    // Offset of the value at index 0 within the tree, and distance between consecutive values. Only
+    // for maps with FIXED_INDEX_SPLIT_POOL, 0 otherwise.
+    std::size_t values_offset_bytes;
+    std::size_t value_stride_bytes;
+
+    static constexpr RawTreeLayout of(std::size_t elem_size_bytes,
+                                      std::size_t elem_align_bytes,
+                                      std::size_t max_size,
+                                      Compactness compactness,
+                                      StorageType storage_type,
+                                      std::size_t value_size_bytes = 0,
+                                      std::size_t value_align_bytes = 1)
+    {
+        if (elem_align_bytes == 0)
+        {
+            elem_align_bytes = natural_alignment_bytes(elem_size_bytes);
+        }
+        const std::size_t index_size_bytes = smallest_unsigned_integer_size_bytes(
+            compactness == Compactness::EMBEDDED_COLOR ? 2 * max_size + 1 : max_size);
+        std::size_t node_align_bytes = (std::max)(elem_align_bytes, index_size_bytes);
+
+        // The key and value are followed by the parent, left and right links, and then by the
+        // color for nodes that do not embed it.
+        const std::size_t links_offset_bytes = align_up(elem_size_bytes, index_size_bytes);
+        std::size_t links_size_bytes = 3 * index_size_bytes;
+        if (compactness == Compactness::DEDICATED_COLOR)
+        {
+            links_size_bytes += sizeof(fixed_red_black_tree_detail::NodeColor);
+        }
+        std::size_t node_end_bytes = links_offset_bytes + links_size_bytes;
+
+        std::size_t subtree_size_offset_bytes = 0;
+        std::size_t subtree_size_bytes = 0;
+        if (storage_type == StorageType::FIXED_INDEX_ORDER_STATISTIC_POOL)
+        {
+            // RedBlackTreeNodeWithSubtreeSize appends the size to the node it derives from. The
+            // Itanium ABI places it in the tail padding of that node, MSVC after it.
+            subtree_size_bytes = smallest_unsigned_integer_size_bytes(max_size);
+#if defined(_MSC_VER)
+            node_end_bytes = align_up(node_end_bytes, node_align_bytes);
+#endif
+            subtree_size_offset_bytes = align_up(node_end_bytes, subtree_size_bytes);
+            node_end_bytes = subtree_size_offset_bytes + subtree_size_bytes;
+            node_align_bytes = (std::max)(node_align_bytes, subtree_size_bytes);
+        }
+        const std::size_t node_size_bytes = align_up(node_end_bytes, node_align_bytes);
+
+        std::size_t node_stride_bytes = 0;
+        std::size_t nodes_offset_bytes = 0;
+        std::size_t tree_storage_size_bytes = 0;
+        std::size_t values_offset_bytes = 0;
+        std::size_t value_stride_bytes = 0;
+        switch (storage_type)
+        {
+        case StorageType::FIXED_INDEX_POOL:
+        case StorageType::FIXED_INDEX_SPLIT_POOL:
+        case StorageType::FIXED_INDEX_ORDER_STATISTIC_POOL:
+        {
+            // IndexOrValueStorage is a union containing a free list index or the node itself. The
+            // array of them is followed by the head of the free list and the high-water mark.
+            const std::size_t pool_index_bytes = smallest_unsigned_integer_size_bytes(max_size);
+            const std::size_t pool_align_bytes = (std::max)(pool_index_bytes, node_align_bytes);
+            node_stride_bytes =
+                align_up((std::max)(pool_index_bytes, node_size_bytes), pool_align_bytes);
+            tree_storage_size_bytes =
+                align_up(node_stride_bytes * max_size + 2 * pool_index_bytes, pool_align_bytes);
+            if (storage_type == StorageType::FIXED_INDEX_SPLIT_POOL && value_size_bytes > 0)
+            {
+                // The array of OptionalStorage of the values follows the pool
+                values_offset_bytes = align_up(tree_storage_size_bytes, value_align_bytes);
+                value_stride_bytes = value_size_bytes;
+                tree_storage_size_bytes =
+                    align_up(values_offset_bytes + value_stride_bytes * max_size,
+                             (std::max)(pool_align_bytes, value_align_bytes));
+            }
+            break;
+        }
+        case StorageType::FIXED_INDEX_CONTIGUOUS:
+            // A FixedVector of nodes: the size, followed by the array
+            node_stride_bytes = node_size_bytes;
+            nodes_offset_bytes = align_up(sizeof(std::size_t), node_align_bytes);
+            tree_storage_size_bytes =
+                align_up(nodes_offset_bytes + node_stride_bytes * max_size,
+                         (std::max)(alignof(std::size_t), node_align_bytes));
+            break;
+        }
+
+        const std::size_t root_index_offset_bytes =
+            align_up(tree_storage_size_bytes, alignof(fixed_red_black_tree_detail::NodeIndex));
+        return {
+            .index_size_bytes = index_size_bytes,
+            .links_offset_bytes = links_offset_bytes,
+            .node_stride_bytes = node_stride_bytes,
+            .nodes_offset_bytes = nodes_offset_bytes,
+            .root_index_offset_bytes = root_index_offset_bytes,
+            .size_offset_bytes =
+                root_index_offset_bytes + sizeof(fixed_red_black_tree_detail::NodeIndex),
+            .subtree_size_offset_bytes = subtree_size_offset_bytes,
+            .subtree_size_bytes = subtree_size_bytes,
+            .values_offset_bytes = values_offset_bytes,
+            .value_stride_bytes = value_stride_bytes,
+        };
+    }
+
+    /**
+     * The largest power of two that divides the size, up to the alignment of a pointer. This is
+     * the alignment of elements made of fundamental types up to pointer size, which the views
+     * assumed before they took the alignment. Elements with a smaller alignment than that (e.g.
+     * an array of 2 chars) need their alignment passed explicitly.
+     */
+    static constexpr std::size_t natural_alignment_bytes(std::size_t elem_size_bytes)
+    {
+        std::size_t out = 1;
+        while (out < alignof(std::uintptr_t) && elem_size_bytes % (2 * out) == 0)
+        {
+            out *= 2;
+        }
+        return out;
+    }
+
+    static constexpr std::size_t smallest_unsigned_integer_size_bytes(std::size_t max_value)
+    {
+        if (max_value <= (std::numeric_limits<std::uint8_t>::max)())
+        {
+            return sizeof(std::uint8_t);
+        }
+        if (max_value <= (std::numeric_limits<std::uint16_t>::max)())
+        {
+            return sizeof(std::uint16_t);
+        }
+        if (max_value <= (std::numeric_limits<std::uint32_t>::max)())
+        {
+            return sizeof(std::uint32_t);
+        }
+        return sizeof(std::uint64_t);
+    }
+};
+
+}  // namespace fixed_containers::fixed_red_black_tree_view_detail
+
+namespace fixed_containers
+{
+
 class FixedRedBlackTreeRawView
 {
     using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
     using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
     using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+    using RawTreeLayout = fixed_red_black_tree_view_detail::RawTreeLayout;
 
     static constexpr auto NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
 
@@ -33,11 +215,9 @@ public:
     {
     private:
         const std::byte* base_;
-        std::size_t elem_size_bytes_;
-        std::size_t max_size_bytes_;
         Compactness compactness_;
-        StorageType storage_type_;
-        std::size_t storage_elem_size_bytes_;
+        // Computed once, instead of on every step of a traversal
+        RawTreeLayout layout_;
 
         NodeIndex index_;
         const std::byte* cur_pointer_;
@@ -56,20 +236,26 @@ public:
                  std::size_t max_size_bytes,
                  Compactness compactness,
                  StorageType storage_type,
-                 bool end = false) noexcept
+                 bool end = false,
+                 std::size_t elem_align_bytes = 0,
+                 std::size_t value_size_bytes = 0,
+                 std::size_t value_align_bytes = 1) noexcept
           : base_{ptr}
-          , elem_size_bytes_{elem_size_bytes}
-          , max_size_bytes_{max_size_bytes}
           , compactness_{compactness}
-          , storage_type_{storage_type}
-          , storage_elem_size_bytes_{storage_elem_size_bytes()}
+          , layout_{RawTreeLayout::of(elem_size_bytes,
+                                      elem_align_bytes,
+                                      max_size_bytes,
+                                      compactness,
+                                      storage_type,
+                                      value_size_bytes,
+                                      value_align_bytes)}
           , index_{end ? NULL_INDEX : min_index()}
           , cur_pointer_{node_pointer(index_)}
         {
         }
 
         Iterator() noexcept
-          : Iterator(nullptr, {}, {}, {}, {}, false)
+          : Iterator(nullptr, 1, {}, {}, {}, true)
         {
         }
 
@@ -107,10 +293,8 @@ public:
          */
         std::size_t size() const
         {
-            const auto bptr = reinterpret_cast<const std::byte*>(base_);
-            const auto root_index_offset = tree_storage_size_bytes();
-            const auto size_offset = root_index_offset + sizeof(NodeIndex);
-            const auto size_ptr = std::next(bptr, static_cast<difference_type>(size_offset));
+            const auto size_ptr =
+                std::next(base_, static_cast<difference_type>(layout_.size_offset_bytes));
             return *reinterpret_cast<const std::size_t*>(size_ptr);
         }
 
@@ -118,21 +302,15 @@ public:
         /**
          * Calculate the pointer to a tree node at the provided storage index.
          */
-        [[nodiscard]] constexpr const std::byte* node_pointer(std::size_t i) const
+        [[nodiscard]] constexpr const std::byte* node_pointer(NodeIndex i) const
         {
-            switch (storage_type_)
+            if (i == NULL_INDEX)
             {
-            case StorageType::FIXED_INDEX_POOL:
-                return std::next(iov_array_base(),
-                                 static_cast<difference_type>(i * storage_elem_size_bytes_));
-
-            case StorageType::FIXED_INDEX_CONTIGUOUS:
-                return std::next(contiguous_array_base(),
-                                 static_cast<difference_type>(i * storage_elem_size_bytes_));
+                return nullptr;
             }
-
-            assert(false && "unreachable");
-            return nullptr;
+            return std::next(base_,
+                             static_cast<difference_type>(layout_.nodes_offset_bytes +
+                                                          i * layout_.node_stride_bytes));
         }
 
         /**
@@ -154,51 +332,94 @@ public:
         }
 
         /**
-         * Calculate the pointer to the tree node at index `i` and read the left index from memory.
+         * Read the link at position `link` (0 for the parent, 1 for left, 2 for right) of the
+         * tree node at index `i`.
          */
+        [[nodiscard]] const std::byte* link_pointer(NodeIndex i, std::size_t link) const
+        {
+            return std::next(node_pointer(i),
+                             static_cast<difference_type>(layout_.links_offset_bytes +
+                                                          link * layout_.index_size_bytes));
+        }
+
         [[nodiscard]] NodeIndex left_index(NodeIndex i) const
         {
-            const auto node = node_pointer(i); /* key_ */
-            const auto parent_index_offset = align_up(elem_size_bytes_, sizeof(uintptr_t));
-            const auto left_index_offset =
-                static_cast<difference_type>(parent_index_offset + sizeof(NodeIndex));
-            return *reinterpret_cast<const NodeIndex*>(std::next(node, left_index_offset));
+            return read_node_index(link_pointer(i, 1));
         }
 
-        /**
-         * Calculate the pointer to the tree node at index `i` and read the right index from memory.
-         */
         [[nodiscard]] NodeIndex right_index(NodeIndex i) const
         {
-            const auto node = node_pointer(i);
-            const auto parent_index_offset = align_up(elem_size_bytes_, sizeof(uintptr_t));
-            const auto left_index_offset = parent_index_offset + sizeof(NodeIndex);
-            const auto right_index_offset =
-                static_cast<difference_type>(left_index_offset + sizeof(NodeIndex));
-            return *reinterpret_cast<const NodeIndex*>(std::next(node, right_index_offset));
+            return read_node_index(link_pointer(i, 2));
         }
 
-        /**
-         * Calculate the pointer to the tree node at index `i` and read its parent index from
-         * memory.
-         */
         [[nodiscard]] NodeIndex parent_index(NodeIndex i) const
         {
-            using namespace fixed_red_black_tree_detail;
-
-            const auto node = node_pointer(i);
-            const auto parent_index_offset =
-                static_cast<difference_type>(align_up(elem_size_bytes_, sizeof(uintptr_t)));
-            const auto parent_idx_ptr = std::next(node, parent_index_offset);
+            const auto parent_idx_ptr = link_pointer(i, 0);
 
             switch (compactness_)
             {
             case Compactness::DEDICATED_COLOR: /* default node */
-                return *reinterpret_cast<const NodeIndex*>(parent_idx_ptr);
+                return read_node_index(parent_idx_ptr);
 
             case Compactness::EMBEDDED_COLOR: /* compact node*/
-                return reinterpret_cast<const NodeIndexWithColorEmbeddedInTheMostSignificantBit*>(
-                           parent_idx_ptr)
+                return read_node_index_with_embedded_color(parent_idx_ptr);
+            }
+
+            assert(false && "unreachable");
+            return NULL_INDEX;
+        }
+
+        /**
+         * Read a node link of the width used by the tree and widen it to NodeIndex.
+         */
+        [[nodiscard]] NodeIndex read_node_index(const std::byte* ptr) const
+        {
+            using namespace fixed_red_black_tree_detail;
+
+            switch (layout_.index_size_bytes)
+            {
+            case sizeof(std::uint8_t):
+                return widen_node_index(*reinterpret_cast<const std::uint8_t*>(ptr));
+            case sizeof(std::uint16_t):
+                return widen_node_index(*reinterpret_cast<const std::uint16_t*>(ptr));
+            case sizeof(std::uint32_t):
+                return widen_node_index(*reinterpret_cast<const std::uint32_t*>(ptr));
+            case sizeof(std::uint64_t):
+                return widen_node_index(*reinterpret_cast<const std::uint64_t*>(ptr));
+            }
+
+            assert(false && "unreachable");
+            return NULL_INDEX;
+        }
+
+        /**
+         * Read a node link that has the color embedded in its most significant bit.
+         */
+        [[nodiscard]] NodeIndex read_node_index_with_embedded_color(const std::byte* ptr) const
+        {
+            using namespace fixed_red_black_tree_detail;
+
+            switch (layout_.index_size_bytes)
+            {
+            case sizeof(std::uint8_t):
+                return reinterpret_cast<
+                           const NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint8_t>*>(
+                           ptr)
+                    ->get_index();
+            case sizeof(std::uint16_t):
+                return reinterpret_cast<
+                           const NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint16_t>*>(
+                           ptr)
+                    ->get_index();
+            case sizeof(std::uint32_t):
+                return reinterpret_cast<
+                           const NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint32_t>*>(
+                           ptr)
+                    ->get_index();
+            case sizeof(std::uint64_t):
+                return reinterpret_cast<
+                           const NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint64_t>*>(
+                           ptr)
                     ->get_index();
             }
 
@@ -244,161 +465,456 @@ public:
          */
         [[nodiscard]] NodeIndex root_index() const
         {
-            const auto bptr = reinterpret_cast<const std::byte*>(base_);
-            const auto tree_storage_ptr = bptr;
-            const auto root_index_ptr = std::next(
-                tree_storage_ptr, static_cast<difference_type>(tree_storage_size_bytes()));
+            const auto root_index_ptr =
+                std::next(base_, static_cast<difference_type>(layout_.root_index_offset_bytes));
             return *reinterpret_cast<const std::size_t*>(root_index_ptr);
         }
+    };
 
-        /**
-         * Calculate the size of the tree storage object in memory.
-         */
-        [[nodiscard]] std::size_t tree_storage_size_bytes() const
+private:
+    const std::byte* tree_ptr_;
+    const std::size_t elem_size_bytes_;
+    const std::size_t max_size_bytes_;
+    const Compactness compactness_;
+    const StorageType storage_type_;
+    const std::size_t elem_align_bytes_;
+    const std::size_t value_size_bytes_;
+    const std::size_t value_align_bytes_;
+
+public:
+    // The element alignment defaults to the natural alignment of its size, see RawTreeLayout.
+    // The value size and alignment are only needed for maps with FIXED_INDEX_SPLIT_POOL.
+    FixedRedBlackTreeRawView(const void* tree_ptr,
+                             std::size_t elem_size_bytes,
+                             std::size_t max_size_bytes,
+                             Compactness compactness,
+                             StorageType storage_type,
+                             std::size_t elem_align_bytes = 0,
+                             std::size_t value_size_bytes = 0,
+                             std::size_t value_align_bytes = 1)
+      : tree_ptr_{reinterpret_cast<const std::byte*>(tree_ptr)}
+      , elem_size_bytes_{elem_size_bytes}
+      , max_size_bytes_{max_size_bytes}
+      , compactness_{compactness}
+      , storage_type_{storage_type}
+      , elem_align_bytes_{elem_align_bytes}
+      , value_size_bytes_{value_size_bytes}
+      , value_align_bytes_{value_align_bytes}
+    {
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(tree_ptr_,
+                        elem_size_bytes_,
+                        max_size_bytes_,
+                        compactness_,
+                        storage_type_,
+                        false,
+                        elem_align_bytes_,
+                        value_size_bytes_,
+                        value_align_bytes_);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(tree_ptr_,
+                        elem_size_bytes_,
+                        max_size_bytes_,
+                        compactness_,
+                        storage_type_,
+                        true,
+                        elem_align_bytes_,
+                        value_size_bytes_,
+                        value_align_bytes_);
+    }
+
+    std::size_t size() const { return end().size(); }
+};
+
+/**
+ * Like FixedRedBlackTreeRawView, but with the layout parameters known at compile time, so all
+ * offsets and the link width are constants. Iterators are bidirectional, and since the elements
+ * are in order, sorted searches take O(log n). Trees with FIXED_INDEX_ORDER_STATISTIC_POOL also
+ * provide nth() in O(log n) through their subtree sizes; other trees do not store in-order
+ * positions, so they can only be walked.
+ *
+ * Searches take a comparator of the form `bool(const std::byte* lhs, const std::byte* rhs)` with
+ * the same ordering as the tree, called with pointers to elements and to the searched key. The key
+ * is at the start of each element.
+ */
+template <std::size_t ELEM_SIZE_BYTES,
+          std::size_t ELEM_ALIGN_BYTES,
+          std::size_t MAXIMUM_SIZE,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          fixed_red_black_tree_detail::RedBlackTreeStorageType STORAGE_TYPE,
+          std::size_t VALUE_SIZE_BYTES = 0,
+          std::size_t VALUE_ALIGN_BYTES = 1>
+class FixedRedBlackTreeStaticRawView
+{
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+    using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+    using LinkType = fixed_red_black_tree_detail::NodeIndexStorageType<MAXIMUM_SIZE, COMPACTNESS>;
+    using SubtreeSizeType = fixed_red_black_tree_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr auto NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
+    static constexpr fixed_red_black_tree_view_detail::RawTreeLayout LAYOUT =
+        fixed_red_black_tree_view_detail::RawTreeLayout::of(ELEM_SIZE_BYTES,
+                                                            ELEM_ALIGN_BYTES,
+                                                            MAXIMUM_SIZE,
+                                                            COMPACTNESS,
+                                                            STORAGE_TYPE,
+                                                            VALUE_SIZE_BYTES,
+                                                            VALUE_ALIGN_BYTES);
+    static_assert(sizeof(LinkType) == LAYOUT.index_size_bytes);
+    static_assert(VALUE_SIZE_BYTES == 0 || STORAGE_TYPE == StorageType::FIXED_INDEX_SPLIT_POOL,
+                  "Values are only kept apart from the nodes with FIXED_INDEX_SPLIT_POOL");
+
+public:
+    class Iterator
+    {
+        friend class FixedRedBlackTreeStaticRawView;
+
+    private:
+        const std::byte* tree_ptr_;
+        NodeIndex index_;
+
+        Iterator(const std::byte* tree_ptr, NodeIndex index) noexcept
+          : tree_ptr_{tree_ptr}
+          , index_{index}
         {
-            switch (storage_type_)
-            {
-            case StorageType::FIXED_INDEX_POOL:
-            {
-                const auto iov_array_size_bytes = storage_elem_size_bytes_ * max_size_bytes_;
-                const auto next_index_size_bytes = sizeof(std::size_t);
-                return iov_array_size_bytes + next_index_size_bytes;
-            }
+        }
 
-            case StorageType::FIXED_INDEX_CONTIGUOUS:
-                const auto vector_size_bytes = sizeof(std::size_t);
-                const auto vector_data_size_bytes = storage_elem_size_bytes_ * max_size_bytes_;
-                return vector_size_bytes + vector_data_size_bytes;
-            }
+    public:
+        using value_type = const std::byte*;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+        using iterator_category = std::bidirectional_iterator_tag;
 
-            assert(false && "unreachable");
-            return 0;
+        Iterator() noexcept
+          : Iterator(nullptr, NULL_INDEX)
+        {
         }
 
-        /**
-         * Calculate the base pointer to the array of "index or value" objects in the storage pool.
-         * Only valid for storage type 'FIXED_INDEX_POOL'.
-         */
-        [[nodiscard]] const std::byte* iov_array_base() const
+        // By value, so std::reverse_iterator does not return a reference to its temporary
+        reference operator*() const { return node_pointer(tree_ptr_, index_); }
+
+        Iterator& operator++()
         {
-            assert(storage_type_ == StorageType::FIXED_INDEX_POOL);
-            const auto bptr = reinterpret_cast<const std::byte*>(base_);
-            const auto storage_ptr = bptr;
-            const auto iov_array = storage_ptr;
-            return iov_array;
+            index_ = successor(tree_ptr_, index_);
+            return *this;
         }
 
-        /**
-         * Calculate the base pointer to the array of tree nodes owned by the storage pool's fixed
-         * vector. Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
-         */
-        [[nodiscard]] const std::byte* contiguous_array_base() const
+        Iterator operator++(int) & noexcept
         {
-            assert(storage_type_ == StorageType::FIXED_INDEX_CONTIGUOUS);
-            const auto bptr = reinterpret_cast<const std::byte*>(base_);
-            const auto storage_ptr = bptr;
-            const auto fixed_vector_ptr = storage_ptr;
-            const auto array_ptr =
-                std::next(fixed_vector_ptr, static_cast<difference_type>(sizeof(std::size_t)));
-            return array_ptr;
+            auto tmp = *this;
+            ++*this;
+            return tmp;
         }
 
-        /**
-         * Calculate the pointer to the storage pool's fixed vector and read the size value.
-         * Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
-         */
-        [[nodiscard]] std::size_t contiguous_vector_size_bytes() const
+        // Decrementing the end iterator moves to the maximum element
+        Iterator& operator--()
         {
-            assert(storage_type_ == StorageType::FIXED_INDEX_CONTIGUOUS);
-            const auto bptr = reinterpret_cast<const std::byte*>(base_);
-            const auto storage_ptr = bptr;
-            const auto fixed_vector_ptr = storage_ptr;
-            return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            index_ = index_ == NULL_INDEX ? max_index(tree_ptr_) : predecessor(tree_ptr_, index_);
+            return *this;
         }
 
-        /**
-         * Calculate the size of each element in the storage's internal buffer.
-         */
-        [[nodiscard]] std::size_t storage_elem_size_bytes() const
+        Iterator operator--(int) & noexcept
         {
-            const auto node_size_bytes = tree_node_size_bytes();
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
 
-            switch (storage_type_)
-            {
-            case StorageType::FIXED_INDEX_POOL:
-                // IndexOrValueStorage is a union containing a size_t (index) or the node itself.
-                return std::max(sizeof(std::size_t), node_size_bytes);
+        constexpr bool operator==(const Iterator& other) const
+        {
+            return (tree_ptr_ == other.tree_ptr_ && index_ == other.index_);
+        }
+    };
+
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+
+private:
+    const std::byte* tree_ptr_;
+
+public:
+    explicit FixedRedBlackTreeStaticRawView(const void* tree_ptr)
+      : tree_ptr_{reinterpret_cast<const std::byte*>(tree_ptr)}
+    {
+    }
+
+    Iterator begin() const { return Iterator(tree_ptr_, min_index(tree_ptr_)); }
+    Iterator end() const { return Iterator(tree_ptr_, NULL_INDEX); }
+    reverse_iterator rbegin() const { return reverse_iterator(end()); }
+    reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+    /**
+     * Read the tree's size member, which directly follows the root index.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return *reinterpret_cast<const std::size_t*>(
+            std::next(tree_ptr_, static_cast<difference_type>(LAYOUT.size_offset_bytes)));
+    }
 
-            case StorageType::FIXED_INDEX_CONTIGUOUS:
-                return node_size_bytes;
+    [[nodiscard]] static constexpr std::size_t max_size() { return MAXIMUM_SIZE; }
+
+    /**
+     * Descend from the root to the first element that is not less than the key.
+     */
+    template <class Compare>
+    [[nodiscard]] Iterator lower_bound(const void* key_bytes, Compare comp) const
+    {
+        const auto* key = reinterpret_cast<const std::byte*>(key_bytes);
+        NodeIndex result = NULL_INDEX;
+        for (NodeIndex i = root_index(tree_ptr_); i != NULL_INDEX;)
+        {
+            if (comp(node_pointer(tree_ptr_, i), key))
+            {
+                i = right_index(tree_ptr_, i);
             }
+            else
+            {
+                result = i;
+                i = left_index(tree_ptr_, i);
+            }
+        }
+        return Iterator(tree_ptr_, result);
+    }
 
-            assert(false && "unreachable");
-            return 0;
+    /**
+     * Descend from the root to the first element that is greater than the key.
+     */
+    template <class Compare>
+    [[nodiscard]] Iterator upper_bound(const void* key_bytes, Compare comp) const
+    {
+        const auto* key = reinterpret_cast<const std::byte*>(key_bytes);
+        NodeIndex result = NULL_INDEX;
+        for (NodeIndex i = root_index(tree_ptr_); i != NULL_INDEX;)
+        {
+            if (comp(key, node_pointer(tree_ptr_, i)))
+            {
+                result = i;
+                i = left_index(tree_ptr_, i);
+            }
+            else
+            {
+                i = right_index(tree_ptr_, i);
+            }
         }
+        return Iterator(tree_ptr_, result);
+    }
 
-        /**
-         * Calculate the size of each tree node used in the red-black tree, using the input sizes
-         * as the size of the key and value types.
-         */
-        [[nodiscard]] std::size_t tree_node_size_bytes() const
+    template <class Compare>
+    [[nodiscard]] Iterator find(const void* key_bytes, Compare comp) const
+    {
+        const Iterator it = lower_bound(key_bytes, comp);
+        if (it == end() || comp(reinterpret_cast<const std::byte*>(key_bytes), *it))
         {
-            using namespace fixed_red_black_tree_detail;
+            return end();
+        }
+        return it;
+    }
 
-            /*
-             * Calculate the size of the tree node by calculating the compile-time size with a
-             * native pointer type as the Key, adding the size of the value type, subtracting the
-             * pointer size from the result and rounding up for alignment.
-             */
-            std::size_t base_node_size_bytes = 0;
-            switch (compactness_)
+    template <class Compare>
+    [[nodiscard]] bool contains(const void* key_bytes, Compare comp) const
+    {
+        return find(key_bytes, comp) != end();
+    }
+
+    /**
+     * Descend from the root to the element at position `n` in sorted order, skipping the left
+     * subtrees by their size. Returns end() if `n` is not less than size().
+     */
+    [[nodiscard]] Iterator nth(std::size_t n) const
+        requires(STORAGE_TYPE == StorageType::FIXED_INDEX_ORDER_STATISTIC_POOL)
+    {
+        NodeIndex i = root_index(tree_ptr_);
+        while (i != NULL_INDEX)
+        {
+            const NodeIndex left = left_index(tree_ptr_, i);
+            const std::size_t left_size = left == NULL_INDEX ? 0 : subtree_size(tree_ptr_, left);
+            if (n < left_size)
+            {
+                i = left;
+            }
+            else if (n == left_size)
             {
-            case Compactness::DEDICATED_COLOR:
-                base_node_size_bytes = sizeof(DefaultRedBlackTreeNode<uintptr_t>);
-                break;
-            case Compactness::EMBEDDED_COLOR:
-                base_node_size_bytes = sizeof(CompactRedBlackTreeNode<uintptr_t>);
                 break;
             }
-
-            return align_up(base_node_size_bytes - sizeof(uintptr_t) + elem_size_bytes_,
-                            sizeof(uintptr_t));
+            else
+            {
+                n -= left_size + 1;
+                i = right_index(tree_ptr_, i);
+            }
         }
-    };
+        return Iterator(tree_ptr_, i);
+    }
+
+    /**
+     * Calculate the pointer to the value of the element at `it`. With FIXED_INDEX_SPLIT_POOL, the
+     * values of a map live in a parallel array instead of after their keys.
+     */
+    [[nodiscard]] const std::byte* value_pointer(const Iterator& it) const
+        requires(STORAGE_TYPE == StorageType::FIXED_INDEX_SPLIT_POOL && VALUE_SIZE_BYTES > 0)
+    {
+        assert(it.index_ != NULL_INDEX);
+        return std::next(tree_ptr_,
+                         static_cast<difference_type>(LAYOUT.values_offset_bytes +
+                                                      it.index_ * LAYOUT.value_stride_bytes));
+    }
 
 private:
-    const std::byte* tree_ptr_;
-    const std::size_t elem_size_bytes_;
-    const std::size_t max_size_bytes_;
-    const Compactness compactness_;
-    const StorageType storage_type_;
+    [[nodiscard]] static const std::byte* node_pointer(const std::byte* tree_ptr, NodeIndex i)
+    {
+        if (i == NULL_INDEX)
+        {
+            return nullptr;
+        }
+        return std::next(
+            tree_ptr,
+            static_cast<difference_type>(LAYOUT.nodes_offset_bytes + i * LAYOUT.node_stride_bytes));
+    }
 
-public:
-    FixedRedBlackTreeRawView(const void* tree_ptr,
-                             std::size_t elem_size_bytes,
-                             std::size_t max_size_bytes,
-                             Compactness compactness,
-                             StorageType storage_type)
-      : tree_ptr_{reinterpret_cast<const std::byte*>(tree_ptr)}
-      , elem_size_bytes_{elem_size_bytes}
-      , max_size_bytes_{max_size_bytes}
-      , compactness_{compactness}
-      , storage_type_{storage_type}
+    [[nodiscard]] static const std::byte* link_pointer(const std::byte* tree_ptr,
+                                                       NodeIndex i,
+                                                       std::size_t link)
     {
+        return std::next(
+            node_pointer(tree_ptr, i),
+            static_cast<difference_type>(LAYOUT.links_offset_bytes + link * sizeof(LinkType)));
     }
 
-    Iterator begin() const
+    [[nodiscard]] static NodeIndex left_index(const std::byte* tree_ptr, NodeIndex i)
     {
-        return Iterator(tree_ptr_, elem_size_bytes_, max_size_bytes_, compactness_, storage_type_);
+        return fixed_red_black_tree_detail::widen_node_index(
+            *reinterpret_cast<const LinkType*>(link_pointer(tree_ptr, i, 1)));
     }
 
-    Iterator end() const
+    [[nodiscard]] static NodeIndex right_index(const std::byte* tree_ptr, NodeIndex i)
     {
-        return Iterator(
-            tree_ptr_, elem_size_bytes_, max_size_bytes_, compactness_, storage_type_, true);
+        return fixed_red_black_tree_detail::widen_node_index(
+            *reinterpret_cast<const LinkType*>(link_pointer(tree_ptr, i, 2)));
     }
 
-    std::size_t size() const { return end().size(); }
+    [[nodiscard]] static NodeIndex parent_index(const std::byte* tree_ptr, NodeIndex i)
+    {
+        using namespace fixed_red_black_tree_detail;
+        const std::byte* ptr = link_pointer(tree_ptr, i, 0);
+        if constexpr (COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR)
+        {
+            return reinterpret_cast<
+                       const NodeIndexWithColorEmbeddedInTheMostSignificantBit<LinkType>*>(ptr)
+                ->get_index();
+        }
+        else
+        {
+            return widen_node_index(*reinterpret_cast<const LinkType*>(ptr));
+        }
+    }
+
+    [[nodiscard]] static std::size_t subtree_size(const std::byte* tree_ptr, NodeIndex i)
+    {
+        return *reinterpret_cast<const SubtreeSizeType*>(
+            std::next(node_pointer(tree_ptr, i),
+                      static_cast<difference_type>(LAYOUT.subtree_size_offset_bytes)));
+    }
+
+    [[nodiscard]] static NodeIndex root_index(const std::byte* tree_ptr)
+    {
+        return *reinterpret_cast<const NodeIndex*>(
+            std::next(tree_ptr, static_cast<difference_type>(LAYOUT.root_index_offset_bytes)));
+    }
+
+    [[nodiscard]] static NodeIndex min_index(const std::byte* tree_ptr)
+    {
+        NodeIndex i = root_index(tree_ptr);
+        if (i == NULL_INDEX)
+        {
+            return NULL_INDEX;
+        }
+        for (NodeIndex left = left_index(tree_ptr, i); left != NULL_INDEX;
+             i = left, left = left_index(tree_ptr, i))
+        {
+        }
+        return i;
+    }
+
+    [[nodiscard]] static NodeIndex max_index(const std::byte* tree_ptr)
+    {
+        NodeIndex i = root_index(tree_ptr);
+        if (i == NULL_INDEX)
+        {
+            return NULL_INDEX;
+        }
+        for (NodeIndex right = right_index(tree_ptr, i); right != NULL_INDEX;
+             i = right, right = right_index(tree_ptr, i))
+        {
+        }
+        return i;
+    }
+
+    /**
+     * Traverse the tree starting at the node corresponding to index `i` to find the successor
+     * node and return its index.
+     */
+    [[nodiscard]] static NodeIndex successor(const std::byte* tree_ptr, NodeIndex i)
+    {
+        if (i == NULL_INDEX)
+        {
+            return NULL_INDEX;
+        }
+
+        NodeIndex s = right_index(tree_ptr, i);
+        if (s != NULL_INDEX)
+        {
+            for (NodeIndex left = left_index(tree_ptr, s); left != NULL_INDEX;
+                 s = left, left = left_index(tree_ptr, s))
+            {
+            }
+            return s;
+        }
+
+        s = parent_index(tree_ptr, i);
+        NodeIndex ch = i;
+        while (s != NULL_INDEX && ch == right_index(tree_ptr, s))
+        {
+            ch = s;
+            s = parent_index(tree_ptr, s);
+        }
+        return s;
+    }
+
+    /**
+     * Mirror image of successor().
+     */
+    [[nodiscard]] static NodeIndex predecessor(const std::byte* tree_ptr, NodeIndex i)
+    {
+        if (i == NULL_INDEX)
+        {
+            return NULL_INDEX;
+        }
+
+        NodeIndex s = left_index(tree_ptr, i);
+        if (s != NULL_INDEX)
+        {
+            for (NodeIndex right = right_index(tree_ptr, s); right != NULL_INDEX;
+                 s = right, right = right_index(tree_ptr, s))
+            {
+            }
+            return s;
+        }
+
+        s = parent_index(tree_ptr, i);
+        NodeIndex ch = i;
+        while (s != NULL_INDEX && ch == left_index(tree_ptr, s))
+        {
+            ch = s;
+            s = parent_index(tree_ptr, s);
+        }
+        return s;
+    }
 };
 
 }  // namespace fixed_containers
@@ -7,8 +7,14 @@
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
 
 namespace fixed_containers::fixed_set_customize
 {
@@ -71,6 +77,8 @@ private:
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
         FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    static constexpr bool HAS_ORDER_STATISTICS =
+        fixed_red_black_tree_detail::TRACKS_SUBTREE_SIZES<StorageTemplate>;
 
     struct ReferenceProvider
     {
@@ -172,6 +180,31 @@ public:
         this->insert(list, loc);
     }
 
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`, in linear time.
+     * See `insert_sorted()`.
+     */
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedSet from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        FixedSet out{comparator};
+        out.insert_sorted(first, last, loc);
+        return out;
+    }
+    [[nodiscard]] static constexpr FixedSet from_sorted_unique(
+        std::initializer_list<value_type> list,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return from_sorted_unique(list.begin(), list.end(), comparator, loc);
+    }
+
 public:
     constexpr const_iterator cbegin() const noexcept
     {
@@ -227,19 +260,37 @@ public:
         tree().insert_new_at(np, std::move(value));
         return {create_const_iterator(np.i), true};
     }
-    constexpr const_iterator insert(const_iterator /*hint*/,
+    constexpr const_iterator insert(const_iterator hint,
                                     const K& key,
                                     const std_transition::source_location& loc =
                                         std_transition::source_location::current()) noexcept
     {
-        return insert(key, loc).first;
+        NodeIndexAndParentIndex np =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np.i))
+        {
+            return create_const_iterator(np.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np, key);
+        return create_const_iterator(np.i);
     }
-    constexpr const_iterator insert(const_iterator /*hint*/,
+    constexpr const_iterator insert(const_iterator hint,
                                     K&& key,
                                     const std_transition::source_location& loc =
                                         std_transition::source_location::current()) noexcept
     {
-        return insert(std::move(key), loc).first;
+        NodeIndexAndParentIndex np =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np.i))
+        {
+            return create_const_iterator(np.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np, std::move(key));
+        return create_const_iterator(np.i);
     }
 
     template <InputIterator InputIt>
@@ -260,6 +311,56 @@ public:
         this->insert(list.begin(), list.end(), loc);
     }
 
+    /**
+     * Insert entries that are sorted and unique according to the comparator. If the range is
+     * forward-iterable, this takes linear time instead of O(n log n) with rebalancing:
+     *  - if the container is empty, the tree is built directly, with nodes laid out in iteration
+     *    order where the storage allows it.
+     *  - otherwise, the entries are merged in place into the in-order sequence of the existing
+     *    entries, which is then relinked as a balanced tree. Entries already present are not
+     *    moved, so iterators to them remain valid, and entries whose key is already present are
+     *    not inserted.
+     * Otherwise, this is equivalent to `insert(first, last)`.
+     * Passing entries that are not sorted and unique is undefined behavior when the fast path is
+     * taken.
+     */
+    template <InputIterator InputIt>
+    constexpr void insert_sorted(InputIt first,
+                                 InputIt last,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            // More unique keys than MAXIMUM_SIZE can never fit, whatever is already present
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            if (preconditions::test(count <= MAXIMUM_SIZE))
+            {
+                CheckingType::length_error(count, loc);
+            }
+            if (empty())
+            {
+                tree().build_from_sorted_unique(first, count);
+                return;
+            }
+
+            if (preconditions::test(tree().merge_sorted_unique(first, last)))
+            {
+                CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+            }
+        }
+        else
+        {
+            this->insert(first, last, loc);
+        }
+    }
+    constexpr void insert_sorted(std::initializer_list<value_type> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+    {
+        this->insert_sorted(list.begin(), list.end(), loc);
+    }
+
     constexpr const_iterator erase(const_iterator pos) noexcept
     {
         assert(pos != cend());
@@ -281,6 +382,86 @@ public:
 
     constexpr size_type erase(const K& key) noexcept { return tree().delete_node(key); }
 
+    /**
+     * Removes the entry at `pos` and returns it. Along with insert(), this moves entries between
+     * containers the way node handles do for std::set.
+     */
+    [[nodiscard]] constexpr value_type extract(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        const NodeIndex i = index_of_hint(pos);
+        value_type out = std::move(tree().node_at(i).key());
+        tree().delete_at_and_return_successor(i);
+        return out;
+    }
+    /**
+     * Removes the entry with the given key, if any, and returns it.
+     */
+    [[nodiscard]] constexpr std::optional<value_type> extract(const K& key) noexcept
+    {
+        const NodeIndex i = tree().index_of_node_or_null(key);
+        if (!tree().contains_at(i))
+        {
+            return std::nullopt;
+        }
+        std::optional<value_type> out{std::move(tree().node_at(i).key())};
+        tree().delete_at_and_return_successor(i);
+        return out;
+    }
+
+    /**
+     * Moves the entries of `other` whose key is not in this set into it. The other entries stay
+     * in `other`. Unlike std::set::merge(), entries are moved rather than spliced, but this is
+     * done in linear time: both trees are flattened, merged and relinked as balanced trees, with
+     * no per-entry lookup or rebalancing. Entries of this set are not moved, so iterators to
+     * them remain valid.
+     */
+    constexpr void merge(FixedSet& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(tree().merge_from(other.tree())))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void merge(FixedSet&& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        merge(other, loc);
+    }
+
+    /**
+     * Linear-time set algebra between FixedSets of the same type. The in-order sequences are merged
+     * and the result is built directly as a balanced tree, instead of inserting (and rebalancing)
+     * one entry at a time. Entries are copied from `a`, except for the ones that are only in `b`.
+     */
+    [[nodiscard]] friend constexpr FixedSet set_union(
+        const FixedSet& a,
+        const FixedSet& b,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return merged(a, b, fixed_red_black_tree_detail::SortedMergeKind::UNION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedSet set_intersection(
+        const FixedSet& a,
+        const FixedSet& b,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return merged(a, b, fixed_red_black_tree_detail::SortedMergeKind::INTERSECTION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedSet set_difference(
+        const FixedSet& a,
+        const FixedSet& b,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return merged(a, b, fixed_red_black_tree_detail::SortedMergeKind::DIFFERENCE, loc);
+    }
+
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
         const NodeIndex i = tree().index_of_node_or_null(key);
@@ -305,6 +486,22 @@ public:
         return create_const_iterator(i);
     }
 
+    // Batched lookups: `out[j]` receives the result of looking up `keys[j]`.
+    // Several descents are run in lockstep, with the next node of each prefetched, so this is
+    // faster than a loop of find() when the set does not fit in the cache.
+    constexpr void find_batch(const std::span<const K> keys,
+                              const std::span<const_iterator> out) const noexcept
+    {
+        find_batch_impl(keys, out);
+    }
+    template <class K0>
+    constexpr void find_batch(const std::span<const K0> keys,
+                              const std::span<const_iterator> out) const noexcept
+        requires IsTransparent<Compare>
+    {
+        find_batch_impl(keys, out);
+    }
+
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
         return tree().contains_node(key);
@@ -317,6 +514,19 @@ public:
         return tree().contains_node(key);
     }
 
+    constexpr void contains_batch(const std::span<const K> keys,
+                                  const std::span<bool> out) const noexcept
+    {
+        contains_batch_impl(keys, out);
+    }
+    template <class K0>
+    constexpr void contains_batch(const std::span<const K0> keys,
+                                  const std::span<bool> out) const noexcept
+        requires IsTransparent<Compare>
+    {
+        contains_batch_impl(keys, out);
+    }
+
     [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
     {
         return static_cast<std::size_t>(contains(key));
@@ -368,6 +578,60 @@ public:
         return equal_range_impl(np);
     }
 
+    // Order statistics, in O(log n). Only available with FixedIndexBasedOrderStatisticPoolStorage,
+    // whose nodes keep the size of their subtree.
+    // `nth(n)` is the n-th smallest entry (0-based), or end() if n >= size().
+    [[nodiscard]] constexpr const_iterator nth(const std::size_t n) const noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return create_const_iterator(tree().index_of_nth_at(n));
+    }
+    // Number of entries less than `key`
+    [[nodiscard]] constexpr std::size_t rank_of(const K& key) const noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return tree().rank_of(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t rank_of(const K0& key) const noexcept
+        requires HAS_ORDER_STATISTICS && IsTransparent<Compare>
+    {
+        return tree().rank_of(key);
+    }
+    // Number of entries in [lo, hi)
+    [[nodiscard]] constexpr std::size_t count_in_range(const K& lo, const K& hi) const noexcept
+        requires HAS_ORDER_STATISTICS
+    {
+        return count_in_range_impl(lo, hi);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr std::size_t count_in_range(const K0& lo, const K1& hi) const noexcept
+        requires HAS_ORDER_STATISTICS && IsTransparent<Compare>
+    {
+        return count_in_range_impl(lo, hi);
+    }
+
+    // Storage layout. After many insertions and erasures, entries that are next to each other in
+    // iteration order can end up scattered across the storage, and iterating becomes random access.
+    // `fragmentation()` is the number of entries whose successor is not stored right after them.
+    // `compact_in_order()` relocates the entries so that iteration walks the storage linearly
+    // again, which brings fragmentation() down to 0. The overload taking `max_moves` stops after
+    // moving that many entries and returns whether it is done, so it can be spread over idle
+    // periods. Each of those calls still walks all the entries.
+    // Relocating entries invalidates all iterators and references.
+    [[nodiscard]] constexpr std::size_t fragmentation() const noexcept
+    {
+        return tree().fragmentation();
+    }
+    constexpr void compact_in_order() noexcept
+    {
+        tree().compact_in_order((std::numeric_limits<std::size_t>::max)());
+    }
+    constexpr bool compact_in_order(const std::size_t max_moves) noexcept
+    {
+        return tree().compact_in_order(max_moves);
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -401,6 +665,19 @@ private:
     constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
     constexpr const Tree& tree() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
 
+    static constexpr FixedSet merged(const FixedSet& a,
+                                  const FixedSet& b,
+                                  const fixed_red_black_tree_detail::SortedMergeKind kind,
+                                  const std_transition::source_location& loc) noexcept
+    {
+        FixedSet out{a.tree().key_comp()};
+        if (preconditions::test(out.tree().assign_merged(a.tree(), b.tree(), kind)))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+        return out;
+    }
+
     constexpr const_iterator create_const_iterator(const NodeIndex& start_index) const noexcept
     {
         const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
@@ -412,6 +689,42 @@ private:
         return const_reverse_iterator{ReferenceProvider{&tree(), start_index}};
     }
 
+    template <class K0, class K1>
+    [[nodiscard]] constexpr std::size_t count_in_range_impl(const K0& lo,
+                                                            const K1& hi) const noexcept
+    {
+        const std::size_t lo_rank = tree().rank_of(lo);
+        const std::size_t hi_rank = tree().rank_of(hi);
+        return hi_rank > lo_rank ? hi_rank - lo_rank : 0;
+    }
+
+    template <class K0>
+    constexpr void find_batch_impl(const std::span<const K0> keys,
+                                   const std::span<const_iterator> out) const noexcept
+    {
+        assert(keys.size() == out.size());
+        tree().for_each_index_of_node_or_null(keys,
+                                              [this, &out](const std::size_t j, const NodeIndex& i)
+                                              { out[j] = create_const_iterator(i); });
+    }
+    template <class K0>
+    constexpr void contains_batch_impl(const std::span<const K0> keys,
+                                       const std::span<bool> out) const noexcept
+    {
+        assert(keys.size() == out.size());
+        tree().for_each_index_of_node_or_null(keys,
+                                              [this, &out](const std::size_t j, const NodeIndex& i)
+                                              { out[j] = tree().contains_at(i); });
+    }
+
+    // Inverse of replace_null_index_with_max_size_for_end_iterator()
+    static constexpr NodeIndex index_of_hint(const const_iterator& hint) noexcept
+    {
+        const NodeIndex i =
+            hint.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().current_index_;
+        return i == MAXIMUM_SIZE ? NULL_INDEX : i;
+    }
+
     constexpr void check_not_full(const std_transition::source_location& loc) const
     {
         if (preconditions::test(!tree().full()))
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_spsc_queue_detail
+{
+using cache_line_detail::CACHE_LINE_SIZE;
+
+template <typename T, std::size_t CAPACITY>
+class FixedSpscQueueBase
+{
+    using OptionalT = optional_storage_detail::OptionalStorage<T>;
+    static_assert(consteval_compare::equal<sizeof(OptionalT), sizeof(T)>);
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "Queue must have a non-const, non-volatile value_type");
+    static_assert(CAPACITY > 0);
+    // Lock-free atomics are also address-free, which is what allows the queue to be shared
+    // between processes.
+    static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+    // Each side owns a cache line: the index it publishes, plus its last observation of the
+    // other side's index. The other side's line is only read when that observation says the
+    // queue is full (for the producer) or empty (for the consumer).
+    struct alignas(CACHE_LINE_SIZE) ProducerState
+    {
+        std::atomic<std::size_t> tail{0};
+        std::size_t cached_head{0};
+    };
+    struct alignas(CACHE_LINE_SIZE) ConsumerState
+    {
+        std::atomic<std::size_t> head{0};
+        std::size_t cached_tail{0};
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    // Indices count pushes/pops and are never wrapped themselves; only the slot is. This keeps
+    // every slot usable and makes "full" simply `tail - head == CAPACITY`.
+    static constexpr std::size_t slot_of(const std::size_t i) noexcept
+    {
+        if constexpr (std::has_single_bit(CAPACITY))
+        {
+            return i & (CAPACITY - 1);
+        }
+        else
+        {
+            return i % CAPACITY;
+        }
+    }
+
+    ProducerState producer_;
+    ConsumerState consumer_;
+    alignas(CACHE_LINE_SIZE) std::array<OptionalT, CAPACITY> array_;
+
+public:
+    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
+    static constexpr std::size_t max_size() noexcept { return capacity(); }
+
+    FixedSpscQueueBase() noexcept
+      : producer_{}
+      , consumer_{}
+    // Don't initialize the array
+    {
+    }
+
+    FixedSpscQueueBase(const FixedSpscQueueBase&) = delete;
+    FixedSpscQueueBase(FixedSpscQueueBase&&) = delete;
+    FixedSpscQueueBase& operator=(const FixedSpscQueueBase&) = delete;
+    FixedSpscQueueBase& operator=(FixedSpscQueueBase&&) = delete;
+
+    /**
+     * Producer side. Returns false, without touching `v`, if the queue is full.
+     */
+    bool try_push(const value_type& v) { return try_emplace(v); }
+    bool try_push(value_type&& v) { return try_emplace(std::move(v)); }
+
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+        if (free_slots_for_producer(tail, 1) == 0)
+        {
+            return false;
+        }
+        optional_storage_detail::construct_at(&array_[slot_of(tail)],
+                                              std::forward<Args>(args)...);
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Producer side. Pushes up to `count` elements starting at `first` and publishes them all at
+     * once. Returns the number of elements pushed, which is less than `count` only if the queue
+     * ran out of space.
+     */
+    template <InputIterator InputIt>
+    std::size_t try_push_n(InputIt first, const std::size_t count)
+    {
+        const std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+        const std::size_t n = (std::min)(count, free_slots_for_producer(tail, count));
+        for (std::size_t i = 0; i < n; ++i, ++first)
+        {
+            optional_storage_detail::construct_at(&array_[slot_of(tail + i)], *first);
+        }
+        if (n > 0)
+        {
+            producer_.tail.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * Consumer side. Returns std::nullopt if the queue is empty.
+     */
+    std::optional<value_type> try_pop()
+    {
+        const std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+        if (used_slots_for_consumer(head, 1) == 0)
+        {
+            return std::nullopt;
+        }
+        std::optional<value_type> out{std::move(array_[slot_of(head)].value)};
+        destroy_at(slot_of(head));
+        consumer_.head.store(head + 1, std::memory_order_release);
+        return out;
+    }
+
+    /**
+     * Consumer side. Moves up to `max_count` elements to `out` and releases their slots at once.
+     * Returns the number of elements popped.
+     */
+    template <class OutputIt>
+    std::size_t try_pop_n(OutputIt out, const std::size_t max_count)
+    {
+        const std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+        const std::size_t n = (std::min)(max_count, used_slots_for_consumer(head, max_count));
+        for (std::size_t i = 0; i < n; ++i, ++out)
+        {
+            const std::size_t slot = slot_of(head + i);
+            *out = std::move(array_[slot].value);
+            destroy_at(slot);
+        }
+        if (n > 0)
+        {
+            consumer_.head.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * Size. Exact when called while neither side is running; otherwise a snapshot that may
+     * already be stale.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::size_t head = consumer_.head.load(std::memory_order_acquire);
+        const std::size_t tail = producer_.tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    // Slots the producer may fill, re-reading the consumer's index only when the cached value
+    // does not leave room for `wanted` elements.
+    std::size_t free_slots_for_producer(const std::size_t tail, const std::size_t wanted)
+    {
+        std::size_t free_slots = CAPACITY - (tail - producer_.cached_head);
+        if (free_slots < wanted)
+        {
+            producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+            free_slots = CAPACITY - (tail - producer_.cached_head);
+        }
+        return free_slots;
+    }
+
+    // Elements the consumer may take, re-reading the producer's index only when the cached value
+    // does not cover `wanted` elements.
+    std::size_t used_slots_for_consumer(const std::size_t head, const std::size_t wanted)
+    {
+        std::size_t used_slots = consumer_.cached_tail - head;
+        if (used_slots < wanted)
+        {
+            consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+            used_slots = consumer_.cached_tail - head;
+        }
+        return used_slots;
+    }
+
+    // [WORKAROUND-1] - Needed by the non-trivially-destructible flavor of FixedSpscQueue
+protected:
+    void destroy_at(std::size_t)
+        requires TriviallyDestructible<T>
+    {
+    }
+    void destroy_at(const std::size_t slot)
+        requires NotTriviallyDestructible<T>
+    {
+        array_[slot].value.~T();
+    }
+
+    // Destroys whatever is still queued. Only valid when no other thread is using the queue.
+    void destroy_remaining()
+    {
+        const std::size_t head = consumer_.head.load(std::memory_order_acquire);
+        const std::size_t tail = producer_.tail.load(std::memory_order_acquire);
+        for (std::size_t i = head; i != tail; i++)
+        {
+            destroy_at(slot_of(i));
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_spsc_queue_detail
+
+namespace fixed_containers::fixed_spsc_queue_detail::specializations
+{
+template <typename T, std::size_t CAPACITY>
+class FixedSpscQueue : public fixed_spsc_queue_detail::FixedSpscQueueBase<T, CAPACITY>
+{
+    using Base = fixed_spsc_queue_detail::FixedSpscQueueBase<T, CAPACITY>;
+
+public:
+    FixedSpscQueue() noexcept
+      : Base()
+    {
+    }
+
+    FixedSpscQueue(const FixedSpscQueue&) = delete;
+    FixedSpscQueue(FixedSpscQueue&&) = delete;
+    FixedSpscQueue& operator=(const FixedSpscQueue&) = delete;
+    FixedSpscQueue& operator=(FixedSpscQueue&&) = delete;
+
+    ~FixedSpscQueue() noexcept { this->destroy_remaining(); }
+};
+
+template <TriviallyDestructible T, std::size_t CAPACITY>
+class FixedSpscQueue<T, CAPACITY> : public fixed_spsc_queue_detail::FixedSpscQueueBase<T, CAPACITY>
+{
+    using Base = fixed_spsc_queue_detail::FixedSpscQueueBase<T, CAPACITY>;
+
+public:
+    FixedSpscQueue() noexcept
+      : Base()
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_spsc_queue_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity, lock-free, single-producer/single-consumer queue with maximum size that is
+ * declared at compile-time via template parameter. Properties:
+ *  - wait-free try_push/try_pop, with batch variants that publish many elements per atomic store
+ *  - producer and consumer indices live on separate cache lines, and each side caches the other's
+ *    index so that the shared line is only read when the queue looks full/empty
+ *  - no pointers stored (data layout is purely self-referential), so it can be placed in memory
+ *    shared between processes
+ *  - no dynamic allocations
+ *
+ * Exactly one thread may call the producer functions (try_push, try_emplace, try_push_n) and
+ * exactly one thread may call the consumer functions (try_pop, try_pop_n) at any given time.
+ */
+template <typename T, std::size_t CAPACITY>
+class FixedSpscQueue : public fixed_spsc_queue_detail::specializations::FixedSpscQueue<T, CAPACITY>
+{
+    using Base = fixed_spsc_queue_detail::specializations::FixedSpscQueue<T, CAPACITY>;
+
+public:
+    FixedSpscQueue() noexcept
+      : Base()
+    {
+    }
+};
+
+}  // namespace fixed_containers
@@ -0,0 +1,658 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_hash_table.hpp"
+#include "fixed_containers/hash.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+namespace fixed_containers::fixed_unordered_map_customize
+{
+template <class T, class K>
+concept FixedUnorderedMapChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::out_of_range(key, size, loc);  // ~ std::out_of_range
+        T::length_error(size, loc);       // ~ std::length_error
+    };
+
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+    static constexpr auto VALUE_TYPE_NAME = fixed_containers::type_name<V>();
+
+    [[noreturn]] static constexpr void out_of_range(const K& /*key*/,
+                                                    const std::size_t /*size*/,
+                                                    const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::fixed_unordered_map_customize
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity open-addressing hash map with maximum size that is declared at compile-time via
+ * template parameter. Lookups probe groups of 8 control bytes at a time (SwissTable-style).
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * Unlike std::unordered_map, erasing moves the last entry into the erased position, so
+ * iterators are invalidated on removal (except for the one returned by `erase()`).
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = fixed_containers::Hash<K>,
+          class KeyEqual = fixed_containers::EqualTo<K>,
+          fixed_unordered_map_customize::FixedUnorderedMapChecking<K> CheckingType =
+              fixed_unordered_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedUnorderedMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    using Table = fixed_hash_table_detail::FixedHashTable<K, V, MAXIMUM_SIZE, Hash, KeyEqual>;
+    using SlotLookup = fixed_hash_table_detail::SlotLookup;
+    static constexpr std::size_t NULL_INDEX = fixed_hash_table_detail::NULL_INDEX;
+
+    template <bool IS_CONST>
+    struct PairProvider
+    {
+        using ConstOrMutableTable = std::conditional_t<IS_CONST, const Table, Table>;
+        using ConstOrMutablePair =
+            std::conditional_t<IS_CONST, std::pair<const K&, const V&>, std::pair<const K&, V&>>;
+
+        ConstOrMutableTable* table_;
+        std::size_t current_index_;
+
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, MAXIMUM_SIZE}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableTable* const table,
+                               const std::size_t& current_index) noexcept
+          : table_{table}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.table_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            current_index_ = replace_past_the_last_index_with_max_size_for_end_iterator(
+                table_, current_index_ + 1);
+        }
+        constexpr void recede() noexcept
+        {
+            current_index_ = current_index_ == MAXIMUM_SIZE ? table_->size() - 1
+                                                            : current_index_ - 1;
+        }
+
+        constexpr const_reference get() const noexcept
+            requires IS_CONST
+        {
+            const auto& entry = table_->entry_at(current_index_);
+            return {entry.key(), entry.value()};
+        }
+        constexpr reference get() const noexcept
+            requires(not IS_CONST)
+        {
+            auto& entry = table_->entry_at(current_index_);
+            return {entry.key(), entry.value()};
+        }
+
+        constexpr bool operator==(const PairProvider& other) const noexcept
+        {
+            return table_ == other.table_ && current_index_ == other.current_index_;
+        }
+        constexpr bool operator==(const PairProvider<!IS_CONST>& other) const noexcept
+        {
+            return table_ == other.table_ && current_index_ == other.current_index_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS>
+    using Iterator = BidirectionalIterator<PairProvider<true>,
+                                           PairProvider<false>,
+                                           CONSTNESS,
+                                           IteratorDirection::FORWARD>;
+
+    // Entries are contiguous, so the index past the last entry changes on every insertion and
+    // removal. For the purposes of iterators, use MAXIMUM_SIZE for end()
+    static constexpr std::size_t replace_past_the_last_index_with_max_size_for_end_iterator(
+        const Table* table, const std::size_t& i) noexcept
+    {
+        return i >= table->size() ? MAXIMUM_SIZE : i;
+    }
+
+public:
+    using const_iterator = Iterator<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR>;
+    using size_type = typename Table::size_type;
+    using difference_type = typename Table::difference_type;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Table IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+
+public:
+    constexpr FixedUnorderedMap() noexcept
+      : FixedUnorderedMap{Hash{}}
+    {
+    }
+
+    explicit constexpr FixedUnorderedMap(const Hash& hash,
+                                         const KeyEqual& equal = KeyEqual{}) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_table_{hash, equal}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedUnorderedMap(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash{},
+        const KeyEqual& equal = KeyEqual{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedUnorderedMap{hash, equal}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedUnorderedMap(std::initializer_list<value_type> list,
+                                const Hash& hash = Hash{},
+                                const KeyEqual& equal = KeyEqual{},
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+      : FixedUnorderedMap{hash, equal}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const std::size_t i = table().index_of_entry_or_null(key);
+        if (preconditions::test(i != NULL_INDEX))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return table().entry_at(i).value();
+    }
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t i = table().index_of_entry_or_null(key);
+        if (preconditions::test(i != NULL_INDEX))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return table().entry_at(i).value();
+    }
+
+    constexpr V& operator[](const K& key) noexcept
+    {
+        const SlotLookup lookup = table().lookup_for_insertion(key);
+        if (lookup.found)
+        {
+            return table().entry_at(table().entry_index_at_slot(lookup.slot)).value();
+        }
+
+        // Cannot capture real source_location for operator[]
+        check_not_full(std_transition::source_location::current());
+        return table().entry_at(table().insert_new_at(lookup, key)).value();
+    }
+    constexpr V& operator[](K&& key) noexcept
+    {
+        const SlotLookup lookup = table().lookup_for_insertion(key);
+        if (lookup.found)
+        {
+            return table().entry_at(table().entry_index_at_slot(lookup.slot)).value();
+        }
+
+        // Cannot capture real source_location for operator[]
+        check_not_full(std_transition::source_location::current());
+        return table().entry_at(table().insert_new_at(lookup, std::move(key))).value();
+    }
+
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(MAXIMUM_SIZE); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(MAXIMUM_SIZE); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return table().empty(); }
+
+    constexpr void clear() noexcept { table().clear(); }
+
+    [[nodiscard]] constexpr hasher hash_function() const { return table().hash_function(); }
+    [[nodiscard]] constexpr key_equal key_eq() const { return table().key_eq(); }
+
+    constexpr std::pair<iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return try_emplace_impl(loc, value.first, value.second);
+    }
+    constexpr std::pair<iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return try_emplace_impl(loc, value.first, std::move(value.second));
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        const K& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        const SlotLookup lookup = table().lookup_for_insertion(key);
+        if (lookup.found)
+        {
+            const std::size_t i = table().entry_index_at_slot(lookup.slot);
+            table().entry_at(i).value() = std::forward<M>(obj);
+            return {create_iterator(i), false};
+        }
+
+        check_not_full(loc);
+        return {create_iterator(table().insert_new_at(lookup, key, std::forward<M>(obj))), true};
+    }
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        K&& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        const SlotLookup lookup = table().lookup_for_insertion(key);
+        if (lookup.found)
+        {
+            const std::size_t i = table().entry_index_at_slot(lookup.slot);
+            table().entry_at(i).value() = std::forward<M>(obj);
+            return {create_iterator(i), false};
+        }
+
+        check_not_full(loc);
+        const std::size_t i =
+            table().insert_new_at(lookup, std::move(key), std::forward<M>(obj));
+        return {create_iterator(i), true};
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        const K& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        K&& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(std::move(key), std::forward<M>(obj), loc).first;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
+    {
+        return try_emplace_impl(
+            std_transition::source_location::current(), key, std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) noexcept
+    {
+        return try_emplace_impl(std_transition::source_location::current(),
+                                std::move(key),
+                                std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    const K& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    K&& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
+    {
+        std::pair<K, V> as_pair{std::forward<Args>(args)...};
+        return try_emplace(std::move(as_pair.first), std::move(as_pair.second));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
+                                                     Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        const std::size_t i = index_of(pos);
+        table().erase_at(i);
+        return create_iterator(i);
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const std::size_t from = index_of(first);
+        const std::size_t to = index_of(last);
+        // Erase back-to-front: every removal moves the (surviving) last entry into the hole, so
+        // entries before the hole are never disturbed.
+        for (std::size_t i = to; i > from; i--)
+        {
+            table().erase_at(i - 1);
+        }
+        return create_iterator(from);
+    }
+
+    constexpr size_type erase(const K& key) noexcept { return table().erase_key(key); }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(table().index_of_entry_or_null(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(table().index_of_entry_or_null(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator find(const K0& key) noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return create_iterator(table().index_of_entry_or_null(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return create_const_iterator(table().index_of_entry_or_null(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return table().contains_key(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return table().contains_key(key);
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        const iterator it = find(key);
+        return {it, it == end() ? it : std::next(it)};
+    }
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const const_iterator it = find(key);
+        return {it, it == cend() ? it : std::next(it)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Hash2,
+              class KeyEqual2,
+              fixed_unordered_map_customize::FixedUnorderedMapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedUnorderedMap<K, V, MAXIMUM_SIZE_2, Hash2, KeyEqual2, CheckingType2>& other)
+        const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        if (this->size() != other.size())
+        {
+            return false;
+        }
+
+        for (const auto& [key, value] : *this)
+        {
+            const auto it = other.find(key);
+            if (it == other.cend() || !(it->second == value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    constexpr Table& table() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+    constexpr const Table& table() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+
+    template <class Key, class... Args>
+    constexpr std::pair<iterator, bool> try_emplace_impl(const std_transition::source_location& loc,
+                                                         Key&& key,
+                                                         Args&&... args) noexcept
+    {
+        const SlotLookup lookup = table().lookup_for_insertion(key);
+        if (lookup.found)
+        {
+            return {create_iterator(table().entry_index_at_slot(lookup.slot)), false};
+        }
+
+        check_not_full(loc);
+        const std::size_t i =
+            table().insert_new_at(lookup, std::forward<Key>(key), std::forward<Args>(args)...);
+        return {create_iterator(i), true};
+    }
+
+    // Inverse of create_iterator()
+    constexpr std::size_t index_of(const const_iterator& it) const noexcept
+    {
+        const std::size_t i =
+            it.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().current_index_;
+        return i == MAXIMUM_SIZE ? size() : i;
+    }
+
+    constexpr iterator create_iterator(const std::size_t& start_index) noexcept
+    {
+        const std::size_t i =
+            replace_past_the_last_index_with_max_size_for_end_iterator(&table(), start_index);
+        return iterator{PairProvider<false>{&table(), i}};
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t& start_index) const noexcept
+    {
+        const std::size_t i =
+            replace_past_the_last_index_with_max_size_for_end_iterator(&table(), start_index);
+        return const_iterator{PairProvider<true>{&table(), i}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!table().full()))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          fixed_unordered_map_customize::FixedUnorderedMapChecking<K> CheckingType>
+constexpr typename FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>::size_type
+is_full(const FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          fixed_unordered_map_customize::FixedUnorderedMapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>::size_type
+erase_if(FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>& c,
+         Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(c, predicate);
+}
+
+/**
+ * Construct a FixedUnorderedMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <typename K,
+          typename V,
+          typename Hash = fixed_containers::Hash<K>,
+          typename KeyEqual = fixed_containers::EqualTo<K>,
+          fixed_unordered_map_customize::FixedUnorderedMapChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedUnorderedMapType =
+              FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>>
+[[nodiscard]] constexpr FixedUnorderedMapType make_fixed_unordered_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    FixedUnorderedMapType map{hash, equal};
+    for (const auto& item : list)
+    {
+        map.insert(item, loc);
+    }
+    return map;
+}
+
+template <typename K,
+          typename V,
+          typename Hash = fixed_containers::Hash<K>,
+          typename KeyEqual = fixed_containers::EqualTo<K>,
+          std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_unordered_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = fixed_unordered_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedUnorderedMapType =
+        FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>;
+    return make_fixed_unordered_map<K,
+                                    V,
+                                    Hash,
+                                    KeyEqual,
+                                    CheckingType,
+                                    MAXIMUM_SIZE,
+                                    FixedUnorderedMapType>(list, hash, equal, loc);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,440 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_hash_table.hpp"
+#include "fixed_containers/hash.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+namespace fixed_containers::fixed_unordered_set_customize
+{
+template <class T, class K>
+concept FixedUnorderedSetChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::length_error(size, loc);  // ~ std::length_error
+    };
+
+template <class K, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::fixed_unordered_set_customize
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity open-addressing hash set with maximum size that is declared at compile-time via
+ * template parameter. Lookups probe groups of 8 control bytes at a time (SwissTable-style).
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * Unlike std::unordered_set, erasing moves the last entry into the erased position, so
+ * iterators are invalidated on removal (except for the one returned by `erase()`).
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = fixed_containers::Hash<K>,
+          class KeyEqual = fixed_containers::EqualTo<K>,
+          fixed_unordered_set_customize::FixedUnorderedSetChecking<K> CheckingType =
+              fixed_unordered_set_customize::AbortChecking<K, MAXIMUM_SIZE>>
+class FixedUnorderedSet
+{
+public:
+    using key_type = K;
+    using value_type = K;
+    using const_reference = const value_type&;
+    using reference = const_reference;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using pointer = const_pointer;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    using Table = fixed_hash_table_detail::
+        FixedHashTable<K, fixed_hash_table_detail::EmptyValue, MAXIMUM_SIZE, Hash, KeyEqual>;
+    using SlotLookup = fixed_hash_table_detail::SlotLookup;
+    static constexpr std::size_t NULL_INDEX = fixed_hash_table_detail::NULL_INDEX;
+
+    struct ReferenceProvider
+    {
+        const Table* table_{nullptr};
+        std::size_t current_index_{MAXIMUM_SIZE};
+
+        constexpr void advance() noexcept
+        {
+            current_index_ = replace_past_the_last_index_with_max_size_for_end_iterator(
+                table_, current_index_ + 1);
+        }
+        constexpr void recede() noexcept
+        {
+            current_index_ = current_index_ == MAXIMUM_SIZE ? table_->size() - 1
+                                                            : current_index_ - 1;
+        }
+
+        constexpr const_reference get() const noexcept
+        {
+            return table_->entry_at(current_index_).key();
+        }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept
+        {
+            return current_index_ == other.current_index_;
+        }
+    };
+
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           IteratorDirection::FORWARD>;
+
+    // Entries are contiguous, so the index past the last entry changes on every insertion and
+    // removal. For the purposes of iterators, use MAXIMUM_SIZE for end()
+    static constexpr std::size_t replace_past_the_last_index_with_max_size_for_end_iterator(
+        const Table* table, const std::size_t& i) noexcept
+    {
+        return i >= table->size() ? MAXIMUM_SIZE : i;
+    }
+
+public:
+    using const_iterator = Iterator;
+    using iterator = const_iterator;
+    using size_type = typename Table::size_type;
+    using difference_type = typename Table::difference_type;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Table IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+
+public:
+    constexpr FixedUnorderedSet() noexcept
+      : FixedUnorderedSet{Hash{}}
+    {
+    }
+
+    explicit constexpr FixedUnorderedSet(const Hash& hash,
+                                         const KeyEqual& equal = KeyEqual{}) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_table_{hash, equal}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedUnorderedSet(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash{},
+        const KeyEqual& equal = KeyEqual{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedUnorderedSet{hash, equal}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedUnorderedSet(std::initializer_list<value_type> list,
+                                const Hash& hash = Hash{},
+                                const KeyEqual& equal = KeyEqual{},
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+      : FixedUnorderedSet{hash, equal}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(MAXIMUM_SIZE); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return table().empty(); }
+
+    constexpr void clear() noexcept { table().clear(); }
+
+    [[nodiscard]] constexpr hasher hash_function() const { return table().hash_function(); }
+    [[nodiscard]] constexpr key_equal key_eq() const { return table().key_eq(); }
+
+    constexpr std::pair<const_iterator, bool> insert(
+        const K& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, value);
+    }
+    constexpr std::pair<const_iterator, bool> insert(
+        K&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, std::move(value));
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    const K& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(key, loc).first;
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    K&& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(key), loc).first;
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr std::pair<const_iterator, bool> emplace(Args&&... args) noexcept
+    {
+        K key{std::forward<Args>(args)...};
+        return insert(std::move(key));
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert(pos != cend());
+        const std::size_t i = index_of(pos);
+        table().erase_at(i);
+        return create_const_iterator(i);
+    }
+
+    constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const std::size_t from = index_of(first);
+        const std::size_t to = index_of(last);
+        // Erase back-to-front: every removal moves the (surviving) last entry into the hole, so
+        // entries before the hole are never disturbed.
+        for (std::size_t i = to; i > from; i--)
+        {
+            table().erase_at(i - 1);
+        }
+        return create_const_iterator(from);
+    }
+
+    constexpr size_type erase(const K& key) noexcept { return table().erase_key(key); }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(table().index_of_entry_or_null(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return create_const_iterator(table().index_of_entry_or_null(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return table().contains_key(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return table().contains_key(key);
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const const_iterator it = find(key);
+        return {it, it == cend() ? it : std::next(it)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Hash2,
+              class KeyEqual2,
+              fixed_unordered_set_customize::FixedUnorderedSetChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedUnorderedSet<K, MAXIMUM_SIZE_2, Hash2, KeyEqual2, CheckingType2>& other) const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        if (this->size() != other.size())
+        {
+            return false;
+        }
+
+        for (const K& key : *this)
+        {
+            if (!other.contains(key))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    constexpr Table& table() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+    constexpr const Table& table() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+
+    template <class Key>
+    constexpr std::pair<const_iterator, bool> insert_impl(
+        const std_transition::source_location& loc, Key&& key) noexcept
+    {
+        const SlotLookup lookup = table().lookup_for_insertion(key);
+        if (lookup.found)
+        {
+            return {create_const_iterator(table().entry_index_at_slot(lookup.slot)), false};
+        }
+
+        check_not_full(loc);
+        return {create_const_iterator(table().insert_new_at(lookup, std::forward<Key>(key))),
+                true};
+    }
+
+    // Inverse of create_iterator()
+    constexpr std::size_t index_of(const const_iterator& it) const noexcept
+    {
+        const std::size_t i =
+            it.IMPLEMENTATION_DETAIL_DO_NOT_USE_reference_provider().current_index_;
+        return i == MAXIMUM_SIZE ? size() : i;
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t& start_index) const noexcept
+    {
+        return const_iterator{ReferenceProvider{
+            &table(),
+            replace_past_the_last_index_with_max_size_for_end_iterator(&table(), start_index)}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!table().full()))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          fixed_unordered_set_customize::FixedUnorderedSetChecking<K> CheckingType>
+constexpr typename FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>::size_type
+is_full(const FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          fixed_unordered_set_customize::FixedUnorderedSetChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>::size_type
+erase_if(FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>& c,
+         Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(c, predicate);
+}
+
+/**
+ * Construct a FixedUnorderedSet with its capacity being deduced from the number of items being
+ * passed.
+ */
+template <typename K,
+          typename Hash = fixed_containers::Hash<K>,
+          typename KeyEqual = fixed_containers::EqualTo<K>,
+          fixed_unordered_set_customize::FixedUnorderedSetChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedUnorderedSetType =
+              FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>>
+[[nodiscard]] constexpr FixedUnorderedSetType make_fixed_unordered_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    FixedUnorderedSetType set{hash, equal};
+    for (const auto& item : list)
+    {
+        set.insert(item, loc);
+    }
+    return set;
+}
+
+template <typename K,
+          typename Hash = fixed_containers::Hash<K>,
+          typename KeyEqual = fixed_containers::EqualTo<K>,
+          std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_unordered_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = fixed_unordered_set_customize::AbortChecking<K, MAXIMUM_SIZE>;
+    using FixedUnorderedSetType = FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>;
+    return make_fixed_unordered_set<K,
+                                    Hash,
+                                    KeyEqual,
+                                    CheckingType,
+                                    MAXIMUM_SIZE,
+                                    FixedUnorderedSetType>(list, hash, equal, loc);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "fixed_containers/smallest_unsigned_integer.hpp"
+#include "fixed_containers/word_bitset.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace fixed_containers::flat_sorted_keys_detail
+{
+// Same results as std::lower_bound/std::upper_bound over [first, first + count). Every step
+// halves the range whatever the comparison says, so the only data-dependent choice is the new
+// start, which compiles to a conditional move instead of a hard-to-predict branch.
+template <class RandomAccessIt, class K0, class Compare>
+constexpr std::size_t lower_bound_index(const RandomAccessIt first,
+                                        std::size_t count,
+                                        const K0& key,
+                                        const Compare& comparator)
+{
+    std::size_t start = 0;
+    while (count > 0)
+    {
+        const std::size_t half = count / 2;
+        const bool go_right = comparator(first[static_cast<std::ptrdiff_t>(start + half)], key);
+        start += static_cast<std::size_t>(go_right) * (count - half);
+        count = half;
+    }
+    return start;
+}
+template <class RandomAccessIt, class K0, class Compare>
+constexpr std::size_t upper_bound_index(const RandomAccessIt first,
+                                        std::size_t count,
+                                        const K0& key,
+                                        const Compare& comparator)
+{
+    std::size_t start = 0;
+    while (count > 0)
+    {
+        const std::size_t half = count / 2;
+        const bool go_right = !comparator(key, first[static_cast<std::ptrdiff_t>(start + half)]);
+        start += static_cast<std::size_t>(go_right) * (count - half);
+        count = half;
+    }
+    return start;
+}
+
+// Positions of entries in the key/value arrays of a flat container
+template <std::size_t MAXIMUM_SIZE>
+using Order =
+    std::array<smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>,
+               MAXIMUM_SIZE>;
+
+/**
+ * Given `keys` whose first `sorted_count` entries are sorted and unique and whose remaining
+ * entries were just appended in arbitrary order, computes where every entry belongs after merging
+ * the two. On return, `order[i]` is the current position of the entry that belongs at position
+ * `i`: first all entries that are kept, in sorted order, and then (in no particular order) the
+ * appended entries that must be dropped, because their key is already present or appears earlier
+ * in the appended entries. Returns the number of kept entries.
+ *
+ * Sorting happens once, on the appended entries only; the merge with the sorted prefix is linear.
+ * `order` doubles as the scratch space for both.
+ */
+template <std::size_t MAXIMUM_SIZE, class KeyVector, class Compare>
+constexpr std::size_t compute_merge_order(const KeyVector& keys,
+                                          const std::size_t sorted_count,
+                                          const Compare& comparator,
+                                          Order<MAXIMUM_SIZE>& order)
+{
+    using IndexType = typename Order<MAXIMUM_SIZE>::value_type;
+    const std::size_t appended_count = keys.size() - sorted_count;
+
+    // The appended entries are sorted at the back of `order`, so that the merge below (which
+    // writes from the front) never overwrites one that it has not read yet.
+    const std::size_t appended_start = MAXIMUM_SIZE - appended_count;
+    for (std::size_t i = 0; i < appended_count; i++)
+    {
+        order[appended_start + i] = static_cast<IndexType>(sorted_count + i);
+    }
+    // Ties are broken by position, so that the first of several equal keys wins, like it would
+    // with one insert() per entry
+    std::sort(order.begin() + static_cast<std::ptrdiff_t>(appended_start),
+              order.end(),
+              [&keys, &comparator](const IndexType left, const IndexType right)
+              {
+                  if (comparator(keys[left], keys[right]))
+                  {
+                      return true;
+                  }
+                  if (comparator(keys[right], keys[left]))
+                  {
+                      return false;
+                  }
+                  return left < right;
+              });
+
+    const auto sorted_end = keys.begin() + static_cast<std::ptrdiff_t>(sorted_count);
+    word_bitset_detail::WordBitset<MAXIMUM_SIZE> dropped{};
+    std::size_t appended_end = appended_start;
+    for (std::size_t read = appended_start; read < MAXIMUM_SIZE; read++)
+    {
+        const std::size_t i = order[read];
+        const bool is_repeated = appended_end != appended_start &&
+                                 !comparator(keys[order[appended_end - 1]], keys[i]);
+        bool is_present = false;
+        if (!is_repeated)
+        {
+            const auto it = std::lower_bound(keys.begin(), sorted_end, keys[i], comparator);
+            is_present = it != sorted_end && !comparator(keys[i], *it);
+        }
+
+        if (is_repeated || is_present)
+        {
+            dropped.set(i);
+        }
+        else
+        {
+            order[appended_end] = static_cast<IndexType>(i);
+            appended_end++;
+        }
+    }
+
+    std::size_t write = 0;
+    std::size_t sorted_read = 0;
+    std::size_t appended_read = appended_start;
+    while (sorted_read < sorted_count && appended_read < appended_end)
+    {
+        if (comparator(keys[order[appended_read]], keys[sorted_read]))
+        {
+            order[write] = order[appended_read];
+            appended_read++;
+        }
+        else
+        {
+            order[write] = static_cast<IndexType>(sorted_read);
+            sorted_read++;
+        }
+        write++;
+    }
+    for (; sorted_read < sorted_count; sorted_read++, write++)
+    {
+        order[write] = static_cast<IndexType>(sorted_read);
+    }
+    for (; appended_read < appended_end; appended_read++, write++)
+    {
+        order[write] = order[appended_read];
+    }
+
+    // Kept and dropped entries together never outnumber the slots of `order`. The bound on
+    // `write` makes that visible to the optimizer, which otherwise reports an overflow.
+    const std::size_t kept_count = write;
+    for (std::size_t i = dropped.find_first_at_or_after(sorted_count);
+         i < MAXIMUM_SIZE && write < MAXIMUM_SIZE;
+         i = dropped.find_first_at_or_after(i + 1))
+    {
+        order[write] = static_cast<IndexType>(i);
+        write++;
+    }
+    return kept_count;
+}
+
+/**
+ * Moves the entry at `order[i]` to position `i`, for every `i` in [0, count). Each entry is moved
+ * once, by following the cycles of the permutation.
+ */
+template <std::size_t MAXIMUM_SIZE, class Vector>
+constexpr void apply_order(Order<MAXIMUM_SIZE> order, const std::size_t count, Vector& vector)
+{
+    using IndexType = typename Order<MAXIMUM_SIZE>::value_type;
+    for (std::size_t start = 0; start < count; start++)
+    {
+        if (order[start] == start)
+        {
+            continue;
+        }
+
+        typename Vector::value_type held = std::move(vector[start]);
+        std::size_t i = start;
+        while (order[i] != start)
+        {
+            const std::size_t source = order[i];
+            vector[i] = std::move(vector[source]);
+            order[i] = static_cast<IndexType>(i);
+            i = source;
+        }
+        vector[i] = std::move(held);
+        order[i] = static_cast<IndexType>(i);
+    }
+}
+
+}  // namespace fixed_containers::flat_sorted_keys_detail
@@ -0,0 +1,416 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/eytzinger_layout.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/pair_view.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/smallest_unsigned_integer.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace fixed_containers::frozen_map_customize
+{
+template <class T, class K>
+concept FrozenMapChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::out_of_range(key, size, loc);  // ~ std::out_of_range
+        T::length_error(size, loc);       // ~ std::length_error
+    };
+
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+    static constexpr auto VALUE_TYPE_NAME = fixed_containers::type_name<V>();
+
+    [[noreturn]] static constexpr void out_of_range(const K& /*key*/,
+                                                    const std::size_t /*size*/,
+                                                    const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::frozen_map_customize
+
+namespace fixed_containers::frozen_map_detail
+{
+/**
+ * Returns iterators to the entries of [first, first + count), which must be sorted and unique,
+ * in Eytzinger order.
+ */
+template <std::size_t MAXIMUM_SIZE, std::forward_iterator It>
+[[nodiscard]] constexpr FixedVector<It, MAXIMUM_SIZE> in_eytzinger_order(It first,
+                                                                         const std::size_t count)
+{
+    using IndexType = smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>;
+
+    // The input can only be walked forward, so first find out which rank goes where, and keep an
+    // iterator to every rank.
+    std::array<IndexType, MAXIMUM_SIZE> rank_at_index{};
+    std::size_t rank = 0;
+    for (std::size_t k = eytzinger_layout_detail::first_position(count); k != 0;
+         k = eytzinger_layout_detail::next_position(k, count))
+    {
+        rank_at_index[k - 1] = static_cast<IndexType>(rank);
+        rank++;
+    }
+
+    FixedVector<It, MAXIMUM_SIZE> entry_at_rank{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        entry_at_rank.push_back(first);
+        std::advance(first, 1);
+    }
+
+    FixedVector<It, MAXIMUM_SIZE> out{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        out.push_back(entry_at_rank[rank_at_index[i]]);
+    }
+    return out;
+}
+}  // namespace fixed_containers::frozen_map_detail
+
+namespace fixed_containers
+{
+/**
+ * Immutable map, meant to be built at compile time with `freeze()`. The keys are stored in the
+ * Eytzinger layout (see eytzinger_layout.hpp) and the values in a parallel array, so a lookup is
+ * a branch-free descent over keys only, which touches fewer cache lines than the descent of a
+ * FixedMap and does not stall on mispredicted branches. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *  - structural type, so it can be used as a template parameter
+ *
+ * The API is the read-only part of the std::map API. Iteration is in key order. Iterators
+ * dereference to a `PairView`: use `it->first()`/`it->second()` or structured bindings.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          frozen_map_customize::FrozenMapChecking<K> CheckingType =
+              frozen_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>>
+class FrozenMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = PairView<const K, const V>;
+    using const_reference = reference;
+    using key_compare = Compare;
+
+private:
+    using KeyStorage = FixedVector<K, MAXIMUM_SIZE>;
+    using ValueStorage = FixedVector<V, MAXIMUM_SIZE>;
+
+    struct PairProvider
+    {
+        const FrozenMap* map_{nullptr};
+        // Eytzinger position, 0 is end()
+        std::size_t position_{0};
+
+        constexpr void advance() noexcept
+        {
+            position_ = eytzinger_layout_detail::next_position(position_, map_->size());
+        }
+        constexpr void recede() noexcept
+        {
+            position_ = eytzinger_layout_detail::previous_position(position_, map_->size());
+        }
+
+        constexpr const_reference get() const noexcept
+        {
+            return {&map_->keys()[position_ - 1], &map_->values()[position_ - 1]};
+        }
+
+        constexpr bool operator==(const PairProvider& other) const noexcept
+        {
+            return map_ == other.map_ && position_ == other.position_;
+        }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<PairProvider,
+                                           PairProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using pointer = typename const_iterator::pointer;
+    using const_pointer = pointer;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`. Entries must
+     * be pairs (or pair-likes such as the entries of FixedMap) of a key and a value.
+     */
+    template <std::forward_iterator It>
+    [[nodiscard]] static constexpr FrozenMap from_sorted_unique(
+        It first,
+        It last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (preconditions::test(count <= MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(count, loc);
+        }
+
+        FrozenMap out{comparator};
+        for (const It& entry : frozen_map_detail::in_eytzinger_order<MAXIMUM_SIZE>(first, count))
+        {
+            const auto& [key, value] = *entry;
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_.push_back(key);
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_values_.push_back(value);
+        }
+        return out;
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    KeyStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    ValueStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FrozenMap() noexcept
+      : FrozenMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FrozenMap(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t k = position_of_key(key);
+        if (preconditions::test(k != 0))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return values()[k - 1];
+    }
+
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(eytzinger_layout_detail::first_position(size()));
+    }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{PairProvider{this, 0}};
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{
+            PairProvider{this, eytzinger_layout_detail::first_position(size())}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(position_of_key(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(position_of_key(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return position_of_key(key) != 0;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return position_of_key(key) != 0;
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(lower_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(lower_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(upper_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(upper_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const std::size_t k = position_of_key(key);
+        if (k == 0)
+        {
+            const const_iterator it = lower_bound(key);
+            return {it, it};
+        }
+        return {create_const_iterator(k), std::next(create_const_iterator(k))};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2, class CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FrozenMap<K, V, MAXIMUM_SIZE_2, Compare, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        // Same size means same layout
+        return std::ranges::equal(keys(), other.keys()) &&
+               std::ranges::equal(values(), other.values());
+    }
+
+    /**
+     * The keys and values in Eytzinger order. Entry `i` of `keys()` and of `values()` form one
+     * key-value pair.
+     */
+    [[nodiscard]] constexpr const KeyStorage& keys() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    [[nodiscard]] constexpr const ValueStorage& values() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+
+private:
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t lower_bound_position(const K0& key) const
+    {
+        return eytzinger_layout_detail::lower_bound_position(
+            keys().data(), size(), key, key_comp());
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t upper_bound_position(const K0& key) const
+    {
+        return eytzinger_layout_detail::upper_bound_position(
+            keys().data(), size(), key, key_comp());
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t position_of_key(const K0& key) const
+    {
+        const std::size_t k = lower_bound_position(key);
+        if (k == 0 || key_comp()(key, keys()[k - 1]))
+        {
+            return 0;
+        }
+        return k;
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t position) const noexcept
+    {
+        return const_iterator{PairProvider{this, position}};
+    }
+};
+
+/**
+ * Turns a FixedMap into a FrozenMap of the same capacity, at compile time:
+ * ```
+ * static constexpr auto FROZEN = freeze([]() {
+ *     FixedMap<int, int, 10> map{};
+ *     // ... fill it
+ *     return map;
+ * }());
+ * ```
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class, std::size_t>
+          typename StorageTemplate,
+          fixed_map_customize::FixedMapChecking<K> CheckingType>
+[[nodiscard]] consteval FrozenMap<K, V, MAXIMUM_SIZE, Compare> freeze(
+    const FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& map)
+{
+    return FrozenMap<K, V, MAXIMUM_SIZE, Compare>::from_sorted_unique(
+        map.cbegin(), map.cend(), map.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_.key_comp());
+}
+
+}  // namespace fixed_containers
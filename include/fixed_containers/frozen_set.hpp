@@ -0,0 +1,323 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/eytzinger_layout.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/frozen_map.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::frozen_set_customize
+{
+template <class T, class K>
+concept FrozenSetChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::length_error(size, loc);  // ~ std::length_error
+    };
+
+template <class K, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::frozen_set_customize
+
+namespace fixed_containers
+{
+/**
+ * Immutable set, meant to be built at compile time with `freeze()`. The keys are stored in the
+ * Eytzinger layout, see FrozenMap. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *  - structural type, so it can be used as a template parameter
+ *
+ * The API is the read-only part of the std::set API. Iteration is in key order.
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          frozen_set_customize::FrozenSetChecking<K> CheckingType =
+              frozen_set_customize::AbortChecking<K, MAXIMUM_SIZE>>
+class FrozenSet
+{
+public:
+    using key_type = K;
+    using value_type = K;
+    using const_reference = const value_type&;
+    using reference = const_reference;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using pointer = const_pointer;
+    using key_compare = Compare;
+
+private:
+    using KeyStorage = FixedVector<K, MAXIMUM_SIZE>;
+
+    struct ReferenceProvider
+    {
+        const FrozenSet* set_{nullptr};
+        // Eytzinger position, 0 is end()
+        std::size_t position_{0};
+
+        constexpr void advance() noexcept
+        {
+            position_ = eytzinger_layout_detail::next_position(position_, set_->size());
+        }
+        constexpr void recede() noexcept
+        {
+            position_ = eytzinger_layout_detail::previous_position(position_, set_->size());
+        }
+
+        constexpr const_reference get() const noexcept { return set_->keys()[position_ - 1]; }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept
+        {
+            return set_ == other.set_ && position_ == other.position_;
+        }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+    /**
+     * Construct from entries that are sorted and unique according to `comparator`.
+     */
+    template <std::forward_iterator It>
+    [[nodiscard]] static constexpr FrozenSet from_sorted_unique(
+        It first,
+        It last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (preconditions::test(count <= MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(count, loc);
+        }
+
+        FrozenSet out{comparator};
+        for (const It& entry : frozen_map_detail::in_eytzinger_order<MAXIMUM_SIZE>(first, count))
+        {
+            out.IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_.push_back(*entry);
+        }
+        return out;
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    KeyStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FrozenSet() noexcept
+      : FrozenSet{Compare{}}
+    {
+    }
+
+    explicit constexpr FrozenSet(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(eytzinger_layout_detail::first_position(size()));
+    }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{this, 0}};
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{
+            ReferenceProvider{this, eytzinger_layout_detail::first_position(size())}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(position_of_key(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(position_of_key(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return position_of_key(key) != 0;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return position_of_key(key) != 0;
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(lower_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(lower_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(upper_bound_position(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(upper_bound_position(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const std::size_t k = position_of_key(key);
+        if (k == 0)
+        {
+            const const_iterator it = lower_bound(key);
+            return {it, it};
+        }
+        return {create_const_iterator(k), std::next(create_const_iterator(k))};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2, class CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FrozenSet<K, MAXIMUM_SIZE_2, Compare, CheckingType2>& other) const
+    {
+        // Same size means same layout
+        return std::ranges::equal(keys(), other.keys());
+    }
+
+    /**
+     * The keys in Eytzinger order.
+     */
+    [[nodiscard]] constexpr const KeyStorage& keys() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+
+private:
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t lower_bound_position(const K0& key) const
+    {
+        return eytzinger_layout_detail::lower_bound_position(
+            keys().data(), size(), key, key_comp());
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t upper_bound_position(const K0& key) const
+    {
+        return eytzinger_layout_detail::upper_bound_position(
+            keys().data(), size(), key, key_comp());
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t position_of_key(const K0& key) const
+    {
+        const std::size_t k = lower_bound_position(key);
+        if (k == 0 || key_comp()(key, keys()[k - 1]))
+        {
+            return 0;
+        }
+        return k;
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t position) const noexcept
+    {
+        return const_iterator{ReferenceProvider{this, position}};
+    }
+};
+
+/**
+ * Turns a FixedSet into a FrozenSet of the same capacity, at compile time. See the FrozenMap
+ * overload.
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class, std::size_t>
+          typename StorageTemplate,
+          fixed_set_customize::FixedSetChecking<K> CheckingType>
+[[nodiscard]] consteval FrozenSet<K, MAXIMUM_SIZE, Compare> freeze(
+    const FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& set)
+{
+    return FrozenSet<K, MAXIMUM_SIZE, Compare>::from_sorted_unique(
+        set.cbegin(), set.cend(), set.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_.key_comp());
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers::hash_detail
+{
+// https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+constexpr std::uint64_t fnv1a(const std::string_view& s) noexcept
+{
+    std::uint64_t out = 0xcbf29ce484222325ULL;
+    for (const char c : s)
+    {
+        out ^= static_cast<std::uint8_t>(c);
+        out *= 0x100000001b3ULL;
+    }
+    return out;
+}
+
+}  // namespace fixed_containers::hash_detail
+
+namespace fixed_containers
+{
+/**
+ * Default hash for the hash-based containers. Unlike `std::hash`, it is usable in constant
+ * expressions for integral, enum and string-like keys:
+ *  - integral/enum keys hash to their value (the containers apply their own bit mixing)
+ *  - keys convertible to `std::string_view` use FNV-1a
+ *  - everything else falls back to `std::hash<K>`
+ */
+template <class K>
+struct Hash
+{
+    constexpr std::size_t operator()(const K& key) const noexcept
+    {
+        if constexpr (std::is_integral_v<K> || std::is_enum_v<K>)
+        {
+            return static_cast<std::size_t>(key);
+        }
+        else if constexpr (std::is_convertible_v<const K&, std::string_view>)
+        {
+            return static_cast<std::size_t>(hash_detail::fnv1a(std::string_view{key}));
+        }
+        else
+        {
+            return std::hash<K>{}(key);
+        }
+    }
+};
+
+/**
+ * Default key equality to go with `Hash`. Keys convertible to `std::string_view` are compared by
+ * content: `==` on e.g. two `StringLiteral`s would otherwise compare their pointers.
+ */
+template <class K>
+struct EqualTo
+{
+    constexpr bool operator()(const K& lhs, const K& rhs) const noexcept
+    {
+        if constexpr (std::is_convertible_v<const K&, std::string_view>)
+        {
+            return std::string_view{lhs} == std::string_view{rhs};
+        }
+        else
+        {
+            return lhs == rhs;
+        }
+    }
+};
+
+}  // namespace fixed_containers
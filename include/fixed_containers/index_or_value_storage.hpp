@@ -2,18 +2,22 @@
 
 #include "fixed_containers/concepts.hpp"
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
 namespace fixed_containers::index_or_value_storage_detail
 {
-template <class T>
+template <class T, class IndexType = std::size_t>
 union IndexOrValueStorage
 {
-    std::size_t index;
+    IndexType index;
     T value;
+    // Holds neither an index nor a value, so that large arrays cost nothing to construct. Users
+    // write the index before reading it. A mem-initializer, even for an empty dummy member, makes
+    // gcc zero the whole union.
     // clang-format off
-    constexpr IndexOrValueStorage() noexcept : index{} { }
+    constexpr IndexOrValueStorage() noexcept { }
     explicit constexpr IndexOrValueStorage(const T& v) : value{v} { }
     explicit constexpr IndexOrValueStorage(T&& v) : value{std::move(v)} { }
     template <class... Args>
@@ -51,13 +55,14 @@ union IndexOrValueStorage
 // NOTE: we branch on TriviallyCopyable instead of TriviallyDestructible because it needs all
 // special functions to be trivial. The NonTriviallyCopyable flavor handles triviality separately
 // for each special function (except the destructor).
-template <TriviallyCopyable T>
-union IndexOrValueStorage<T>
+template <TriviallyCopyable T, class IndexType>
+union IndexOrValueStorage<T, IndexType>
 {
-    std::size_t index;
+    IndexType index;
     T value;
+    // Holds neither an index nor a value, see above
     // clang-format off
-    constexpr IndexOrValueStorage() noexcept : index{} { }
+    constexpr IndexOrValueStorage() noexcept { }
     explicit constexpr IndexOrValueStorage(const T& v) : value{v} { }
     explicit constexpr IndexOrValueStorage(T&& v) : value{std::move(v)} { }
     template <class... Args>
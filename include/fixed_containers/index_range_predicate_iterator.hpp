@@ -4,6 +4,7 @@
 #include "fixed_containers/iterator_utils.hpp"
 
 #include <cassert>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -16,6 +17,18 @@ concept IndexBasedProvider = requires(P p, std::size_t i) {
     p.get();
 };
 
+// An IndexPredicate can optionally locate matching indices itself (e.g. by scanning a bitset a
+// word at a time), in which case the iterator skips over non-matching ranges instead of testing
+// every index in between.
+//  - next_index(i, end) returns the first matching index in [i, end), or end if there is none.
+//  - previous_index(i) returns the last matching index in [0, i], or
+//    static_cast<std::size_t>(-1) if there is none.
+template <class P>
+concept IndexPredicateWithSearch = requires(const P p, std::size_t i) {
+    { p.next_index(i, i) } -> std::same_as<std::size_t>;
+    { p.previous_index(i) } -> std::same_as<std::size_t>;
+};
+
 // This class is a simple iterator that allows filtered iteration over a collection.
 // We are using this class to iterate over collections where we would otherwise
 // have made copies as the result of applying a filter.
@@ -222,6 +235,12 @@ private:
 
     constexpr void advance_left() noexcept
     {
+        if constexpr (IndexPredicateWithSearch<IndexPredicate>)
+        {
+            current_index_ = predicate_.next_index(current_index_ + 1, end_index_);
+            return;
+        }
+
         for (std::size_t i = current_index_ + 1; i < end_index_; i++)
         {
             if (predicate_(i))
@@ -235,17 +254,24 @@ private:
     }
     constexpr void recede_left() noexcept
     {
+        // Falling off the front leaves the index at static_cast<std::size_t>(-1), i.e. rend()
+        if constexpr (IndexPredicateWithSearch<IndexPredicate>)
+        {
+            current_index_ = current_index_ == 0 ? static_cast<std::size_t>(-1)
+                                                 : predicate_.previous_index(current_index_ - 1);
+            return;
+        }
+
         // Reverse unsigned iteration terminates when i underflows
-        for (std::size_t i = current_index_ - 1; i <= current_index_; i--)
+        std::size_t i = current_index_ - 1;
+        for (; i <= current_index_; i--)
         {
             if (predicate_(i))
             {
-                current_index_ = i;
-                return;
+                break;
             }
         }
-
-        current_index_ = current_index_ - 1;
+        current_index_ = i;
     }
 };
 
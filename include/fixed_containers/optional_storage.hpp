@@ -3,6 +3,12 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/reference_storage.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -142,4 +148,58 @@ using OptionalStorageTransparent =
                        T,
                        OptionalStorage<T>>;
 
+// Moves `count` entries starting at index `from` so that they start at index `to`, leaving the
+// vacated entries destroyed. The two ranges may overlap. At runtime, trivially copyable entries
+// are moved as a single block instead of one at a time. Empty types are excluded from that:
+// their only byte is never written, and copying it is flagged as a read of uninitialized memory.
+template <typename OptionalT, std::size_t MAXIMUM_SIZE>
+constexpr void relocate_range(std::array<OptionalT, MAXIMUM_SIZE>& array,
+                              const std::size_t from,
+                              const std::size_t to,
+                              const std::size_t count)
+{
+    using T = std::remove_reference_t<decltype(get(std::declval<OptionalT&>()))>;
+
+    if (count == 0 || from == to)
+    {
+        return;
+    }
+
+    const std::size_t furthest_start = (std::max)(from, to);
+    assert(furthest_start <= MAXIMUM_SIZE && count <= MAXIMUM_SIZE - furthest_start);
+
+    if constexpr (TriviallyCopyable<T> && !std::is_empty_v<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            // Never reached by the containers, but it bounds the block for the optimizer
+            if (furthest_start > MAXIMUM_SIZE || count > MAXIMUM_SIZE - furthest_start)
+            {
+                return;
+            }
+            std::memmove(&array[to], &array[from], count * sizeof(OptionalT));
+            return;
+        }
+    }
+
+    if (to < from)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            optional_storage_detail::construct_at(
+                &array[to + i], std::move(get(array[from + i])));
+            std::destroy_at(&get(array[from + i]));
+        }
+    }
+    else
+    {
+        for (std::size_t i = count; i > 0; i--)
+        {
+            optional_storage_detail::construct_at(
+                &array[to + i - 1], std::move(get(array[from + i - 1])));
+            std::destroy_at(&get(array[from + i - 1]));
+        }
+    }
+}
+
 }  // namespace fixed_containers::optional_storage_detail
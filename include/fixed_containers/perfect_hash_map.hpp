@@ -0,0 +1,547 @@
+#pragma once
+
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/hash.hpp"
+#include "fixed_containers/pair_view.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/smallest_unsigned_integer.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace fixed_containers::perfect_hash_map_customize
+{
+template <class T, class K>
+concept PerfectHashMapChecking =
+    requires(K key, std::size_t size, const std_transition::source_location& loc) {
+        T::out_of_range(key, size, loc);  // ~ std::out_of_range
+        T::length_error(size, loc);       // ~ std::length_error
+        T::invalid_argument(key, loc);    // ~ std::invalid_argument
+    };
+
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+struct AbortChecking
+{
+    static constexpr auto KEY_TYPE_NAME = fixed_containers::type_name<K>();
+    static constexpr auto VALUE_TYPE_NAME = fixed_containers::type_name<V>();
+
+    [[noreturn]] static constexpr void out_of_range(const K& /*key*/,
+                                                    const std::size_t /*size*/,
+                                                    const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+
+    // Not constexpr, so a duplicate key in a constant-initialized map is a compile-time error
+    [[noreturn]] static void invalid_argument(const K& /*key*/,
+                                              const std_transition::source_location& /*loc*/)
+    {
+        std::abort();
+    }
+};
+
+}  // namespace fixed_containers::perfect_hash_map_customize
+
+namespace fixed_containers::perfect_hash_map_detail
+{
+// Keys are split into buckets of about this many keys
+inline constexpr std::size_t AVERAGE_BUCKET_SIZE = 4;
+
+// At most 4/5 of the slots are used, which keeps the pilot search short for the last buckets
+constexpr std::size_t slot_count_for(const std::size_t maximum_size) noexcept
+{
+    return std::bit_ceil(maximum_size + maximum_size / 4);
+}
+constexpr std::size_t bucket_count_for(const std::size_t maximum_size) noexcept
+{
+    return std::bit_ceil(maximum_size / AVERAGE_BUCKET_SIZE + 1);
+}
+
+using Pilot = std::uint16_t;
+
+}  // namespace fixed_containers::perfect_hash_map_detail
+
+namespace fixed_containers
+{
+/**
+ * Immutable hash map for key sets that are known up front, typically at compile time. It is built
+ * with the "hash and displace" scheme (CHD, http://cmph.sourceforge.net/papers/esa09.pdf): keys
+ * are split into small buckets, and every bucket gets a pilot value, chosen at construction,
+ * that sends its keys to slots no other key uses. A lookup is therefore a single probe: hash,
+ * read the pilot of the bucket, compute the slot and compare the one key that can be there.
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *  - structural type (if K and V are), so it can be used as a template parameter
+ *
+ * Duplicate keys are rejected through `CheckingType::invalid_argument()`, which is a compile-time
+ * error when constructing in a constant expression with the default `CheckingType`. So are keys
+ * whose hashes are identical, since no pilot can separate them.
+ *
+ * Iteration is in construction order. Iterators dereference to a `PairView`: use
+ * `it->first()`/`it->second()` or structured bindings.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = fixed_containers::Hash<K>,
+          class KeyEqual = fixed_containers::EqualTo<K>,
+          perfect_hash_map_customize::PerfectHashMapChecking<K> CheckingType =
+              perfect_hash_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>>
+class PerfectHashMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = PairView<const K, const V>;
+    using const_reference = reference;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    static constexpr std::size_t SLOT_COUNT =
+        perfect_hash_map_detail::slot_count_for(MAXIMUM_SIZE);
+    static constexpr std::size_t BUCKET_COUNT =
+        perfect_hash_map_detail::bucket_count_for(MAXIMUM_SIZE);
+
+private:
+    using KeyStorage = FixedVector<K, MAXIMUM_SIZE>;
+    using ValueStorage = FixedVector<V, MAXIMUM_SIZE>;
+    using Pilot = perfect_hash_map_detail::Pilot;
+    // Empty slots hold MAXIMUM_SIZE
+    using EntryIndex = smallest_unsigned_integer_detail::SmallestUnsignedIntegerFor<MAXIMUM_SIZE>;
+    static constexpr std::size_t EMPTY_SLOT = MAXIMUM_SIZE;
+    static constexpr int SLOT_BITS = std::countr_zero(SLOT_COUNT);
+
+    struct PairProvider
+    {
+        const PerfectHashMap* map_{nullptr};
+        std::size_t index_{0};
+
+        constexpr void advance() noexcept { index_++; }
+        constexpr void recede() noexcept { index_--; }
+
+        constexpr const_reference get() const noexcept
+        {
+            return {&map_->keys()[index_], &map_->values()[index_]};
+        }
+
+        constexpr bool operator==(const PairProvider& other) const noexcept
+        {
+            return map_ == other.map_ && index_ == other.index_;
+        }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<PairProvider,
+                                           PairProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using pointer = typename const_iterator::pointer;
+    using const_pointer = pointer;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    static constexpr std::size_t max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    KeyStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    ValueStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    std::array<Pilot, BUCKET_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_;
+    std::array<EntryIndex, SLOT_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+
+public:
+    constexpr PerfectHashMap() noexcept
+      : PerfectHashMap{Hash{}, KeyEqual{}}
+    {
+    }
+
+    constexpr PerfectHashMap(const Hash& hash, const KeyEqual& key_equal) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{key_equal}
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_.fill(static_cast<EntryIndex>(EMPTY_SLOT));
+    }
+
+    /**
+     * Construct from key-value pairs (or pair-likes such as the entries of FixedMap). The keys
+     * must be unique.
+     */
+    template <InputIterator InputIt>
+    constexpr PerfectHashMap(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash{},
+        const KeyEqual& key_equal = KeyEqual{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : PerfectHashMap{hash, key_equal}
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            if (preconditions::test(size() < MAXIMUM_SIZE))
+            {
+                CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+            }
+            const auto& [key, value] = *first;
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_.push_back(key);
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_values_.push_back(value);
+        }
+        build(loc);
+    }
+
+    constexpr PerfectHashMap(std::initializer_list<std::pair<K, V>> list,
+                             const Hash& hash = Hash{},
+                             const KeyEqual& key_equal = KeyEqual{},
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current())
+      : PerfectHashMap{list.begin(), list.end(), hash, key_equal, loc}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t i = index_of(key);
+        if (preconditions::test(i != MAXIMUM_SIZE))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return values()[i];
+    }
+
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(size()); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{PairProvider{this, size()}};
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{PairProvider{this, 0}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    [[nodiscard]] constexpr const Hash& hash_function() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+    [[nodiscard]] constexpr const KeyEqual& key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator_or_end(index_of(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return create_const_iterator_or_end(index_of(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return index_of(key) != MAXIMUM_SIZE;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return index_of(key) != MAXIMUM_SIZE;
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Hash> && IsTransparent<KeyEqual>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2, class CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const PerfectHashMap<K, V, MAXIMUM_SIZE_2, Hash, KeyEqual, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            const auto it = other.find(keys()[i]);
+            if (it == other.end() || !(values()[i] == it->second()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * The keys and values in construction order. Entry `i` of `keys()` and of `values()` form one
+     * key-value pair.
+     */
+    [[nodiscard]] constexpr const KeyStorage& keys() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    [[nodiscard]] constexpr const ValueStorage& values() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+
+private:
+    template <class K0>
+    [[nodiscard]] constexpr std::uint64_t hash_of(const K0& key) const
+    {
+        // Same mixing as FixedUnorderedMap, so that weak hashes (e.g. identity for integers)
+        // still spread across buckets and slots
+        const std::uint64_t m =
+            static_cast<std::uint64_t>(hash_function()(key)) * 0x9E3779B97F4A7C15ULL;
+        return m ^ (m >> 32);
+    }
+    static constexpr std::size_t bucket_of(const std::uint64_t h)
+    {
+        return static_cast<std::size_t>(h) & (BUCKET_COUNT - 1);
+    }
+    static constexpr std::size_t slot_of(const std::uint64_t h, const Pilot pilot)
+    {
+        // Keys of a bucket share the low bits of their hash, so take the high bits of the product
+        if constexpr (SLOT_BITS == 0)
+        {
+            return 0;
+        }
+        else
+        {
+            const std::uint64_t x = (h ^ (pilot * 0xBF58476D1CE4E5B9ULL)) * 0x94D049BB133111EBULL;
+            return static_cast<std::size_t>(x >> (64 - SLOT_BITS));
+        }
+    }
+
+    // Returns MAXIMUM_SIZE if the key is not present
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t index_of(const K0& key) const
+    {
+        const std::uint64_t h = hash_of(key);
+        const std::size_t i = slots()[slot_of(h, pilots()[bucket_of(h)])];
+        if (i == EMPTY_SLOT || !key_eq()(keys()[i], key))
+        {
+            return MAXIMUM_SIZE;
+        }
+        return i;
+    }
+
+    // Assigns a pilot to every bucket, the largest buckets first since they are the hardest to
+    // place
+    constexpr void build(const std_transition::source_location& loc)
+    {
+        const std::size_t entry_count = size();
+        std::array<std::uint64_t, MAXIMUM_SIZE> hashes{};
+        for (std::size_t i = 0; i < entry_count; i++)
+        {
+            hashes[i] = hash_of(keys()[i]);
+        }
+
+        // Counting sort of the entries by bucket
+        std::array<std::size_t, BUCKET_COUNT + 1> bucket_start{};
+        for (std::size_t i = 0; i < entry_count; i++)
+        {
+            bucket_start[bucket_of(hashes[i]) + 1]++;
+        }
+        std::size_t largest_bucket_size = 0;
+        for (std::size_t b = 0; b < BUCKET_COUNT; b++)
+        {
+            largest_bucket_size = (std::max)(largest_bucket_size, bucket_start[b + 1]);
+            bucket_start[b + 1] += bucket_start[b];
+        }
+        std::array<EntryIndex, MAXIMUM_SIZE> entries_by_bucket{};
+        std::array<std::size_t, BUCKET_COUNT> bucket_fill{};
+        for (std::size_t i = 0; i < entry_count; i++)
+        {
+            const std::size_t b = bucket_of(hashes[i]);
+            entries_by_bucket[bucket_start[b] + bucket_fill[b]] = static_cast<EntryIndex>(i);
+            bucket_fill[b]++;
+        }
+
+        for (std::size_t bucket_size = largest_bucket_size; bucket_size > 0; bucket_size--)
+        {
+            for (std::size_t b = 0; b < BUCKET_COUNT; b++)
+            {
+                if (bucket_start[b + 1] - bucket_start[b] != bucket_size)
+                {
+                    continue;
+                }
+                const EntryIndex* const members = &entries_by_bucket[bucket_start[b]];
+                if (!place_bucket(b, members, bucket_size, hashes, loc))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    constexpr bool place_bucket(const std::size_t bucket,
+                                const EntryIndex* const members,
+                                const std::size_t member_count,
+                                const std::array<std::uint64_t, MAXIMUM_SIZE>& hashes,
+                                const std_transition::source_location& loc)
+    {
+        // No pilot can separate keys with the same hash
+        for (std::size_t j = 0; j < member_count; j++)
+        {
+            for (std::size_t k = 0; k < j; k++)
+            {
+                if (preconditions::test(hashes[members[j]] != hashes[members[k]]))
+                {
+                    CheckingType::invalid_argument(keys()[members[j]], loc);
+                    return false;
+                }
+            }
+        }
+
+        for (std::size_t p = 0; p <= (std::numeric_limits<Pilot>::max)(); p++)
+        {
+            const auto pilot = static_cast<Pilot>(p);
+            std::size_t placed = 0;
+            while (placed < member_count)
+            {
+                const std::size_t slot = slot_of(hashes[members[placed]], pilot);
+                if (slots()[slot] != EMPTY_SLOT)
+                {
+                    break;
+                }
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[slot] = members[placed];
+                placed++;
+            }
+            if (placed == member_count)
+            {
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_[bucket] = pilot;
+                return true;
+            }
+            // Undo the partial placement
+            for (std::size_t j = 0; j < placed; j++)
+            {
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[slot_of(hashes[members[j]], pilot)] =
+                    static_cast<EntryIndex>(EMPTY_SLOT);
+            }
+        }
+        // Not expected to happen with distinct hashes and the load factor above
+        CheckingType::invalid_argument(keys()[members[0]], loc);
+        return false;
+    }
+
+    [[nodiscard]] constexpr const std::array<Pilot, BUCKET_COUNT>& pilots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_;
+    }
+    [[nodiscard]] constexpr const std::array<EntryIndex, SLOT_COUNT>& slots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t index) const noexcept
+    {
+        return const_iterator{PairProvider{this, index}};
+    }
+    constexpr const_iterator create_const_iterator_or_end(const std::size_t index) const noexcept
+    {
+        return index == MAXIMUM_SIZE ? cend() : create_const_iterator(index);
+    }
+};
+
+/**
+ * Construct a PerfectHashMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <typename K,
+          typename V,
+          typename Hash = fixed_containers::Hash<K>,
+          typename KeyEqual = fixed_containers::EqualTo<K>,
+          perfect_hash_map_customize::PerfectHashMapChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename PerfectHashMapType =
+              PerfectHashMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>>
+[[nodiscard]] constexpr PerfectHashMapType make_perfect_hash_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return PerfectHashMapType{std::begin(list), std::end(list), hash, equal, loc};
+}
+
+template <typename K,
+          typename V,
+          typename Hash = fixed_containers::Hash<K>,
+          typename KeyEqual = fixed_containers::EqualTo<K>,
+          std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_perfect_hash_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = perfect_hash_map_customize::AbortChecking<K, V, MAXIMUM_SIZE>;
+    using PerfectHashMapType = PerfectHashMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, CheckingType>;
+    return make_perfect_hash_map<K,
+                                 V,
+                                 Hash,
+                                 KeyEqual,
+                                 CheckingType,
+                                 MAXIMUM_SIZE,
+                                 PerfectHashMapType>(list, hash, equal, loc);
+}
+
+}  // namespace fixed_containers
@@ -57,10 +57,9 @@ public:
         std::contiguous_iterator<IteratorType>,
         std::contiguous_iterator_tag, std::random_access_iterator_tag
     >;
-    using element_type = std::conditional_t<
-        std::contiguous_iterator<IteratorType>,
-        std::remove_reference_t<reference>, void
-    >;
+    // Must agree with value_type (modulo cv) even for non-contiguous base iterators, otherwise
+    // std::indirectly_readable_traits has no value_type and the iterator is not readable.
+    using element_type = std::remove_reference_t<reference>;
 
 private:
     IteratorType iterator_;
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "fixed_containers/fixed_red_black_tree_view.hpp"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+// Type-erased views of fixed containers, for reading them from raw bytes (e.g. another process's
+// memory or a crash dump) without the original template instantiation. Like
+// FixedRedBlackTreeRawView, they only need the sizes and alignments of the element types, and
+// they mirror the data layout of the containers, so a layout change must be reflected here.
+namespace fixed_containers
+{
+
+/**
+ * View of a FixedVector, which stores its size followed by an array of elements.
+ */
+class FixedVectorRawView
+{
+    using difference_type = std::ptrdiff_t;
+
+private:
+    const std::byte* vector_ptr_;
+    const std::size_t elem_size_bytes_;
+    const std::size_t elem_align_bytes_;
+    const std::size_t max_size_;
+
+public:
+    FixedVectorRawView(const void* vector_ptr,
+                       std::size_t elem_size_bytes,
+                       std::size_t elem_align_bytes,
+                       std::size_t max_size)
+      : vector_ptr_{reinterpret_cast<const std::byte*>(vector_ptr)}
+      , elem_size_bytes_{elem_size_bytes}
+      , elem_align_bytes_{elem_align_bytes}
+      , max_size_{max_size}
+    {
+    }
+
+    /**
+     * Read the size member, which is at the start of the vector.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return *reinterpret_cast<const std::size_t*>(vector_ptr_);
+    }
+
+    [[nodiscard]] std::size_t max_size() const { return max_size_; }
+
+    /**
+     * Calculate the pointer to the element array, which follows the size member.
+     */
+    [[nodiscard]] const std::byte* data() const
+    {
+        return std::next(
+            vector_ptr_,
+            static_cast<difference_type>(align_up(sizeof(std::size_t), elem_align_bytes_)));
+    }
+
+    /**
+     * Calculate the pointer to the element at index `i`, which must be less than size().
+     */
+    [[nodiscard]] const std::byte* at(std::size_t i) const
+    {
+        assert(i < size());
+        return std::next(data(), static_cast<difference_type>(i * elem_size_bytes_));
+    }
+};
+
+/**
+ * View of a FixedString, which stores its length followed by a null-terminated char array.
+ */
+class FixedStringRawView
+{
+    using difference_type = std::ptrdiff_t;
+
+private:
+    const std::byte* string_ptr_;
+    const std::size_t max_length_;
+
+public:
+    FixedStringRawView(const void* string_ptr, std::size_t max_length)
+      : string_ptr_{reinterpret_cast<const std::byte*>(string_ptr)}
+      , max_length_{max_length}
+    {
+    }
+
+    /**
+     * Read the length member, which is at the start of the string.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return *reinterpret_cast<const std::size_t*>(string_ptr_);
+    }
+
+    [[nodiscard]] std::size_t max_size() const { return max_length_; }
+
+    /**
+     * Calculate the pointer to the characters, which follow the length member.
+     */
+    [[nodiscard]] const char* data() const
+    {
+        return reinterpret_cast<const char*>(
+            std::next(string_ptr_, static_cast<difference_type>(sizeof(std::size_t))));
+    }
+
+    [[nodiscard]] std::string_view as_string_view() const { return {data(), size()}; }
+};
+
+/**
+ * View of the presence bits of EnumMap and EnumSet: one bit per enum ordinal, packed into 64-bit
+ * words. Mirrors word_bitset_detail::WordBitset.
+ */
+class EnumPresenceBitsRawView
+{
+    using WordType = std::uint64_t;
+    static constexpr std::size_t BITS_PER_WORD = 64;
+
+private:
+    const WordType* words_;
+    const std::size_t enum_count_;
+
+public:
+    EnumPresenceBitsRawView(const void* bitset_ptr, std::size_t enum_count)
+      : words_{reinterpret_cast<const WordType*>(bitset_ptr)}
+      , enum_count_{enum_count}
+    {
+    }
+
+    /**
+     * Read the bit of the enum constant with ordinal `i`.
+     */
+    [[nodiscard]] bool contains(std::size_t i) const
+    {
+        assert(i < enum_count_);
+        return ((words_[i / BITS_PER_WORD] >> (i % BITS_PER_WORD)) & 1U) != 0;
+    }
+
+    /**
+     * Count the set bits. Bits past the enum count are always zero.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        std::size_t count = 0;
+        for (std::size_t w = 0; w < word_count(enum_count_); w++)
+        {
+            count += static_cast<std::size_t>(std::popcount(words_[w]));
+        }
+        return count;
+    }
+
+    [[nodiscard]] std::size_t max_size() const { return enum_count_; }
+
+    [[nodiscard]] static std::size_t word_count(std::size_t enum_count)
+    {
+        return (enum_count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    }
+};
+
+/**
+ * View of an EnumSet, which only stores the presence bits.
+ */
+class EnumSetRawView : public EnumPresenceBitsRawView
+{
+public:
+    EnumSetRawView(const void* set_ptr, std::size_t enum_count)
+      : EnumPresenceBitsRawView(set_ptr, enum_count)
+    {
+    }
+};
+
+/**
+ * View of an EnumMap, which stores an array with a slot for every enum constant, indexed by
+ * ordinal, followed by the presence bits.
+ */
+class EnumMapRawView
+{
+    using difference_type = std::ptrdiff_t;
+
+private:
+    const std::byte* map_ptr_;
+    const std::size_t value_size_bytes_;
+    const std::size_t enum_count_;
+    const EnumPresenceBitsRawView presence_bits_;
+
+public:
+    EnumMapRawView(const void* map_ptr, std::size_t value_size_bytes, std::size_t enum_count)
+      : map_ptr_{reinterpret_cast<const std::byte*>(map_ptr)}
+      , value_size_bytes_{value_size_bytes}
+      , enum_count_{enum_count}
+      , presence_bits_{presence_bits_ptr(map_ptr_, value_size_bytes_, enum_count_), enum_count_}
+    {
+    }
+
+    [[nodiscard]] const EnumPresenceBitsRawView& presence_bits() const { return presence_bits_; }
+
+    [[nodiscard]] bool contains(std::size_t i) const { return presence_bits_.contains(i); }
+
+    [[nodiscard]] std::size_t size() const { return presence_bits_.size(); }
+
+    [[nodiscard]] std::size_t max_size() const { return enum_count_; }
+
+    /**
+     * Calculate the pointer to the value of the enum constant with ordinal `i`, or return
+     * nullptr if the map does not contain it.
+     */
+    [[nodiscard]] const std::byte* value_at(std::size_t i) const
+    {
+        if (!contains(i))
+        {
+            return nullptr;
+        }
+        return std::next(map_ptr_, static_cast<difference_type>(i * value_size_bytes_));
+    }
+
+private:
+    /**
+     * Calculate the pointer to the presence bits, which follow the value array.
+     */
+    [[nodiscard]] static const std::byte* presence_bits_ptr(const std::byte* map_ptr,
+                                                            std::size_t value_size_bytes,
+                                                            std::size_t enum_count)
+    {
+        const auto offset = align_up(enum_count * value_size_bytes, alignof(std::uint64_t));
+        return std::next(map_ptr, static_cast<difference_type>(offset));
+    }
+};
+
+}  // namespace fixed_containers
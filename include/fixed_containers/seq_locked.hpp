@@ -0,0 +1,191 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * A value shared between one writer thread and any number of reader threads, protected by a
+ * sequence lock. Readers never write to shared memory, so they do not contend with each other:
+ * a read copies the value and retries if the writer was active meanwhile. Fixed containers with
+ * trivially copyable elements hold no pointers, so a copy is a complete, independent snapshot.
+ *
+ * Readers run their function on the copy, never on the shared value, so they only ever observe
+ * consistent states. (Running on the shared value and validating afterwards would let a reader
+ * follow torn links of a tree, possibly out of bounds or in a cycle.) All accesses to the shared
+ * value are atomic, so there are no data races.
+ *
+ * Reads are lock-free, but not wait-free: a reader can be made to retry for as long as the writer
+ * keeps updating. Updates are meant to be infrequent compared to reads.
+ *
+ * Only one thread may call update()/store() at a time. The writer keeps a private copy of the
+ * value that it modifies and then publishes, so the memory footprint is about twice the size of
+ * the value.
+ */
+template <TriviallyCopyable T>
+class SeqLocked
+{
+    using WordType = std::uint64_t;
+    static_assert(std::atomic<WordType>::is_always_lock_free);
+    static constexpr std::size_t WORD_COUNT =
+        (sizeof(T) + sizeof(WordType) - 1) / sizeof(WordType);
+    static constexpr std::size_t CACHE_LINE_SIZE = cache_line_detail::CACHE_LINE_SIZE;
+
+public:
+    using value_type = T;
+
+private:
+    // Odd while the writer is publishing. Written by the writer only, so readers only share its
+    // cache line in read mode.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> sequence_;
+    alignas(CACHE_LINE_SIZE) std::array<std::atomic<WordType>, WORD_COUNT> words_;
+    // Only accessed by the writer
+    alignas(CACHE_LINE_SIZE) T staging_;
+
+public:
+    SeqLocked() noexcept(std::is_nothrow_default_constructible_v<T>)
+      : SeqLocked(T{})
+    {
+    }
+
+    explicit SeqLocked(const T& initial) noexcept
+      : sequence_{0}
+      , words_{}
+      , staging_{initial}
+    {
+        publish();
+    }
+
+    SeqLocked(const SeqLocked&) = delete;
+    SeqLocked(SeqLocked&&) = delete;
+    SeqLocked& operator=(const SeqLocked&) = delete;
+    SeqLocked& operator=(SeqLocked&&) = delete;
+
+    /**
+     * Reader side. Calls `fn` with a consistent snapshot of the value and returns its result.
+     */
+    template <class Fn>
+    decltype(auto) read(Fn&& fn) const
+    {
+        SnapshotBuffer buffer;
+        return std::invoke(std::forward<Fn>(fn), load_into(buffer));
+    }
+
+    /**
+     * Reader side. Returns a consistent snapshot of the value.
+     */
+    [[nodiscard]] T load() const
+    {
+        SnapshotBuffer buffer;
+        return load_into(buffer);
+    }
+
+    /**
+     * Writer side. Calls `fn` with a mutable reference to the value and then publishes the
+     * result. Readers see either the value before or after `fn`, never anything in between.
+     */
+    template <class Fn>
+    decltype(auto) update(Fn&& fn)
+    {
+        if constexpr (std::is_void_v<std::invoke_result_t<Fn, T&>>)
+        {
+            std::invoke(std::forward<Fn>(fn), staging_);
+            publish();
+        }
+        else
+        {
+            decltype(auto) result = std::invoke(std::forward<Fn>(fn), staging_);
+            publish();
+            return result;
+        }
+    }
+
+    /**
+     * Writer side. Replaces the value.
+     */
+    void store(const T& value)
+    {
+        staging_ = value;
+        publish();
+    }
+
+    /**
+     * Number of completed updates, including the initial value. Changes whenever the value does.
+     */
+    [[nodiscard]] std::uint64_t version() const noexcept
+    {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    // Whole words, so that every word is copied with a fixed-size store. An array of std::byte
+    // implicitly creates the T whose bytes are then written into it, so T need not be default
+    // constructible.
+    struct SnapshotBuffer
+    {
+        alignas((std::max)(alignof(T), alignof(WordType)))
+            std::array<std::byte, WORD_COUNT * sizeof(WordType)> bytes;
+    };
+
+    static constexpr std::size_t bytes_in_word(const std::size_t i)
+    {
+        return i + 1 < WORD_COUNT ? sizeof(WordType) : sizeof(T) - i * sizeof(WordType);
+    }
+
+    const T& load_into(SnapshotBuffer& buffer) const
+    {
+        while (true)
+        {
+            const std::uint64_t before = sequence_.load(std::memory_order_acquire);
+            if ((before & 1U) != 0)
+            {
+                continue;
+            }
+            for (std::size_t i = 0; i < WORD_COUNT; i++)
+            {
+                const WordType word = words_[i].load(std::memory_order_relaxed);
+                std::memcpy(buffer.bytes.data() + i * sizeof(WordType), &word, sizeof(WordType));
+            }
+            // Orders the loads of the words before the second load of the sequence
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before)
+            {
+                return *std::launder(reinterpret_cast<const T*>(buffer.bytes.data()));
+            }
+        }
+    }
+
+    void publish() noexcept
+    {
+        const std::uint64_t before = sequence_.load(std::memory_order_relaxed);
+        assert((before & 1U) == 0 && "Concurrent writers");
+        sequence_.store(before + 1, std::memory_order_relaxed);
+        // Orders the odd sequence before the stores of the words
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const auto* const staging_bytes = reinterpret_cast<const std::byte*>(&staging_);
+        for (std::size_t i = 0; i < WORD_COUNT; i++)
+        {
+            WordType word{};
+            std::memcpy(&word, staging_bytes + i * sizeof(WordType), bytes_in_word(i));
+            words_[i].store(word, std::memory_order_relaxed);
+        }
+
+        sequence_.store(before + 2, std::memory_order_release);
+    }
+};
+
+}  // namespace fixed_containers
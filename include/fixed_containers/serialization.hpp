@@ -0,0 +1,274 @@
+#pragma once
+
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_set.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/hash.hpp"
+#include "fixed_containers/type_name.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+
+namespace fixed_containers::serialization_detail
+{
+// Which layout parameters a container type has, beyond its size and alignment. Only the
+// containers specialized here can be serialized.
+template <class T>
+struct LayoutTraits;
+
+// Containers that are not tree-based have no compactness or storage policy
+inline constexpr std::uint8_t NO_COMPACTNESS = 0xFF;
+inline constexpr std::uint64_t NO_STORAGE_POLICY = 0;
+
+template <template <class, std::size_t> typename StorageTemplate>
+constexpr std::uint64_t storage_policy_hash()
+{
+    // Only the name is needed, the storage is not instantiated
+    return hash_detail::fnv1a(type_name<StorageTemplate<std::byte, 0>>());
+}
+
+template <class T, std::size_t MAXIMUM_SIZE, fixed_vector_customize::FixedVectorChecking C>
+struct LayoutTraits<FixedVector<T, MAXIMUM_SIZE, C>>
+{
+    static constexpr std::size_t CAPACITY = MAXIMUM_SIZE;
+    static constexpr std::uint8_t COMPACTNESS = NO_COMPACTNESS;
+    static constexpr std::uint64_t STORAGE_POLICY = NO_STORAGE_POLICY;
+};
+
+template <class T, std::size_t MAXIMUM_SIZE, fixed_deque_customize::FixedDequeChecking C>
+struct LayoutTraits<FixedDeque<T, MAXIMUM_SIZE, C>>
+{
+    static constexpr std::size_t CAPACITY = MAXIMUM_SIZE;
+    static constexpr std::uint8_t COMPACTNESS = NO_COMPACTNESS;
+    static constexpr std::uint64_t STORAGE_POLICY = NO_STORAGE_POLICY;
+};
+
+template <std::size_t MAXIMUM_LENGTH, fixed_string_customize::FixedStringChecking C>
+struct LayoutTraits<fixed_string_detail::FixedString<MAXIMUM_LENGTH, C>>
+{
+    static constexpr std::size_t CAPACITY = MAXIMUM_LENGTH;
+    static constexpr std::uint8_t COMPACTNESS = NO_COMPACTNESS;
+    static constexpr std::uint64_t STORAGE_POLICY = NO_STORAGE_POLICY;
+};
+
+template <class K, class V, enum_map_customize::EnumMapChecking<K> C>
+struct LayoutTraits<EnumMap<K, V, C>>
+{
+    static constexpr std::size_t CAPACITY = EnumMap<K, V, C>::max_size();
+    static constexpr std::uint8_t COMPACTNESS = NO_COMPACTNESS;
+    static constexpr std::uint64_t STORAGE_POLICY = NO_STORAGE_POLICY;
+};
+
+template <class K>
+struct LayoutTraits<EnumSet<K>>
+{
+    static constexpr std::size_t CAPACITY = EnumSet<K>::max_size();
+    static constexpr std::uint8_t COMPACTNESS = NO_COMPACTNESS;
+    static constexpr std::uint64_t STORAGE_POLICY = NO_STORAGE_POLICY;
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_,
+          template <class, std::size_t>
+          typename StorageTemplate,
+          fixed_map_customize::FixedMapChecking<K> C>
+struct LayoutTraits<FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS_, StorageTemplate, C>>
+{
+    static constexpr std::size_t CAPACITY = MAXIMUM_SIZE;
+    static constexpr auto COMPACTNESS = static_cast<std::uint8_t>(COMPACTNESS_);
+    static constexpr std::uint64_t STORAGE_POLICY = storage_policy_hash<StorageTemplate>();
+};
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_,
+          template <class, std::size_t>
+          typename StorageTemplate,
+          fixed_set_customize::FixedSetChecking<K> C>
+struct LayoutTraits<FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS_, StorageTemplate, C>>
+{
+    static constexpr std::size_t CAPACITY = MAXIMUM_SIZE;
+    static constexpr auto COMPACTNESS = static_cast<std::uint8_t>(COMPACTNESS_);
+    static constexpr std::uint64_t STORAGE_POLICY = storage_policy_hash<StorageTemplate>();
+};
+
+inline constexpr std::array<char, 8> MAGIC{'F', 'X', 'C', 'N', 'T', 'N', 'R', '\0'};
+inline constexpr std::uint32_t FORMAT_VERSION = 1;
+// Written in native byte order, so a reader with the other byte order sees 0x04030201
+inline constexpr std::uint32_t ENDIANNESS_MARKER = 0x01020304;
+
+}  // namespace fixed_containers::serialization_detail
+
+namespace fixed_containers
+{
+/**
+ * Containers that can be written to and viewed from a byte buffer without any conversion. Their
+ * data layout has no pointers, so the bytes of the object are the serialized form.
+ */
+template <class T>
+concept ZeroCopySerializable =
+    std::is_trivially_copyable_v<T> &&
+    requires { serialization_detail::LayoutTraits<T>::CAPACITY; };
+
+/**
+ * Written in front of the container. All fields have a fixed width, so the header itself can be
+ * inspected by any reader. Two layouts are compatible if and only if their headers are equal.
+ */
+struct SerializedHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t format_version;
+    std::uint32_t endianness_marker;
+    // FNV-1a of `type_name<T>()`. Since type names are compiler-specific, so is this.
+    std::uint64_t type_hash;
+    std::uint64_t size_bytes;
+    std::uint64_t alignment_bytes;
+    std::uint64_t capacity;
+    // FNV-1a of the storage policy name, 0 if not tree-based
+    std::uint64_t storage_policy;
+    // RedBlackTreeNodeColorCompactness, 0xFF if not tree-based
+    std::uint8_t compactness;
+    std::array<std::uint8_t, 7> reserved;
+
+    constexpr bool operator==(const SerializedHeader&) const = default;
+};
+static_assert(std::is_trivially_copyable_v<SerializedHeader>);
+static_assert(sizeof(SerializedHeader) == 64);
+
+enum class SerializationStatus : std::uint8_t
+{
+    OK,
+    BUFFER_TOO_SMALL,
+    // view_from() requires the buffer to be aligned to serialized_alignment<T>()
+    MISALIGNED_BUFFER,
+    NOT_SERIALIZED_DATA,
+    UNSUPPORTED_FORMAT_VERSION,
+    ENDIANNESS_MISMATCH,
+    LAYOUT_MISMATCH,
+};
+
+template <ZeroCopySerializable T>
+[[nodiscard]] constexpr SerializedHeader serialized_header_for() noexcept
+{
+    using Traits = serialization_detail::LayoutTraits<T>;
+    return SerializedHeader{
+        .magic = serialization_detail::MAGIC,
+        .format_version = serialization_detail::FORMAT_VERSION,
+        .endianness_marker = serialization_detail::ENDIANNESS_MARKER,
+        .type_hash = hash_detail::fnv1a(type_name<T>()),
+        .size_bytes = sizeof(T),
+        .alignment_bytes = alignof(T),
+        .capacity = Traits::CAPACITY,
+        .storage_policy = Traits::STORAGE_POLICY,
+        .compactness = Traits::COMPACTNESS,
+        .reserved = {},
+    };
+}
+
+// Offset of the container in the buffer: right after the header, aligned for T
+template <ZeroCopySerializable T>
+[[nodiscard]] constexpr std::size_t serialized_payload_offset() noexcept
+{
+    return (sizeof(SerializedHeader) + alignof(T) - 1) / alignof(T) * alignof(T);
+}
+
+template <ZeroCopySerializable T>
+[[nodiscard]] constexpr std::size_t serialized_size_bytes() noexcept
+{
+    return serialized_payload_offset<T>() + sizeof(T);
+}
+
+// Alignment that buffers must have for view_from(). serialize_to() accepts any buffer.
+template <ZeroCopySerializable T>
+[[nodiscard]] constexpr std::size_t serialized_alignment() noexcept
+{
+    return (std::max)(alignof(SerializedHeader), alignof(T));
+}
+
+/**
+ * Writes the header and the bytes of `container` to the front of `out`, which must hold at least
+ * `serialized_size_bytes<T>()` bytes.
+ */
+template <ZeroCopySerializable T>
+[[nodiscard]] SerializationStatus serialize_to(const T& container, std::span<std::byte> out)
+{
+    if (out.size() < serialized_size_bytes<T>())
+    {
+        return SerializationStatus::BUFFER_TOO_SMALL;
+    }
+    const SerializedHeader header = serialized_header_for<T>();
+    std::memcpy(out.data(), &header, sizeof(header));
+    std::memset(out.data() + sizeof(header), 0, serialized_payload_offset<T>() - sizeof(header));
+    std::memcpy(out.data() + serialized_payload_offset<T>(), &container, sizeof(T));
+    return SerializationStatus::OK;
+}
+
+/**
+ * Checks that `in` starts with a container of type T, as written by `serialize_to()` in a
+ * compatible build. Only the layout is validated, not the contents: buffers from untrusted
+ * sources need their own integrity checks.
+ */
+template <ZeroCopySerializable T>
+[[nodiscard]] SerializationStatus validate_serialized(std::span<const std::byte> in)
+{
+    if (in.size() < serialized_size_bytes<T>())
+    {
+        return SerializationStatus::BUFFER_TOO_SMALL;
+    }
+    if (reinterpret_cast<std::uintptr_t>(in.data()) % serialized_alignment<T>() != 0)
+    {
+        return SerializationStatus::MISALIGNED_BUFFER;
+    }
+
+    SerializedHeader header{};
+    std::memcpy(&header, in.data(), sizeof(header));
+    const SerializedHeader expected = serialized_header_for<T>();
+    if (header.magic != expected.magic)
+    {
+        return SerializationStatus::NOT_SERIALIZED_DATA;
+    }
+    if (header.endianness_marker != expected.endianness_marker)
+    {
+        return SerializationStatus::ENDIANNESS_MISMATCH;
+    }
+    if (header.format_version != expected.format_version)
+    {
+        return SerializationStatus::UNSUPPORTED_FORMAT_VERSION;
+    }
+    if (header != expected)
+    {
+        return SerializationStatus::LAYOUT_MISMATCH;
+    }
+    return SerializationStatus::OK;
+}
+
+/**
+ * Returns the container stored in `in`, in place, or nullptr if `validate_serialized()` fails.
+ * The buffer must outlive the returned pointer.
+ */
+template <ZeroCopySerializable T>
+[[nodiscard]] const T* view_from(std::span<const std::byte> in)
+{
+    if (validate_serialized<T>(in) != SerializationStatus::OK)
+    {
+        return nullptr;
+    }
+    return std::launder(reinterpret_cast<const T*>(in.data() + serialized_payload_offset<T>()));
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fixed_containers::smallest_unsigned_integer_detail
+{
+// Smallest unsigned integer type that can represent every value in [0, MAX_VALUE].
+// Useful for storing indexes into fixed-capacity storage, where the capacity is known at
+// compile-time and usually small.
+template <std::size_t MAX_VALUE>
+using SmallestUnsignedIntegerFor = std::conditional_t<
+    (MAX_VALUE <= (std::numeric_limits<std::uint8_t>::max)()),
+    std::uint8_t,
+    std::conditional_t<(MAX_VALUE <= (std::numeric_limits<std::uint16_t>::max)()),
+                       std::uint16_t,
+                       std::conditional_t<(MAX_VALUE <=
+                                           (std::numeric_limits<std::uint32_t>::max)()),
+                                          std::uint32_t,
+                                          std::uint64_t>>>;
+
+static_assert(std::is_same_v<std::uint8_t, SmallestUnsignedIntegerFor<0>>);
+static_assert(std::is_same_v<std::uint8_t, SmallestUnsignedIntegerFor<255>>);
+static_assert(std::is_same_v<std::uint16_t, SmallestUnsignedIntegerFor<256>>);
+static_assert(std::is_same_v<std::uint32_t, SmallestUnsignedIntegerFor<65536>>);
+static_assert(std::is_same_v<std::uint64_t, SmallestUnsignedIntegerFor<4294967296ULL>>);
+
+}  // namespace fixed_containers::smallest_unsigned_integer_detail
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers::word_bitset_detail
+{
+/**
+ * Fixed-size set of bits packed into 64-bit words. Used by the enum containers to track which
+ * ordinals are present. Properties:
+ *  - constexpr (std::bitset is not sufficiently constexpr)
+ *  - structural type, so the owning containers can be used in template parameters
+ *  - whole-set operations, counting and searching work a word at a time
+ *
+ * Bits past BIT_COUNT in the last word are always zero.
+ */
+template <std::size_t BIT_COUNT>
+class WordBitset
+{
+    using WordType = std::uint64_t;
+    static constexpr std::size_t BITS_PER_WORD = 64;
+    static constexpr std::size_t WORD_COUNT = (BIT_COUNT + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    static constexpr WordType ALL_ONES = ~WordType{0};
+    static constexpr WordType LAST_WORD_MASK = BIT_COUNT % BITS_PER_WORD == 0
+                                                   ? ALL_ONES
+                                                   : (WordType{1} << BIT_COUNT % BITS_PER_WORD) - 1;
+
+    static constexpr std::size_t word_index_of(const std::size_t i) { return i / BITS_PER_WORD; }
+    static constexpr WordType bit_mask_of(const std::size_t i)
+    {
+        return WordType{1} << (i % BITS_PER_WORD);
+    }
+
+public:
+    // Returned by find_last_at_or_before() when there is no such bit
+    static constexpr std::size_t NO_INDEX = static_cast<std::size_t>(-1);
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<WordType, WORD_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_words_;
+
+public:
+    constexpr WordBitset() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_words_{}
+    {
+    }
+
+    [[nodiscard]] constexpr bool test(const std::size_t i) const noexcept
+    {
+        return (words()[word_index_of(i)] & bit_mask_of(i)) != 0;
+    }
+    constexpr void set(const std::size_t i) noexcept
+    {
+        words()[word_index_of(i)] |= bit_mask_of(i);
+    }
+    constexpr void reset(const std::size_t i) noexcept
+    {
+        words()[word_index_of(i)] &= ~bit_mask_of(i);
+    }
+
+    constexpr void set_all() noexcept
+    {
+        words().fill(ALL_ONES);
+        clear_unused_bits();
+    }
+    constexpr void reset_all() noexcept { words().fill(0); }
+
+    [[nodiscard]] constexpr std::size_t count() const noexcept
+    {
+        std::size_t out = 0;
+        for (const WordType& word : words())
+        {
+            out += static_cast<std::size_t>(std::popcount(word));
+        }
+        return out;
+    }
+    [[nodiscard]] constexpr bool none() const noexcept
+    {
+        for (const WordType& word : words())
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Index of the first set bit in [i, BIT_COUNT), or BIT_COUNT if there is none
+    [[nodiscard]] constexpr std::size_t find_first_at_or_after(const std::size_t i) const noexcept
+    {
+        if (i >= BIT_COUNT)
+        {
+            return BIT_COUNT;
+        }
+
+        std::size_t word_index = word_index_of(i);
+        WordType word = words()[word_index] & (ALL_ONES << (i % BITS_PER_WORD));
+        while (word == 0)
+        {
+            word_index++;
+            if (word_index == WORD_COUNT)
+            {
+                return BIT_COUNT;
+            }
+            word = words()[word_index];
+        }
+        return word_index * BITS_PER_WORD + static_cast<std::size_t>(std::countr_zero(word));
+    }
+
+    // Index of the last set bit in [0, i], or NO_INDEX if there is none
+    [[nodiscard]] constexpr std::size_t find_last_at_or_before(const std::size_t i) const noexcept
+    {
+        if (BIT_COUNT == 0 || i == NO_INDEX)
+        {
+            return NO_INDEX;
+        }
+
+        const std::size_t clamped = i < BIT_COUNT ? i : BIT_COUNT - 1;
+        std::size_t word_index = word_index_of(clamped);
+        WordType word = words()[word_index] &
+                        (ALL_ONES >> (BITS_PER_WORD - 1 - clamped % BITS_PER_WORD));
+        while (word == 0)
+        {
+            if (word_index == 0)
+            {
+                return NO_INDEX;
+            }
+            word_index--;
+            word = words()[word_index];
+        }
+        return word_index * BITS_PER_WORD + BITS_PER_WORD - 1 -
+               static_cast<std::size_t>(std::countl_zero(word));
+    }
+
+    constexpr void union_with(const WordBitset& other) noexcept
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; w++)
+        {
+            words()[w] |= other.words()[w];
+        }
+    }
+    constexpr void intersect_with(const WordBitset& other) noexcept
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; w++)
+        {
+            words()[w] &= other.words()[w];
+        }
+    }
+    constexpr void subtract(const WordBitset& other) noexcept
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; w++)
+        {
+            words()[w] &= ~other.words()[w];
+        }
+    }
+    constexpr void flip_all() noexcept
+    {
+        for (WordType& word : words())
+        {
+            word = ~word;
+        }
+        clear_unused_bits();
+    }
+
+    [[nodiscard]] constexpr bool is_subset_of(const WordBitset& other) const noexcept
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; w++)
+        {
+            if ((words()[w] & ~other.words()[w]) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool operator==(const WordBitset& other) const = default;
+
+private:
+    constexpr const std::array<WordType, WORD_COUNT>& words() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_words_;
+    }
+    constexpr std::array<WordType, WORD_COUNT>& words()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_words_;
+    }
+
+    constexpr void clear_unused_bits() noexcept
+    {
+        if constexpr (WORD_COUNT > 0)
+        {
+            words()[WORD_COUNT - 1] &= LAST_WORD_MASK;
+        }
+    }
+};
+
+}  // namespace fixed_containers::word_bitset_detail
@@ -663,6 +663,37 @@ TEST(EnumSet, SetIntersection)
     static_assert(!s1.contains(TestEnum1::FOUR));
 }
 
+TEST(EnumSet, WholeSetOperations)
+{
+    constexpr EnumSet<TestEnum1> a{TestEnum1::ONE, TestEnum1::TWO, TestEnum1::FOUR};
+    constexpr EnumSet<TestEnum1> b{TestEnum1::TWO, TestEnum1::THREE};
+
+    static_assert(a.union_with(b) == EnumSet<TestEnum1>::all());
+    static_assert(a.intersection_with(b) == EnumSet<TestEnum1>{TestEnum1::TWO});
+    static_assert(a.difference_with(b) == EnumSet<TestEnum1>{TestEnum1::ONE, TestEnum1::FOUR});
+    static_assert(a.complement() == EnumSet<TestEnum1>{TestEnum1::THREE});
+    static_assert(a.complement().size() == 1);
+    static_assert(EnumSet<TestEnum1>{}.complement() == EnumSet<TestEnum1>::all());
+
+    static_assert(a.intersection_with(b).is_subset_of(a));
+    static_assert(a.intersection_with(b).is_subset_of(b));
+    static_assert(!a.is_subset_of(b));
+    static_assert(EnumSet<TestEnum1>{}.is_subset_of(b));
+}
+
+TEST(EnumSet, ReverseIteratorSkipsLeadingGaps)
+{
+    constexpr EnumSet<TestEnum1> s1{TestEnum1::THREE, TestEnum1::FOUR};
+
+    static_assert(std::distance(s1.crbegin(), s1.crend()) == 2);
+    static_assert(*s1.rbegin() == TestEnum1::FOUR);
+    static_assert(*std::next(s1.rbegin()) == TestEnum1::THREE);
+    static_assert(std::next(s1.rbegin(), 2) == s1.rend());
+
+    constexpr EnumSet<TestEnum1> s2{};
+    static_assert(s2.rbegin() == s2.rend());
+}
+
 namespace
 {
 template <EnumSet<TestEnum1> /*INSTANCE*/>
@@ -0,0 +1,557 @@
+#include "fixed_containers/fixed_btree_map.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedBTreeMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_reverse_iterator>);
+
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, PairView<const int, int>>);
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, PairView<const int, const int>>);
+static_assert(std::is_same_v<ES_1::reference, ES_1::iterator::reference>);
+
+static_assert(NotTriviallyCopyable<FixedBTreeMap<int, std::string, 10>>);
+
+// Large enough that nodes hold the minimum of 4 keys, so that a few dozen entries already need
+// several levels
+struct WideKey
+{
+    int value;
+    std::array<int, 15> padding{};
+
+    constexpr auto operator<=>(const WideKey&) const = default;
+};
+static_assert(fixed_btree_detail::KEYS_PER_NODE<WideKey> == 4);
+
+template <std::size_t MAXIMUM_SIZE>
+using WideMap = FixedBTreeMap<WideKey, int, MAXIMUM_SIZE>;
+
+template <class MapType>
+bool equals_reference(const MapType& map, const std::map<int, int>& reference)
+{
+    return map.size() == reference.size() &&
+           std::equal(reference.begin(),
+                      reference.end(),
+                      map.begin(),
+                      [](const auto& left, const auto& right)
+                      {
+                          return left.first == right.first().value &&
+                                 left.second == right.second();
+                      });
+}
+}  // namespace
+
+TEST(FixedBTreeMap, DefaultConstructor)
+{
+    constexpr FixedBTreeMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+    static_assert(s1.depth() == 0);
+}
+
+TEST(FixedBTreeMap, Initializer)
+{
+    constexpr FixedBTreeMap<int, int, 10> s1{{4, 40}, {2, 20}, {4, 41}};
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+
+    constexpr FixedBTreeMap<int, int, 2> s2{{2, 20}, {4, 40}};
+    static_assert(is_full(s2));
+}
+
+TEST(FixedBTreeMap, IteratorConstructor)
+{
+    constexpr std::array INPUT{std::pair{4, 40}, std::pair{2, 20}};
+    constexpr FixedBTreeMap<int, int, 10> s1{INPUT.begin(), INPUT.end()};
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedBTreeMap, MaxSizeDeduction)
+{
+    constexpr auto s1 = make_fixed_btree_map({std::pair{30, 30}, std::pair{31, 54}});
+    static_assert(s1.size() == 2);
+    static_assert(s1.max_size() == 2);
+    static_assert(s1.contains(30));
+    static_assert(s1.contains(31));
+}
+
+TEST(FixedBTreeMap, OperatorBracket)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{};
+        s[4] = 40;
+        s[2] = 20;
+        s[4] = 41;
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 41);
+
+    FixedBTreeMap<std::string, int, 10> s2{};
+    s2["b"] = 2;
+    std::string a = "a";
+    s2[std::move(a)] = 1;
+    EXPECT_EQ(1, s2.at("a"));
+    EXPECT_EQ(2, s2.at("b"));
+}
+
+TEST(FixedBTreeMap, At_OutOfRange)
+{
+    const FixedBTreeMap<int, int, 10> s1{{2, 20}};
+    EXPECT_DEATH((void)s1.at(3), "");
+}
+
+TEST(FixedBTreeMap, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{};
+        s.insert({2, 20});
+        s.insert({4, 40});
+        s.insert({1, 10});
+        s.insert({2, 21});
+        return s;
+    }();
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(2) == 20);
+
+    FixedBTreeMap<int, int, 10> s2{};
+    auto [it, was_inserted] = s2.insert({3, 30});
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ(3, it->first());
+    EXPECT_EQ(30, it->second());
+    std::tie(it, was_inserted) = s2.insert({3, 31});
+    EXPECT_FALSE(was_inserted);
+    EXPECT_EQ(30, it->second());
+}
+
+TEST(FixedBTreeMap, Insert_ExceedsCapacity)
+{
+    FixedBTreeMap<int, int, 2> s1{{1, 10}, {2, 20}};
+    s1.insert({2, 21});  // Already present: doesn't need room
+    EXPECT_DEATH(s1.insert({3, 30}), "");
+}
+
+TEST(FixedBTreeMap, Insert_SplitsNodes)
+{
+    constexpr auto s1 = []()
+    {
+        WideMap<100> s{};
+        for (int i = 0; i < 100; i++)
+        {
+            // Interleave both ends, so that splits happen on either side of the tree
+            const int key = i % 2 == 0 ? i : 199 - i;
+            s.try_emplace(WideKey{key}, key * 10);
+        }
+        return s;
+    }();
+    static_assert(s1.size() == 100);
+    static_assert(s1.depth() >= 4);
+    static_assert(s1.at(WideKey{98}) == 980);
+    static_assert(s1.at(WideKey{198}) == 1980);
+    static_assert(std::ranges::is_sorted(s1, {}, [](const auto& entry) { return entry.first(); }));
+}
+
+TEST(FixedBTreeMap, Insert_FillsToCapacity)
+{
+    WideMap<64> s1{};
+    for (int i = 63; i >= 0; i--)
+    {
+        s1.try_emplace(WideKey{i}, i);
+    }
+    EXPECT_TRUE(is_full(s1));
+    int expected = 0;
+    for (auto&& [key, value] : s1)
+    {
+        EXPECT_EQ(expected, key.value);
+        EXPECT_EQ(expected, value);
+        expected++;
+    }
+}
+
+TEST(FixedBTreeMap, RandomizedAgainstStdMap)
+{
+    std::mt19937 random_engine{42};
+    std::uniform_int_distribution<int> key_distribution{0, 400};
+    std::bernoulli_distribution insert_distribution{0.6};
+    for (int round = 0; round < 20; round++)
+    {
+        WideMap<256> btree{};
+        std::map<int, int> reference{};
+        for (int step = 0; step < 2000; step++)
+        {
+            const int key = key_distribution(random_engine);
+            if (insert_distribution(random_engine))
+            {
+                if (reference.size() == 256 && !reference.contains(key))
+                {
+                    continue;
+                }
+                btree.insert_or_assign(WideKey{key}, step);
+                reference.insert_or_assign(key, step);
+            }
+            else
+            {
+                ASSERT_EQ(reference.erase(key), btree.erase(WideKey{key}));
+            }
+
+            if (step % 50 == 0)
+            {
+                ASSERT_TRUE(equals_reference(btree, reference));
+            }
+        }
+        ASSERT_TRUE(equals_reference(btree, reference));
+
+        // Remove everything through iterators, which merges the tree back down to nothing
+        auto it = btree.begin();
+        while (it != btree.end())
+        {
+            const int expected_next = std::next(reference.begin())->first;
+            reference.erase(reference.begin());
+            it = btree.erase(it);
+            if (!reference.empty())
+            {
+                ASSERT_EQ(expected_next, it->first().value);
+            }
+        }
+        ASSERT_TRUE(btree.empty());
+        ASSERT_EQ(0, btree.depth());
+    }
+}
+
+TEST(FixedBTreeMap, FromSortedUnique)
+{
+    constexpr auto s1 =
+        FixedBTreeMap<int, int, 10>::from_sorted_unique({{1, 10}, {2, 20}, {5, 50}});
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(5) == 50);
+
+    constexpr auto s2 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{{3, 30}};
+        s.insert_sorted({{1, 10}, {2, 20}, {5, 50}});
+        return s;
+    }();
+    static_assert(s2.size() == 4);
+    static_assert(s2.at(3) == 30);
+}
+
+TEST(FixedBTreeMap, FromSortedUnique_BuildsFullLeaves)
+{
+    std::vector<std::pair<WideKey, int>> input{};
+    for (int i = 0; i < 200; i++)
+    {
+        input.emplace_back(WideKey{i}, i);
+    }
+    auto s1 = WideMap<200>::from_sorted_unique(input.begin(), input.end());
+    WideMap<200> s2{};
+    for (const auto& [key, value] : input)
+    {
+        s2.try_emplace(key, value);
+    }
+    EXPECT_EQ(s1, s2);
+    EXPECT_LE(s1.depth(), s2.depth());
+
+    // The bulk-built tree remains fully usable
+    s1.erase(WideKey{100});
+    s1.erase(WideKey{0});
+    EXPECT_TRUE(s1.try_emplace(WideKey{100}, 100).second);
+    EXPECT_EQ(199, s1.size());
+    EXPECT_EQ(1, s1.begin()->first().value);
+}
+
+TEST(FixedBTreeMap, InsertOrAssign)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{};
+        s.insert_or_assign(2, 20);
+        s.insert_or_assign(4, 40);
+        s.insert_or_assign(2, 21);
+        s.insert_or_assign(s.end(), 6, 60);
+        s.insert_or_assign(s.begin(), 4, 41);
+        return s;
+    }();
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(2) == 21);
+    static_assert(s1.at(4) == 41);
+    static_assert(s1.at(6) == 60);
+}
+
+TEST(FixedBTreeMap, TryEmplace)
+{
+    FixedBTreeMap<int, std::string, 10> s1{};
+    auto [it, was_inserted] = s1.try_emplace(2, 3, 'a');
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ("aaa", it->second());
+    std::tie(it, was_inserted) = s1.try_emplace(2, "bb");
+    EXPECT_FALSE(was_inserted);
+    EXPECT_EQ("aaa", it->second());
+
+    s1.try_emplace(s1.end(), 5, "five");
+    s1.try_emplace(s1.find(5), 3, "three");
+    EXPECT_EQ(3, s1.size());
+    EXPECT_EQ("three", s1.at(3));
+}
+
+TEST(FixedBTreeMap, Emplace)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{};
+        s.emplace(2, 20);
+        s.emplace(std::pair{1, 10});
+        s.emplace_hint(s.end(), 3, 30);
+        s.emplace(2, 21);
+        return s;
+    }();
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(2) == 20);
+}
+
+TEST(FixedBTreeMap, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}};
+        s.erase(2);
+        s.erase(7);
+        auto it = s.erase(s.find(4));
+        s.erase(it, s.end());
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.contains(1));
+    static_assert(s1.contains(3));
+
+    FixedBTreeMap<int, int, 10> s2{{1, 10}, {2, 20}, {3, 30}};
+    auto it = s2.erase(s2.begin());
+    EXPECT_EQ(2, it->first());
+    it = s2.erase(s2.begin(), s2.end());
+    EXPECT_EQ(s2.end(), it);
+    EXPECT_TRUE(s2.empty());
+}
+
+TEST(FixedBTreeMap, EraseRange_AcrossLeaves)
+{
+    WideMap<100> s1{};
+    for (int i = 0; i < 100; i++)
+    {
+        s1.try_emplace(WideKey{i}, i);
+    }
+    auto it = s1.erase(s1.find(WideKey{10}), s1.find(WideKey{90}));
+    EXPECT_EQ(90, it->first().value);
+    EXPECT_EQ(20, s1.size());
+    EXPECT_EQ(9, std::prev(it)->first().value);
+}
+
+TEST(FixedBTreeMap, EraseIf)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeMap<int, int, 10> s{{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+        const std::size_t removed =
+            erase_if(s, [](const auto& entry) { return entry.second() % 20 == 0; });
+        return std::pair{s, removed};
+    }();
+    static_assert(s1.second == 2);
+    static_assert(s1.first.size() == 2);
+    static_assert(s1.first.contains(1));
+    static_assert(s1.first.contains(3));
+}
+
+TEST(FixedBTreeMap, Iterator)
+{
+    FixedBTreeMap<int, int, 10> s1{{3, 30}, {1, 10}, {2, 20}};
+    int expected_key = 1;
+    for (auto&& [key, value] : s1)
+    {
+        EXPECT_EQ(expected_key, key);
+        EXPECT_EQ(expected_key * 10, value);
+        value++;
+        expected_key++;
+    }
+    EXPECT_EQ(21, s1.at(2));
+
+    std::vector<int> reversed_keys{};
+    for (auto it = s1.crbegin(); it != s1.crend(); ++it)
+    {
+        reversed_keys.push_back(it->first());
+    }
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), reversed_keys);
+    EXPECT_EQ(s1.begin(), s1.rend().base());
+
+    FixedBTreeMap<int, int, 10>::const_iterator const_it = s1.begin();
+    EXPECT_EQ(const_it, s1.cbegin());
+    EXPECT_EQ(3, std::distance(s1.cbegin(), s1.cend()));
+}
+
+TEST(FixedBTreeMap, Iterator_AcrossLeaves)
+{
+    WideMap<50> s1{};
+    for (int i = 49; i >= 0; i--)
+    {
+        s1.try_emplace(WideKey{i}, i);
+    }
+
+    int expected = 49;
+    for (auto it = s1.rbegin(); it != s1.rend(); ++it)
+    {
+        EXPECT_EQ(expected, it->first().value);
+        expected--;
+    }
+    EXPECT_EQ(-1, expected);
+    EXPECT_EQ(48, std::prev(s1.end(), 2)->first().value);
+    EXPECT_EQ(50, std::distance(s1.begin(), s1.end()));
+}
+
+TEST(FixedBTreeMap, Lookup)
+{
+    constexpr FixedBTreeMap<int, int, 10> s1{{2, 20}, {4, 40}, {6, 60}};
+    static_assert(s1.find(4)->second() == 40);
+    static_assert(s1.find(5) == s1.end());
+    static_assert(s1.contains(2));
+    static_assert(!s1.contains(3));
+    static_assert(s1.count(6) == 1);
+    static_assert(s1.count(7) == 0);
+    static_assert(s1.lower_bound(3)->first() == 4);
+    static_assert(s1.lower_bound(4)->first() == 4);
+    static_assert(s1.upper_bound(4)->first() == 6);
+    static_assert(s1.upper_bound(6) == s1.end());
+
+    static_assert(std::distance(s1.equal_range(4).first, s1.equal_range(4).second) == 1);
+    static_assert(s1.equal_range(5).first == s1.equal_range(5).second);
+}
+
+TEST(FixedBTreeMap, Lookup_AcrossLeaves)
+{
+    constexpr auto s1 = []()
+    {
+        WideMap<60> s{};
+        for (int i = 0; i < 60; i++)
+        {
+            s.try_emplace(WideKey{i * 2}, i);
+        }
+        return s;
+    }();
+    static_assert(s1.depth() >= 3);
+    for (int i = 0; i < 60; i++)
+    {
+        EXPECT_EQ(i, s1.find(WideKey{i * 2})->second());
+        EXPECT_EQ(s1.end(), s1.find(WideKey{(i * 2) + 1}));
+        EXPECT_EQ(i * 2, s1.lower_bound(WideKey{(i * 2) - 1})->first().value);
+        const auto upper = s1.upper_bound(WideKey{i * 2});
+        if (i == 59)
+        {
+            EXPECT_EQ(s1.end(), upper);
+        }
+        else
+        {
+            EXPECT_EQ((i + 1) * 2, upper->first().value);
+        }
+    }
+}
+
+TEST(FixedBTreeMap, Lookup_TransparentComparator)
+{
+    constexpr FixedBTreeMap<MockAComparableToB, int, 5, std::less<>> s1{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    constexpr MockBComparableToA b3{3};
+    constexpr MockBComparableToA b4{4};
+    static_assert(s1.find(b3)->second() == 30);
+    static_assert(s1.find(b4) == s1.end());
+    static_assert(s1.contains(b3));
+    static_assert(s1.count(b4) == 0);
+    static_assert(s1.lower_bound(b4)->first() == MockAComparableToB{5});
+    static_assert(s1.upper_bound(b3)->first() == MockAComparableToB{5});
+    static_assert(std::distance(s1.equal_range(b3).first, s1.equal_range(b3).second) == 1);
+}
+
+TEST(FixedBTreeMap, Equality)
+{
+    constexpr FixedBTreeMap<int, int, 10> s1{{1, 10}, {2, 20}};
+    constexpr FixedBTreeMap<int, int, 5> s2{{2, 20}, {1, 10}};
+    constexpr FixedBTreeMap<int, int, 10> s3{{1, 10}, {2, 21}};
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+TEST(FixedBTreeMap, CopyAndMove_NonTriviallyCopyable)
+{
+    FixedBTreeMap<int, std::string, 100> s1{};
+    for (int i = 0; i < 100; i++)
+    {
+        s1.try_emplace(i, std::to_string(i));
+    }
+
+    FixedBTreeMap<int, std::string, 100> s2{s1};
+    EXPECT_EQ(s1, s2);
+    s2.erase(5);
+    EXPECT_EQ("5", s1.at(5));
+
+    FixedBTreeMap<int, std::string, 100> s3{std::move(s2)};
+    EXPECT_EQ(99, s3.size());
+    EXPECT_EQ("99", s3.at(99));
+
+    s3 = s1;
+    EXPECT_EQ(s1, s3);
+    s2 = std::move(s3);
+    EXPECT_EQ(s1, s2);
+}
+
+TEST(FixedBTreeMap, NonDefaultConstructible)
+{
+    FixedBTreeMap<int, MockNonDefaultConstructible, 10> s1{};
+    s1.try_emplace(2, 3);
+    s1.try_emplace(1, 5);
+    EXPECT_EQ(2, s1.size());
+    s1.erase(1);
+    EXPECT_EQ(1, s1.size());
+}
+
+namespace
+{
+template <FixedBTreeMap<int, int, 5> /*INSTANCE*/>
+struct FixedBTreeMapInstanceCanBeUsedAsATemplateParameter
+{
+};
+}  // namespace
+
+TEST(FixedBTreeMap, UsageAsTemplateParameter)
+{
+    static constexpr FixedBTreeMap<int, int, 5> INSTANCE1{{1, 10}};
+    FixedBTreeMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,179 @@
+#include "fixed_containers/fixed_btree_set.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedBTreeSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+
+static_assert(NotTriviallyCopyable<FixedBTreeSet<std::string, 10>>);
+
+// Nodes of 4 keys, so that trees get deep with few entries
+using WideKey = std::array<std::int64_t, 8>;
+static_assert(fixed_btree_detail::KEYS_PER_NODE<WideKey> == 4);
+}  // namespace
+
+TEST(FixedBTreeSet, DefaultConstructor)
+{
+    constexpr FixedBTreeSet<int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+}
+
+TEST(FixedBTreeSet, Initializer)
+{
+    constexpr FixedBTreeSet<int, 10> s1{4, 2, 4, 3};
+    static_assert(s1.size() == 3);
+    static_assert(std::ranges::equal(s1, std::array{2, 3, 4}));
+
+    constexpr auto s2 = make_fixed_btree_set({5, 1});
+    static_assert(s2.max_size() == 2);
+    static_assert(is_full(s2));
+}
+
+TEST(FixedBTreeSet, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeSet<int, 10> s{};
+        s.insert(2);
+        s.insert(4);
+        s.insert(1);
+        s.insert(2);
+        s.insert(s.end(), 5);
+        s.insert(s.begin(), 3);
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1, std::array{1, 2, 3, 4, 5}));
+
+    FixedBTreeSet<std::string, 10> s2{};
+    auto [it, was_inserted] = s2.insert("b");
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ("b", *it);
+    std::tie(it, was_inserted) = s2.emplace(2, 'a');
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ("aa", *it);
+    std::tie(it, was_inserted) = s2.insert("b");
+    EXPECT_FALSE(was_inserted);
+    EXPECT_EQ(std::next(s2.begin()), it);
+}
+
+TEST(FixedBTreeSet, Insert_ExceedsCapacity)
+{
+    FixedBTreeSet<int, 2> s1{1, 2};
+    s1.insert(2);
+    EXPECT_DEATH(s1.insert(3), "");
+}
+
+TEST(FixedBTreeSet, RandomizedAgainstStdSet)
+{
+    std::mt19937 random_engine{7};
+    std::uniform_int_distribution<std::int64_t> distribution{-200, 200};
+    for (int round = 0; round < 20; round++)
+    {
+        FixedBTreeSet<WideKey, 300> btree{};
+        std::set<WideKey> reference{};
+        for (int step = 0; step < 1500; step++)
+        {
+            const WideKey key{distribution(random_engine)};
+            if (step % 3 != 2)
+            {
+                btree.insert(key);
+                reference.insert(key);
+            }
+            else
+            {
+                ASSERT_EQ(reference.erase(key), btree.erase(key));
+            }
+        }
+        ASSERT_TRUE(std::ranges::equal(reference, btree));
+        ASSERT_TRUE(std::equal(reference.rbegin(), reference.rend(), btree.rbegin()));
+    }
+}
+
+TEST(FixedBTreeSet, FromSortedUnique)
+{
+    constexpr auto s1 = FixedBTreeSet<int, 10>::from_sorted_unique({1, 3, 5});
+    static_assert(std::ranges::equal(s1, std::array{1, 3, 5}));
+
+    std::vector<WideKey> input{};
+    for (std::int64_t i = 0; i < 100; i++)
+    {
+        input.push_back(WideKey{i});
+    }
+    const auto s2 = FixedBTreeSet<WideKey, 100>::from_sorted_unique(input.begin(), input.end());
+    EXPECT_TRUE(std::ranges::equal(input, s2));
+    EXPECT_TRUE(is_full(s2));
+}
+
+TEST(FixedBTreeSet, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedBTreeSet<int, 10> s{1, 2, 3, 4, 5, 6};
+        s.erase(2);
+        s.erase(9);
+        auto it = s.erase(s.find(4));
+        s.erase(it, std::next(it));
+        erase_if(s, [](const int key) { return key == 6; });
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1, std::array{1, 3}));
+}
+
+TEST(FixedBTreeSet, Lookup)
+{
+    constexpr FixedBTreeSet<int, 10> s1{2, 4, 6};
+    static_assert(*s1.find(4) == 4);
+    static_assert(s1.find(5) == s1.end());
+    static_assert(s1.contains(6));
+    static_assert(s1.count(3) == 0);
+    static_assert(*s1.lower_bound(3) == 4);
+    static_assert(*s1.upper_bound(4) == 6);
+    static_assert(std::distance(s1.equal_range(4).first, s1.equal_range(4).second) == 1);
+    static_assert(*s1.rbegin() == 6);
+}
+
+TEST(FixedBTreeSet, Lookup_TransparentComparator)
+{
+    constexpr FixedBTreeSet<MockAComparableToB, 5, std::less<>> s1{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA b3{3};
+    constexpr MockBComparableToA b4{4};
+    static_assert(s1.find(b3) != s1.end());
+    static_assert(!s1.contains(b4));
+    static_assert(*s1.lower_bound(b4) == MockAComparableToB{5});
+    static_assert(*s1.upper_bound(b3) == MockAComparableToB{5});
+}
+
+TEST(FixedBTreeSet, Equality)
+{
+    constexpr FixedBTreeSet<int, 10> s1{1, 2};
+    constexpr FixedBTreeSet<int, 5> s2{2, 1};
+    constexpr FixedBTreeSet<int, 10> s3{1, 3};
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,360 @@
+#include "fixed_containers/fixed_circular_deque.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <ranges>
+
+namespace fixed_containers
+{
+namespace
+{
+// Static assert for expected type properties
+namespace trivially_copyable_circular_deque
+{
+using DequeType = FixedCircularDeque<int, 5>;
+static_assert(TriviallyCopyable<DequeType>);
+static_assert(NotTrivial<DequeType>);
+static_assert(StandardLayout<DequeType>);
+static_assert(IsStructuralType<DequeType>);
+
+static_assert(std::random_access_iterator<DequeType::iterator>);
+static_assert(std::random_access_iterator<DequeType::const_iterator>);
+static_assert(!std::contiguous_iterator<DequeType::iterator>);
+static_assert(std::ranges::random_access_range<DequeType>);
+static_assert(std::ranges::random_access_range<const DequeType>);
+
+static_assert(std::is_same_v<std::iter_value_t<DequeType::iterator>, int>);
+static_assert(std::is_same_v<std::iter_reference_t<DequeType::iterator>, int&>);
+static_assert(std::is_same_v<std::iter_difference_t<DequeType::iterator>, std::ptrdiff_t>);
+static_assert(std::is_same_v<std::iter_reference_t<DequeType::const_iterator>, const int&>);
+static_assert(std::is_convertible_v<DequeType::iterator, DequeType::const_iterator>);
+}  // namespace trivially_copyable_circular_deque
+
+namespace not_trivially_copyable_circular_deque
+{
+using DequeType = FixedCircularDeque<MockNonTrivialInt, 5>;
+static_assert(!TriviallyCopyable<DequeType>);
+static_assert(NotTrivial<DequeType>);
+static_assert(!IsStructuralType<DequeType>);
+}  // namespace not_trivially_copyable_circular_deque
+
+// Pushes and pops enough times that the contents straddle the end of the storage
+template <class DequeType>
+constexpr DequeType make_wrapped(const std::size_t count)
+{
+    DequeType d{};
+    for (std::size_t i = 0; i < d.max_size() - 1; i++)
+    {
+        d.push_back(0);
+    }
+    for (std::size_t i = 0; i < d.max_size() - 1; i++)
+    {
+        d.pop_front();
+    }
+    for (std::size_t i = 0; i < count; i++)
+    {
+        d.push_back(static_cast<int>(i));
+    }
+    return d;
+}
+}  // namespace
+
+TEST(FixedCircularDeque, DefaultConstructor)
+{
+    constexpr FixedCircularDeque<int, 8> v1{};
+    static_assert(v1.empty());
+    static_assert(v1.max_size() == 8);
+}
+
+TEST(FixedCircularDeque, InitializerConstructor)
+{
+    constexpr FixedCircularDeque<int, 3> v1{77, 99};
+    static_assert(v1[0] == 77);
+    static_assert(v1[1] == 99);
+    static_assert(v1.size() == 2);
+
+    EXPECT_TRUE(std::ranges::equal(v1, std::array{77, 99}));
+}
+
+TEST(FixedCircularDeque, CountConstructor)
+{
+    constexpr FixedCircularDeque<int, 7> v1(3, 5);
+    static_assert(v1.size() == 3);
+    static_assert(v1[0] == 5 && v1[1] == 5 && v1[2] == 5);
+}
+
+TEST(FixedCircularDeque, IteratorConstructor)
+{
+    constexpr std::array<int, 2> a{77, 99};
+    constexpr FixedCircularDeque<int, 15> v1{a.begin(), a.end()};
+    static_assert(v1[0] == 77);
+    static_assert(v1[1] == 99);
+    static_assert(v1.size() == 2);
+
+    MockIntStream stream{3};
+    FixedCircularDeque<int, 14> v2{stream.begin(), stream.end()};
+    EXPECT_TRUE(std::ranges::equal(v2, std::array{3, 2, 1}));
+}
+
+TEST(FixedCircularDeque, PushAndPopBothEnds)
+{
+    constexpr auto v1 = []()
+    {
+        FixedCircularDeque<int, 5> v{};
+        v.push_back(2);
+        v.push_front(1);
+        const int value = 0;
+        v.push_front(value);
+        v.push_back(3);
+        v.emplace_back(4);
+        v.pop_front();
+        v.emplace_front(9);
+        return v;
+    }();
+
+    static_assert(v1.size() == 5);
+    static_assert(is_full(v1));
+    EXPECT_TRUE(std::ranges::equal(v1, std::array{9, 1, 2, 3, 4}));
+
+    constexpr auto v2 = [](FixedCircularDeque<int, 5> v)
+    {
+        v.pop_back();
+        v.pop_front();
+        return v;
+    }(v1);
+    EXPECT_TRUE(std::ranges::equal(v2, std::array{1, 2, 3}));
+}
+
+TEST(FixedCircularDeque, EmplaceReturnsReference)
+{
+    FixedCircularDeque<int, 3> v{};
+    v.emplace_front(1) = 10;
+    v.emplace_back(2) = 20;
+    EXPECT_TRUE(std::ranges::equal(v, std::array{10, 20}));
+}
+
+TEST(FixedCircularDeque, WrapAround)
+{
+    // Power-of-two capacity wraps with a mask, other capacities with a subtraction
+    constexpr auto v1 = make_wrapped<FixedCircularDeque<int, 8>>(5);
+    static_assert(v1.IMPLEMENTATION_DETAIL_DO_NOT_USE_start_ == 7);
+    static_assert(v1.front() == 0);
+    static_assert(v1.back() == 4);
+    EXPECT_TRUE(std::ranges::equal(v1, std::array{0, 1, 2, 3, 4}));
+
+    constexpr auto v2 = make_wrapped<FixedCircularDeque<int, 7>>(7);
+    static_assert(v2.IMPLEMENTATION_DETAIL_DO_NOT_USE_start_ == 6);
+    static_assert(is_full(v2));
+    EXPECT_TRUE(std::ranges::equal(v2, std::array{0, 1, 2, 3, 4, 5, 6}));
+    EXPECT_TRUE(std::ranges::equal(v2 | std::views::reverse, std::array{6, 5, 4, 3, 2, 1, 0}));
+}
+
+TEST(FixedCircularDeque, PushFrontWrapsToTheEndOfTheStorage)
+{
+    FixedCircularDeque<int, 4> v{};
+    v.push_front(1);
+    EXPECT_EQ(3, v.IMPLEMENTATION_DETAIL_DO_NOT_USE_start_);
+    v.push_front(0);
+    v.push_back(2);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{0, 1, 2}));
+}
+
+TEST(FixedCircularDeque, RollingWindow)
+{
+    FixedCircularDeque<int, 3> v{};
+    for (int i = 0; i < 10; i++)
+    {
+        if (is_full(v))
+        {
+            v.pop_front();
+        }
+        v.push_back(i);
+    }
+    EXPECT_TRUE(std::ranges::equal(v, std::array{7, 8, 9}));
+}
+
+TEST(FixedCircularDeque, MatchesStdDeque)
+{
+    std::mt19937 rng{42};
+    FixedCircularDeque<int, 13> actual{};
+    std::deque<int> expected{};
+
+    for (int i = 0; i < 10'000; i++)
+    {
+        switch (rng() % 4)
+        {
+        case 0:
+            if (!is_full(actual))
+            {
+                actual.push_back(i);
+                expected.push_back(i);
+            }
+            break;
+        case 1:
+            if (!is_full(actual))
+            {
+                actual.push_front(i);
+                expected.push_front(i);
+            }
+            break;
+        case 2:
+            if (!actual.empty())
+            {
+                actual.pop_back();
+                expected.pop_back();
+            }
+            break;
+        default:
+            if (!actual.empty())
+            {
+                actual.pop_front();
+                expected.pop_front();
+            }
+            break;
+        }
+
+        ASSERT_EQ(expected.size(), actual.size());
+        ASSERT_TRUE(std::ranges::equal(expected, actual));
+    }
+}
+
+TEST(FixedCircularDeque, RandomAccessIterators)
+{
+    auto v = make_wrapped<FixedCircularDeque<int, 4>>(4);
+
+    auto it = v.begin();
+    EXPECT_EQ(2, it[2]);
+    EXPECT_EQ(3, *(it + 3));
+    EXPECT_EQ(4, v.end() - v.begin());
+    EXPECT_EQ(1, *(v.end() - 3));
+    EXPECT_TRUE(v.begin() < v.end());
+
+    *it = 10;
+    it += 1;
+    *it = 11;
+    EXPECT_TRUE(std::ranges::equal(v, std::array{10, 11, 2, 3}));
+
+    const auto& const_ref = v;
+    FixedCircularDeque<int, 4>::const_iterator cit = v.begin();
+    EXPECT_EQ(cit, const_ref.cbegin());
+    EXPECT_EQ(3, *const_ref.rbegin());
+    EXPECT_EQ(10, *std::prev(const_ref.rend()));
+
+    std::ranges::sort(v, std::greater<>{});
+    EXPECT_TRUE(std::ranges::equal(v, std::array{11, 10, 3, 2}));
+}
+
+TEST(FixedCircularDeque, At)
+{
+    constexpr auto v1 = make_wrapped<FixedCircularDeque<int, 6>>(4);
+    static_assert(v1.at(0) == 0);
+    static_assert(v1.at(3) == 3);
+
+    auto v2 = v1;
+    v2.at(1) = 100;
+    EXPECT_EQ(100, v2[1]);
+}
+
+TEST(FixedCircularDeque, At_OutOfBounds)
+{
+    auto v1 = make_wrapped<FixedCircularDeque<int, 6>>(4);
+    EXPECT_DEATH(v1.at(4) = 901, "");
+    EXPECT_DEATH(v1[v1.size()] = 901, "");
+}
+
+TEST(FixedCircularDeque, ExceedCapacity)
+{
+    FixedCircularDeque<int, 2> v1{1, 2};
+    EXPECT_DEATH(v1.push_back(3), "");
+    EXPECT_DEATH(v1.push_front(0), "");
+    EXPECT_DEATH(v1.emplace_back(3), "");
+    EXPECT_DEATH(v1.emplace_front(0), "");
+
+    using DequeType = FixedCircularDeque<int, 2>;
+    EXPECT_DEATH((DequeType{1, 2, 3}), "");
+}
+
+TEST(FixedCircularDeque, EmptyAccess)
+{
+    FixedCircularDeque<int, 2> v1{};
+    EXPECT_DEATH(v1.pop_back(), "");
+    EXPECT_DEATH(v1.pop_front(), "");
+    EXPECT_DEATH((void)v1.front(), "");
+    EXPECT_DEATH((void)v1.back(), "");
+}
+
+TEST(FixedCircularDeque, Clear)
+{
+    auto v1 = make_wrapped<FixedCircularDeque<int, 5>>(3);
+    v1.clear();
+    EXPECT_TRUE(v1.empty());
+    EXPECT_EQ(v1.begin(), v1.end());
+    v1.push_front(1);
+    EXPECT_EQ(1, v1.front());
+}
+
+TEST(FixedCircularDeque, EqualityAndComparison)
+{
+    constexpr auto v1 = make_wrapped<FixedCircularDeque<int, 5>>(3);
+    constexpr FixedCircularDeque<int, 5> v2{0, 1, 2};
+    constexpr FixedCircularDeque<int, 9> v3{0, 1, 2};
+    constexpr FixedCircularDeque<int, 5> v4{0, 1, 3};
+
+    static_assert(v1 == v2);
+    static_assert(v1 == v3);
+    static_assert(v1 != v4);
+    static_assert(v1 < v4);
+    static_assert(FixedCircularDeque<int, 5>{0, 1} < v1);
+}
+
+TEST(FixedCircularDeque, NonTrivialCopyAndMove)
+{
+    using DequeType = FixedCircularDeque<MockNonTrivialInt, 4>;
+    DequeType v1{};
+    v1.push_back(2);
+    v1.push_front(1);
+    v1.push_front(0);
+
+    DequeType v2{v1};
+    EXPECT_TRUE(std::ranges::equal(v2, v1));
+
+    DequeType v3{};
+    v3 = v1;
+    EXPECT_TRUE(std::ranges::equal(v3, v1));
+
+    DequeType v4{std::move(v2)};
+    EXPECT_TRUE(std::ranges::equal(v4, v1));
+    EXPECT_TRUE(v2.empty());  // NOLINT(bugprone-use-after-move)
+
+    v3.pop_front();
+    v3 = std::move(v4);
+    EXPECT_TRUE(std::ranges::equal(v3, v1));
+}
+
+namespace
+{
+template <FixedCircularDeque<int, 4> MY_DEQUE>
+constexpr int back_of_template_parameter()
+{
+    return MY_DEQUE.back();
+}
+}  // namespace
+
+TEST(FixedCircularDeque, UsageAsTemplateParameter)
+{
+    static constexpr auto DEQUE1 = make_wrapped<FixedCircularDeque<int, 4>>(3);
+    static_assert(back_of_template_parameter<DEQUE1>() == 2);
+}
+
+}  // namespace fixed_containers
@@ -1,11 +1,15 @@
 #include "fixed_containers/fixed_deque.hpp"
 
 #include "mock_testing_types.hpp"
+#include "sequence_container_test_common.hpp"
+#include "test_utilities_common.hpp"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <array>
 #include <span>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -850,6 +854,13 @@ TEST(FixedDeque, EraseOne)
     EXPECT_TRUE(std::ranges::equal(v2, std::array<int, 3>{{1, 4, 0}}));
 }
 
+// Runtime insertions and erasures shift the tail as a block for trivially copyable types
+using FixedDequeShiftTypes = testing::Types<FixedDeque<SequenceContainerShiftEntry, 64>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(FixedDeque,
+                               SequenceContainerShiftFixture,
+                               FixedDequeShiftTypes,
+                               NameProviderForTypeParameterizedTest);
+
 TEST(FixedDeque, Erase_Empty)
 {
     {
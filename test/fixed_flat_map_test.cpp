@@ -0,0 +1,420 @@
+#include "fixed_containers/fixed_flat_map.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedFlatMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_reverse_iterator>);
+
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, PairView<const int, int>>);
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, PairView<const int, const int>>);
+static_assert(std::is_same_v<ES_1::reference, ES_1::iterator::reference>);
+
+static_assert(NotTriviallyCopyable<FixedFlatMap<int, std::string, 10>>);
+}  // namespace
+
+TEST(FixedFlatMap, DefaultConstructor)
+{
+    constexpr FixedFlatMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+}
+
+TEST(FixedFlatMap, Initializer)
+{
+    constexpr FixedFlatMap<int, int, 10> s1{{4, 40}, {2, 20}, {4, 41}};
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    // First of the repeated keys wins, like with repeated insert()
+    static_assert(s1.at(4) == 40);
+
+    constexpr FixedFlatMap<int, int, 2> s2{{2, 20}, {4, 40}};
+    static_assert(is_full(s2));
+}
+
+TEST(FixedFlatMap, IteratorConstructor)
+{
+    constexpr std::array INPUT{std::pair{4, 40}, std::pair{2, 20}};
+    constexpr FixedFlatMap<int, int, 10> s1{INPUT.begin(), INPUT.end()};
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedFlatMap, KeysAndValuesAreStoredSeparately)
+{
+    constexpr FixedFlatMap<int, char, 10> s1{{3, 'c'}, {1, 'a'}, {2, 'b'}};
+    static_assert(std::ranges::equal(s1.keys(), std::array{1, 2, 3}));
+    static_assert(std::ranges::equal(s1.values(), std::array{'a', 'b', 'c'}));
+}
+
+TEST(FixedFlatMap, MaxSizeDeduction)
+{
+    constexpr auto s1 = make_fixed_flat_map({std::pair{30, 30}, std::pair{31, 54}});
+    static_assert(s1.size() == 2);
+    static_assert(s1.max_size() == 2);
+    static_assert(s1.contains(30));
+    static_assert(s1.contains(31));
+}
+
+TEST(FixedFlatMap, OperatorBracket)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{};
+        s[4] = 40;
+        s[2] = 20;
+        s[4] = 41;
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 41);
+
+    FixedFlatMap<std::string, int, 10> s2{};
+    s2["b"] = 2;
+    std::string a = "a";
+    s2[std::move(a)] = 1;
+    EXPECT_EQ(1, s2.at("a"));
+    EXPECT_EQ(2, s2.at("b"));
+}
+
+TEST(FixedFlatMap, At_OutOfRange)
+{
+    const FixedFlatMap<int, int, 10> s1{{2, 20}};
+    EXPECT_DEATH((void)s1.at(3), "");
+}
+
+TEST(FixedFlatMap, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{};
+        s.insert({2, 20});
+        s.insert({4, 40});
+        s.insert({1, 10});
+        s.insert({2, 21});
+        return s;
+    }();
+    static_assert(s1.size() == 3);
+    static_assert(std::ranges::equal(s1.keys(), std::array{1, 2, 4}));
+    static_assert(s1.at(2) == 20);
+
+    FixedFlatMap<int, int, 10> s2{};
+    auto [it, was_inserted] = s2.insert({3, 30});
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ(3, it->first());
+    EXPECT_EQ(30, it->second());
+    std::tie(it, was_inserted) = s2.insert({3, 31});
+    EXPECT_FALSE(was_inserted);
+    EXPECT_EQ(30, it->second());
+}
+
+TEST(FixedFlatMap, Insert_ExceedsCapacity)
+{
+    FixedFlatMap<int, int, 2> s1{{1, 10}, {2, 20}};
+    s1.insert({2, 21});  // Already present: doesn't need room
+    EXPECT_DEATH(s1.insert({3, 30}), "");
+    const std::array<std::pair<int, int>, 1> extra{{{0, 0}}};
+    EXPECT_DEATH(s1.insert(extra.begin(), extra.end()), "");
+}
+
+TEST(FixedFlatMap, InsertIterators_OverlappingKeysAtFullCapacity)
+{
+    // Only the merged size counts against the capacity, as with FixedMap
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 4> s{{1, 1}, {2, 2}, {3, 3}};
+        s.insert({{1, 10}, {2, 20}, {3, 30}, {4, 40}});
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1.keys(), std::array{1, 2, 3, 4}));
+    static_assert(std::ranges::equal(s1.values(), std::array{1, 2, 3, 40}));
+
+    // Keys repeated within the range, past the point where the appended entries fill the map
+    constexpr FixedFlatMap<int, int, 3> s2{{5, 50}, {5, 51}, {6, 60}, {5, 52}, {6, 61}, {7, 70}};
+    static_assert(std::ranges::equal(s2.keys(), std::array{5, 6, 7}));
+    static_assert(std::ranges::equal(s2.values(), std::array{50, 60, 70}));
+
+    FixedFlatMap<int, int, 4> s3{{1, 1}, {2, 2}, {3, 3}};
+    const std::vector<std::pair<int, int>> input{{3, 30}, {1, 10}, {4, 40}, {2, 20}, {4, 41}};
+    s3.insert_range(input);
+    EXPECT_EQ((FixedFlatMap<int, int, 4>{{1, 1}, {2, 2}, {3, 3}, {4, 40}}), s3);
+
+    // Still fails when the merged size exceeds the capacity
+    EXPECT_DEATH(s3.insert({{1, 10}, {5, 50}}), "");
+}
+
+TEST(FixedFlatMap, InsertIterators_MergesWithExistingEntries)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{{2, 20}, {6, 60}, {8, 80}};
+        const std::array<std::pair<int, int>, 6> input{
+            {{7, 70}, {1, 10}, {6, 61}, {9, 90}, {1, 11}, {3, 30}}};
+        s.insert(input.begin(), input.end());
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1.keys(), std::array{1, 2, 3, 6, 7, 8, 9}));
+    static_assert(std::ranges::equal(s1.values(), std::array{10, 20, 30, 60, 70, 80, 90}));
+}
+
+TEST(FixedFlatMap, InsertRange)
+{
+    FixedFlatMap<int, std::string, 10> s1{{5, "five"}};
+    const std::vector<std::pair<int, std::string>> input{{3, "three"}, {5, "FIVE"}, {1, "one"}};
+    s1.insert_range(input);
+    EXPECT_EQ(3, s1.size());
+    EXPECT_EQ("one", s1.at(1));
+    EXPECT_EQ("three", s1.at(3));
+    EXPECT_EQ("five", s1.at(5));
+}
+
+TEST(FixedFlatMap, InsertRange_RandomizedAgainstStdMap)
+{
+    std::mt19937 random_engine{42};
+    std::uniform_int_distribution<int> key_distribution{0, 300};
+    for (int round = 0; round < 50; round++)
+    {
+        FixedFlatMap<int, int, 400> flat{};
+        std::map<int, int> reference{};
+        for (int batch = 0; batch < 4; batch++)
+        {
+            std::vector<std::pair<int, int>> input{};
+            for (int i = 0; i < 50; i++)
+            {
+                input.emplace_back(key_distribution(random_engine), (batch * 1000) + i);
+            }
+            flat.insert_range(input);
+            reference.insert(input.begin(), input.end());
+
+            ASSERT_EQ(reference.size(), flat.size());
+            ASSERT_TRUE(std::equal(reference.begin(),
+                                   reference.end(),
+                                   flat.begin(),
+                                   [](const auto& left, const auto& right)
+                                   {
+                                       return left.first == right.first() &&
+                                              left.second == right.second();
+                                   }));
+        }
+    }
+}
+
+TEST(FixedFlatMap, FromSortedUnique)
+{
+    constexpr auto s1 = FixedFlatMap<int, int, 10>::from_sorted_unique({{1, 10}, {2, 20}, {5, 50}});
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(5) == 50);
+
+    constexpr auto s2 = []()
+    {
+        FixedFlatMap<int, int, 10> s{{3, 30}};
+        s.insert_sorted({{1, 10}, {2, 20}, {5, 50}});
+        return s;
+    }();
+    static_assert(std::ranges::equal(s2.keys(), std::array{1, 2, 3, 5}));
+}
+
+TEST(FixedFlatMap, InsertOrAssign)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{};
+        s.insert_or_assign(2, 20);
+        s.insert_or_assign(4, 40);
+        s.insert_or_assign(2, 21);
+        s.insert_or_assign(s.end(), 6, 60);
+        s.insert_or_assign(s.begin(), 4, 41);
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1.keys(), std::array{2, 4, 6}));
+    static_assert(std::ranges::equal(s1.values(), std::array{21, 41, 60}));
+}
+
+TEST(FixedFlatMap, TryEmplace)
+{
+    FixedFlatMap<int, std::string, 10> s1{};
+    auto [it, was_inserted] = s1.try_emplace(2, 3, 'a');
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ("aaa", it->second());
+    std::tie(it, was_inserted) = s1.try_emplace(2, "bb");
+    EXPECT_FALSE(was_inserted);
+    EXPECT_EQ("aaa", it->second());
+
+    // Correct and incorrect hints
+    s1.try_emplace(s1.end(), 5, "five");
+    s1.try_emplace(s1.end(), 1, "one");
+    s1.try_emplace(s1.find(5), 3, "three");
+    EXPECT_TRUE(std::ranges::equal(s1.keys(), std::array{1, 2, 3, 5}));
+}
+
+TEST(FixedFlatMap, Emplace)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{};
+        s.emplace(2, 20);
+        s.emplace(std::pair{1, 10});
+        s.emplace_hint(s.end(), 3, 30);
+        s.emplace(2, 21);
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1.keys(), std::array{1, 2, 3}));
+    static_assert(std::ranges::equal(s1.values(), std::array{10, 20, 30}));
+}
+
+TEST(FixedFlatMap, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}};
+        s.erase(2);
+        s.erase(7);
+        auto it = s.erase(s.find(4));
+        s.erase(it, s.end());
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1.keys(), std::array{1, 3}));
+    static_assert(std::ranges::equal(s1.values(), std::array{10, 30}));
+
+    FixedFlatMap<int, int, 10> s2{{1, 10}, {2, 20}, {3, 30}};
+    auto it = s2.erase(s2.begin());
+    EXPECT_EQ(2, it->first());
+    it = s2.erase(s2.begin(), s2.end());
+    EXPECT_EQ(s2.end(), it);
+    EXPECT_TRUE(s2.empty());
+}
+
+TEST(FixedFlatMap, EraseIf)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatMap<int, int, 10> s{{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+        const std::size_t removed =
+            erase_if(s, [](const auto& entry) { return entry.second() % 20 == 0; });
+        return std::pair{s, removed};
+    }();
+    static_assert(s1.second == 2);
+    static_assert(std::ranges::equal(s1.first.keys(), std::array{1, 3}));
+    static_assert(std::ranges::equal(s1.first.values(), std::array{10, 30}));
+}
+
+TEST(FixedFlatMap, Iterator)
+{
+    FixedFlatMap<int, int, 10> s1{{3, 30}, {1, 10}, {2, 20}};
+    int expected_key = 1;
+    for (auto&& [key, value] : s1)
+    {
+        EXPECT_EQ(expected_key, key);
+        EXPECT_EQ(expected_key * 10, value);
+        value++;
+        expected_key++;
+    }
+    EXPECT_EQ(21, s1.at(2));
+
+    std::vector<int> reversed_keys{};
+    for (auto it = s1.crbegin(); it != s1.crend(); ++it)
+    {
+        reversed_keys.push_back(it->first());
+    }
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), reversed_keys);
+    EXPECT_EQ(s1.begin(), s1.rend().base());
+
+    FixedFlatMap<int, int, 10>::const_iterator const_it = s1.begin();
+    EXPECT_EQ(const_it, s1.cbegin());
+    EXPECT_EQ(3, std::distance(s1.cbegin(), s1.cend()));
+}
+
+TEST(FixedFlatMap, Lookup)
+{
+    constexpr FixedFlatMap<int, int, 10> s1{{2, 20}, {4, 40}, {6, 60}};
+    static_assert(s1.find(4)->second() == 40);
+    static_assert(s1.find(5) == s1.end());
+    static_assert(s1.contains(2));
+    static_assert(!s1.contains(3));
+    static_assert(s1.count(6) == 1);
+    static_assert(s1.count(7) == 0);
+    static_assert(s1.lower_bound(3)->first() == 4);
+    static_assert(s1.lower_bound(4)->first() == 4);
+    static_assert(s1.upper_bound(4)->first() == 6);
+    static_assert(s1.upper_bound(6) == s1.end());
+
+    static_assert(std::distance(s1.equal_range(4).first, s1.equal_range(4).second) == 1);
+    static_assert(s1.equal_range(5).first == s1.equal_range(5).second);
+}
+
+TEST(FixedFlatMap, Lookup_TransparentComparator)
+{
+    constexpr FixedFlatMap<MockAComparableToB, int, 5, std::less<>> s1{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    constexpr MockBComparableToA b3{3};
+    constexpr MockBComparableToA b4{4};
+    static_assert(s1.find(b3)->second() == 30);
+    static_assert(s1.find(b4) == s1.end());
+    static_assert(s1.contains(b3));
+    static_assert(s1.count(b4) == 0);
+    static_assert(s1.lower_bound(b4)->first() == MockAComparableToB{5});
+    static_assert(s1.upper_bound(b3)->first() == MockAComparableToB{5});
+    static_assert(std::distance(s1.equal_range(b3).first, s1.equal_range(b3).second) == 1);
+}
+
+TEST(FixedFlatMap, Equality)
+{
+    constexpr FixedFlatMap<int, int, 10> s1{{1, 10}, {2, 20}};
+    constexpr FixedFlatMap<int, int, 5> s2{{2, 20}, {1, 10}};
+    constexpr FixedFlatMap<int, int, 10> s3{{1, 10}, {2, 21}};
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+TEST(FixedFlatMap, NonDefaultConstructible)
+{
+    FixedFlatMap<int, MockNonDefaultConstructible, 10> s1{};
+    s1.try_emplace(2, 3);
+    s1.try_emplace(1, 5);
+    EXPECT_EQ(2, s1.size());
+    s1.erase(1);
+    EXPECT_EQ(1, s1.size());
+}
+
+namespace
+{
+template <FixedFlatMap<int, int, 5> /*INSTANCE*/>
+struct FixedFlatMapInstanceCanBeUsedAsATemplateParameter
+{
+};
+}  // namespace
+
+TEST(FixedFlatMap, UsageAsTemplateParameter)
+{
+    static constexpr FixedFlatMap<int, int, 5> INSTANCE1{{1, 10}};
+    FixedFlatMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,184 @@
+#include "fixed_containers/fixed_flat_set.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedFlatSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::random_access_iterator<ES_1::iterator>);
+static_assert(std::random_access_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+
+static_assert(NotTriviallyCopyable<FixedFlatSet<std::string, 10>>);
+}  // namespace
+
+TEST(FixedFlatSet, DefaultConstructor)
+{
+    constexpr FixedFlatSet<int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+}
+
+TEST(FixedFlatSet, Initializer)
+{
+    constexpr FixedFlatSet<int, 10> s1{4, 2, 4, 3};
+    static_assert(s1.size() == 3);
+    static_assert(std::ranges::equal(s1, std::array{2, 3, 4}));
+
+    constexpr auto s2 = make_fixed_flat_set({5, 1});
+    static_assert(s2.max_size() == 2);
+    static_assert(is_full(s2));
+}
+
+TEST(FixedFlatSet, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatSet<int, 10> s{};
+        s.insert(2);
+        s.insert(4);
+        s.insert(1);
+        s.insert(2);
+        s.insert(s.end(), 5);
+        s.insert(s.begin(), 3);
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1, std::array{1, 2, 3, 4, 5}));
+
+    FixedFlatSet<std::string, 10> s2{};
+    auto [it, was_inserted] = s2.insert("b");
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ("b", *it);
+    std::tie(it, was_inserted) = s2.emplace(2, 'a');
+    EXPECT_TRUE(was_inserted);
+    EXPECT_EQ("aa", *it);
+    std::tie(it, was_inserted) = s2.insert("b");
+    EXPECT_FALSE(was_inserted);
+    EXPECT_EQ(s2.begin() + 1, it);
+}
+
+TEST(FixedFlatSet, Insert_ExceedsCapacity)
+{
+    FixedFlatSet<int, 2> s1{1, 2};
+    s1.insert(2);
+    EXPECT_DEATH(s1.insert(3), "");
+}
+
+TEST(FixedFlatSet, InsertIterators_OverlappingKeysAtFullCapacity)
+{
+    // Only the merged size counts against the capacity, as with FixedSet
+    constexpr auto s1 = []()
+    {
+        FixedFlatSet<int, 4> s{1, 2, 3};
+        s.insert({1, 2, 3, 4});
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1, std::array{1, 2, 3, 4}));
+
+    // Keys repeated within the range, past the point where the appended entries fill the set
+    constexpr FixedFlatSet<int, 3> s2{5, 5, 6, 5, 6, 7};
+    static_assert(std::ranges::equal(s2, std::array{5, 6, 7}));
+
+    FixedFlatSet<int, 4> s3{1, 2, 3};
+    s3.insert_range(std::vector<int>{3, 1, 4, 2, 4});
+    EXPECT_EQ((FixedFlatSet<int, 4>{1, 2, 3, 4}), s3);
+
+    // Still fails when the merged size exceeds the capacity
+    EXPECT_DEATH(s3.insert({1, 5}), "");
+}
+
+TEST(FixedFlatSet, InsertRange_RandomizedAgainstStdSet)
+{
+    std::mt19937 random_engine{7};
+    std::uniform_int_distribution<int> distribution{-100, 100};
+    for (int round = 0; round < 50; round++)
+    {
+        FixedFlatSet<int, 256> flat{};
+        std::set<int> reference{};
+        for (int batch = 0; batch < 4; batch++)
+        {
+            std::vector<int> input{};
+            for (int i = 0; i < 40; i++)
+            {
+                input.push_back(distribution(random_engine));
+            }
+            flat.insert_range(input);
+            reference.insert(input.begin(), input.end());
+            ASSERT_TRUE(std::ranges::equal(reference, flat));
+        }
+    }
+}
+
+TEST(FixedFlatSet, FromSortedUnique)
+{
+    constexpr auto s1 = FixedFlatSet<int, 10>::from_sorted_unique({1, 3, 5});
+    static_assert(std::ranges::equal(s1, std::array{1, 3, 5}));
+}
+
+TEST(FixedFlatSet, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedFlatSet<int, 10> s{1, 2, 3, 4, 5, 6};
+        s.erase(2);
+        s.erase(9);
+        auto it = s.erase(s.find(4));
+        s.erase(it, it + 1);
+        erase_if(s, [](const int key) { return key == 6; });
+        return s;
+    }();
+    static_assert(std::ranges::equal(s1, std::array{1, 3}));
+}
+
+TEST(FixedFlatSet, Lookup)
+{
+    constexpr FixedFlatSet<int, 10> s1{2, 4, 6};
+    static_assert(*s1.find(4) == 4);
+    static_assert(s1.find(5) == s1.end());
+    static_assert(s1.contains(6));
+    static_assert(s1.count(3) == 0);
+    static_assert(*s1.lower_bound(3) == 4);
+    static_assert(*s1.upper_bound(4) == 6);
+    static_assert(s1.equal_range(4).second - s1.equal_range(4).first == 1);
+    static_assert(*s1.rbegin() == 6);
+}
+
+TEST(FixedFlatSet, Lookup_TransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 5, std::less<>> s1{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA b3{3};
+    constexpr MockBComparableToA b4{4};
+    static_assert(s1.find(b3) != s1.end());
+    static_assert(!s1.contains(b4));
+    static_assert(*s1.lower_bound(b4) == MockAComparableToB{5});
+    static_assert(*s1.upper_bound(b3) == MockAComparableToB{5});
+}
+
+TEST(FixedFlatSet, Equality)
+{
+    constexpr FixedFlatSet<int, 10> s1{1, 2};
+    constexpr FixedFlatSet<int, 5> s2{2, 1};
+    constexpr FixedFlatSet<int, 10> s3{1, 3};
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+}  // namespace fixed_containers
@@ -12,8 +12,17 @@
 #include <range/v3/view/filter.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -321,6 +330,145 @@ TEST(FixedMap, InsertInitializer)
     static_assert(s1.contains(4));
 }
 
+TEST(FixedMap, FromSortedUnique)
+{
+    constexpr auto s1 = FixedMap<int, int, 10>::from_sorted_unique({{2, 20}, {4, 40}, {6, 60}});
+    static_assert(s1.size() == 3);
+    static_assert(!s1.contains(1));
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+    static_assert(s1.at(6) == 60);
+    static_assert(std::next(s1.begin(), 2)->first == 6);
+
+    constexpr std::array<std::pair<int, int>, 2> INPUT{{{1, 10}, {3, 30}}};
+    constexpr auto s2 = FixedMap<int, int, 10>::from_sorted_unique(INPUT.begin(), INPUT.end());
+    static_assert(s2.size() == 2);
+    static_assert(s2.at(1) == 10);
+    static_assert(s2.at(3) == 30);
+
+    constexpr auto s3 = FixedMap<int, int, 10>::from_sorted_unique(s1.begin(), s1.end());
+    static_assert(s3 == s1);
+
+    constexpr auto s4 = FixedMap<int, int, 10>::from_sorted_unique(INPUT.end(), INPUT.end());
+    static_assert(s4.empty());
+}
+
+TEST(FixedMap, FromSortedUnique_MatchesRegularInsertion)
+{
+    std::array<std::pair<int, int>, 100> input{};
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = {static_cast<int>(i) * 3, static_cast<int>(i)};
+    }
+
+    const auto s1 = FixedMap<int, int, 100>::from_sorted_unique(input.begin(), input.end());
+    const FixedMap<int, int, 100> s2{input.begin(), input.end()};
+    EXPECT_EQ(s1, s2);
+    EXPECT_TRUE(is_full(s1));
+}
+
+TEST(FixedMap, FromSortedUnique_ExceedsCapacity)
+{
+    constexpr std::array<std::pair<int, int>, 3> INPUT{{{1, 10}, {3, 30}, {5, 50}}};
+    using MapType = FixedMap<int, int, 2>;
+    EXPECT_DEATH((void)MapType::from_sorted_unique(INPUT.begin(), INPUT.end()), "");
+}
+
+TEST(FixedMap, InsertSorted)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMap<int, int, 10> s{};
+        s.insert_sorted({{2, 20}, {4, 40}});
+        // Non-empty, merged in
+        s.insert_sorted({{1, 10}, {4, 41}, {5, 50}});
+        return s;
+    }();
+
+    static_assert(s1.size() == 4);
+    static_assert(s1.at(1) == 10);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+    static_assert(s1.at(5) == 50);
+}
+
+TEST(FixedMap, InsertSorted_NonEmptyKeepsIteratorsValid)
+{
+    FixedMap<int, int, 4> s1{{2, 20}, {4, 40}};
+    const auto it = s1.find(4);
+    // Overlaps with the existing keys and exactly fills the map
+    s1.insert_sorted({{1, 10}, {2, 21}, {3, 30}, {4, 41}});
+
+    EXPECT_EQ(4, s1.size());
+    EXPECT_EQ((FixedMap<int, int, 4>{{1, 10}, {2, 20}, {3, 30}, {4, 40}}), s1);
+    EXPECT_EQ(4, it->first);
+    EXPECT_EQ(40, it->second);
+    EXPECT_EQ(s1.find(4), it);
+}
+
+TEST(FixedMap, InsertSorted_NonEmptyExceedsCapacity)
+{
+    FixedMap<int, int, 3> s1{{2, 20}, {4, 40}};
+    EXPECT_DEATH(s1.insert_sorted({{1, 10}, {3, 30}}), "");
+}
+
+TEST(FixedMap, InsertSorted_NonEmptyMatchesStdMap)
+{
+    const auto check = []<class MapType>(MapType s1)
+    {
+        std::map<int, int> expected{};
+        for (int i = 0; i < 60; i++)
+        {
+            s1.try_emplace(i * 3, i);
+            expected.try_emplace(i * 3, i);
+        }
+        // Free some slots, so that new nodes land in between the existing ones
+        for (int i = 0; i < 60; i += 4)
+        {
+            s1.erase(i * 3);
+            expected.erase(i * 3);
+        }
+
+        std::vector<std::pair<int, int>> sorted{};
+        for (int key = 0; key < 200; key += 2)
+        {
+            sorted.emplace_back(key, -key);
+        }
+        s1.insert_sorted(sorted.begin(), sorted.end());
+        expected.insert(sorted.begin(), sorted.end());
+
+        MapType expected_map{};
+        for (const auto& [key, value] : expected)
+        {
+            expected_map.try_emplace(key, value);
+        }
+        EXPECT_EQ(expected_map, s1);
+        if constexpr (requires { s1.nth(0); })
+        {
+            std::size_t n = 0;
+            for (const auto& [key, value] : expected)
+            {
+                EXPECT_EQ(key, s1.nth(n)->first);
+                n++;
+            }
+        }
+    };
+
+    check(FixedMap<int, int, 200>{});
+    check(FixedMap<int,
+                   int,
+                   200,
+                   std::less<int>,
+                   fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                   FixedIndexBasedContiguousStorage>{});
+    check(FixedMap<int,
+                   int,
+                   200,
+                   std::less<int>,
+                   fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                   FixedIndexBasedOrderStatisticPoolStorage>{});
+}
+
 TEST(FixedMap, InsertOrAssign)
 {
     constexpr auto s1 = []()
@@ -549,6 +697,209 @@ TEST(FixedMap, Emplace_ExceedsCapacity)
     }
 }
 
+TEST(FixedMap, EmplaceHint)
+{
+    {
+        // Ascending keys, hinted at the end
+        constexpr FixedMap<int, int, 10> s = []()
+        {
+            FixedMap<int, int, 10> s1{};
+            for (int i = 0; i < 10; i++)
+            {
+                s1.emplace_hint(s1.cend(), i, i * 10);
+            }
+            return s1;
+        }();
+
+        static_assert(consteval_compare::equal<10, s.size()>);
+        static_assert(s.at(0) == 0);
+        static_assert(s.at(9) == 90);
+    }
+
+    {
+        // Descending keys, hinted at the beginning
+        constexpr FixedMap<int, int, 10> s = []()
+        {
+            FixedMap<int, int, 10> s1{};
+            for (int i = 9; i >= 0; i--)
+            {
+                s1.emplace_hint(s1.cbegin(), i, i * 10);
+            }
+            return s1;
+        }();
+
+        static_assert(consteval_compare::equal<10, s.size()>);
+        static_assert(s.begin()->first == 0);
+        static_assert(std::prev(s.end())->first == 9);
+    }
+
+    {
+        FixedMap<int, int, 10> s1{{2, 20}, {6, 60}};
+
+        // Good hint: the key goes right before it
+        auto [it1, was_inserted1] = s1.emplace_hint(s1.find(6), 4, 40);
+        ASSERT_TRUE(was_inserted1);
+        ASSERT_EQ(4, it1->first);
+        ASSERT_EQ(40, it1->second);
+
+        // Bad hints still insert at the right place
+        auto [it2, was_inserted2] = s1.emplace_hint(s1.cbegin(), 8, 80);
+        ASSERT_TRUE(was_inserted2);
+        ASSERT_EQ(8, it2->first);
+        auto [it3, was_inserted3] = s1.emplace_hint(s1.cend(), 1, 10);
+        ASSERT_TRUE(was_inserted3);
+        ASSERT_EQ(1, it3->first);
+
+        // Existing key, with the hint pointing at it or elsewhere
+        auto [it4, was_inserted4] = s1.emplace_hint(s1.find(4), 4, 99);
+        ASSERT_FALSE(was_inserted4);
+        ASSERT_EQ(40, it4->second);
+        auto [it5, was_inserted5] = s1.emplace_hint(s1.cend(), 2, 99);
+        ASSERT_FALSE(was_inserted5);
+        ASSERT_EQ(20, it5->second);
+
+        ASSERT_EQ(5, s1.size());
+        ASSERT_TRUE(std::is_sorted(
+            s1.begin(), s1.end(), [](const auto& a, const auto& b) { return a.first < b.first; }));
+    }
+}
+
+TEST(FixedMap, EmplaceHint_RandomizedAgainstStdMap)
+{
+    static constexpr std::size_t CAPACITY = 100;
+    FixedMap<int, int, CAPACITY> actual{};
+    std::map<int, int> expected{};
+
+    std::mt19937 g(7);
+    std::uniform_int_distribution<int> key_distribution{0, 300};
+    while (!is_full(actual))
+    {
+        const int key = key_distribution(g);
+        // Alternate between the exact position, a neighbouring one and an arbitrary one
+        auto hint = actual.lower_bound(key);
+        if (key % 3 == 1 && hint != actual.end())
+        {
+            ++hint;
+        }
+        else if (key % 3 == 2)
+        {
+            hint = actual.lower_bound(key_distribution(g));
+        }
+
+        const auto [it, was_inserted] = actual.emplace_hint(hint, key, key * 2);
+        ASSERT_EQ(expected.emplace(key, key * 2).second, was_inserted);
+        ASSERT_EQ(key, it->first);
+        ASSERT_TRUE(std::equal(actual.begin(),
+                               actual.end(),
+                               expected.begin(),
+                               expected.end(),
+                               [](const auto& a, const auto& b)
+                               { return a.first == b.first && a.second == b.second; }));
+    }
+}
+
+TEST(FixedMap, EmplaceHint_AppendAfterMaximumWithChurn)
+{
+    // Appends are resolved through the tracked maximum, so it must survive every kind of erase
+    // and relocation
+    const auto check = [](auto& actual)
+    {
+        std::map<int, int> expected{};
+        std::mt19937 g(11);
+        int next_key = 0;
+        auto last_inserted = actual.end();
+        for (std::size_t round = 0; round < 2000; round++)
+        {
+            switch (g() % 6)
+            {
+            case 0:
+            case 1:
+                if (!is_full(actual))
+                {
+                    next_key += 1 + static_cast<int>(g() % 3);
+                    const auto hint = g() % 2 == 0 ? actual.end() : last_inserted;
+                    last_inserted = actual.emplace_hint(hint, next_key, next_key).first;
+                    expected.emplace(next_key, next_key);
+                }
+                break;
+            case 2:
+                if (!actual.empty())
+                {
+                    expected.erase(std::prev(actual.end())->first);
+                    actual.erase(std::prev(actual.end()));
+                }
+                last_inserted = actual.end();
+                break;
+            case 3:
+            {
+                const int key = static_cast<int>(g() % static_cast<unsigned>(next_key + 1));
+                actual.erase(key);
+                expected.erase(key);
+                last_inserted = actual.end();
+                break;
+            }
+            case 4:
+            {
+                const int key = static_cast<int>(g() % static_cast<unsigned>(next_key + 1));
+                actual.erase(actual.lower_bound(key), actual.end());
+                expected.erase(expected.lower_bound(key), expected.end());
+                next_key = key;
+                last_inserted = actual.end();
+                break;
+            }
+            default:
+                actual.compact_in_order();
+                last_inserted = actual.end();
+                break;
+            }
+
+            ASSERT_EQ(expected.size(), actual.size());
+            if (!expected.empty())
+            {
+                ASSERT_EQ(expected.rbegin()->first, std::prev(actual.end())->first);
+            }
+        }
+        ASSERT_TRUE(std::equal(actual.begin(),
+                               actual.end(),
+                               expected.begin(),
+                               expected.end(),
+                               [](const auto& a, const auto& b)
+                               { return a.first == b.first && a.second == b.second; }));
+    };
+
+    FixedMap<int, int, 64> pool_map{};
+    check(pool_map);
+    FixedMap<int,
+             int,
+             64,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedContiguousStorage>
+        contiguous_map{};
+    check(contiguous_map);
+}
+
+TEST(FixedMap, TryEmplaceAndInsertOrAssign_Hint)
+{
+    constexpr FixedMap<int, int, 10> s = []()
+    {
+        FixedMap<int, int, 10> s1{};
+        s1.try_emplace(s1.cend(), 2, 20);
+        s1.try_emplace(s1.cend(), 2, 21);
+        const int key = 4;
+        s1.try_emplace(s1.cend(), key, 40);
+        s1.insert_or_assign(s1.cbegin(), 1, 10);
+        s1.insert_or_assign(s1.cbegin(), 1, 11);
+        s1.insert_or_assign(s1.cend(), key, 41);
+        return s1;
+    }();
+
+    static_assert(consteval_compare::equal<3, s.size()>);
+    static_assert(s.at(1) == 11);
+    static_assert(s.at(2) == 20);
+    static_assert(s.at(4) == 41);
+}
+
 TEST(FixedMap, Clear)
 {
     constexpr auto s1 = []()
@@ -561,6 +912,55 @@ TEST(FixedMap, Clear)
     static_assert(s1.empty());
 }
 
+TEST(FixedMap, ClearAndRefill)
+{
+    // Slots are handed out in order again after a clear, however the map was churned before
+    constexpr auto s1 = []()
+    {
+        FixedMap<int, int, 10> s{{2, 20}, {4, 40}, {6, 60}};
+        s.erase(2);
+        s.clear();
+        s.try_emplace(1, 10);
+        s.try_emplace(3, 30);
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(1) == 10);
+    static_assert(s1.at(3) == 30);
+    static_assert(s1.fragmentation() == 0);
+
+    {
+        auto s = std::make_unique<FixedMap<int, int, 4096>>();
+        for (int i = 0; i < 1000; i++)
+        {
+            s->try_emplace(1000 - i, i);
+        }
+        s->clear();
+        ASSERT_TRUE(s->empty());
+        for (int i = 0; i < 4096; i++)
+        {
+            s->try_emplace(i, i);
+        }
+        ASSERT_EQ(4096, s->size());
+        ASSERT_EQ(0, s->fragmentation());
+        ASSERT_EQ(4095, s->at(4095));
+    }
+
+    // Entries that need to be destroyed take the slow path
+    {
+        FixedMap<int, std::string, 8> s{{1, "a"}, {2, "b"}, {3, "c"}};
+        s.clear();
+        ASSERT_TRUE(s.empty());
+        for (int i = 0; i < 8; i++)
+        {
+            s.try_emplace(i, std::string(64, 'x'));
+        }
+        ASSERT_EQ(8, s.size());
+        ASSERT_EQ(std::string(64, 'x'), s.at(7));
+    }
+}
+
 TEST(FixedMap, Erase)
 {
     constexpr auto s1 = []()
@@ -677,6 +1077,70 @@ TEST(FixedMap, EraseRange)
     }
 }
 
+TEST(FixedMap, EraseRange_ExpiryWindow)
+{
+    // Timestamp-keyed entries, where everything older than a window is evicted at once
+    const auto equal_to_reference = [](const auto& map, const std::map<int, int>& reference)
+    {
+        return std::ranges::equal(map,
+                                  reference,
+                                  [](const auto& entry, const auto& reference_entry)
+                                  {
+                                      return entry.first == reference_entry.first &&
+                                             entry.second == reference_entry.second;
+                                  });
+    };
+    const auto check = [&equal_to_reference](auto& map)
+    {
+        std::mt19937 random_engine{3};
+        std::uniform_int_distribution<int> delay_distribution{0, 40};
+        std::map<int, int> reference{};
+        for (int now = 0; now < 2000; now++)
+        {
+            const int timestamp = now + delay_distribution(random_engine);
+            map.try_emplace(timestamp, now);
+            reference.try_emplace(timestamp, now);
+            if (now % 16 == 0)
+            {
+                const auto next = map.erase(map.begin(), map.lower_bound(now - 20));
+                const auto reference_next =
+                    reference.erase(reference.begin(), reference.lower_bound(now - 20));
+                ASSERT_EQ(reference_next == reference.end(), next == map.end());
+                if (next != map.end())
+                {
+                    ASSERT_EQ(reference_next->first, next->first);
+                }
+                ASSERT_TRUE(equal_to_reference(map, reference));
+            }
+        }
+
+        // A window in the middle
+        map.erase(map.lower_bound(2000), map.lower_bound(2020));
+        reference.erase(reference.lower_bound(2000), reference.lower_bound(2020));
+        ASSERT_TRUE(equal_to_reference(map, reference));
+    };
+
+    FixedMap<int, int, 128> pool_map{};
+    check(pool_map);
+    FixedMap<int,
+             int,
+             128,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedContiguousStorage>
+        contiguous_map{};
+    check(contiguous_map);
+    FixedMap<int,
+             int,
+             128,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedOrderStatisticPoolStorage>
+        order_statistic_map{};
+    check(order_statistic_map);
+    ASSERT_EQ(order_statistic_map.size(), order_statistic_map.rank_of(3000));
+}
+
 TEST(FixedMap, EraseIf)
 {
     constexpr auto s1 = []()
@@ -1162,6 +1626,95 @@ TEST(FixedMap, Contains_TransparentComparator)
     static_assert(s.contains(b));
 }
 
+TEST(FixedMap, FindBatch)
+{
+    static constexpr FixedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    static_assert(
+        []()
+        {
+            constexpr std::array<int, 4> KEYS{4, 1, 2, 3};
+            std::array<FixedMap<int, int, 10>::const_iterator, 4> out{};
+            s1.find_batch(KEYS, out);
+            return out[0]->second == 40 && out[1] == s1.cend() && out[2]->second == 20 &&
+                   out[3] == s1.cend();
+        }());
+
+    constexpr auto s2 = []()
+    {
+        FixedMap<int, int, 10> s{{2, 20}, {4, 40}};
+        const std::array<int, 2> keys{2, 4};
+        std::array<FixedMap<int, int, 10>::iterator, 2> out{};
+        s.find_batch(keys, out);
+        out[0]->second = 25;
+        out[1]->second = 45;
+        return s;
+    }();
+    static_assert(s2.at(2) == 25);
+    static_assert(s2.at(4) == 45);
+}
+
+TEST(FixedMap, FindBatch_MatchesFind)
+{
+    // More keys than descents in flight, on both index-based storages
+    const auto check = [](auto& map)
+    {
+        std::vector<int> keys(100);
+        std::iota(keys.begin(), keys.end(), -20);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937{11});
+        for (const int key : keys)
+        {
+            if (key % 3 != 0)
+            {
+                map.try_emplace(key, key * 10);
+            }
+        }
+
+        using ConstIterator = typename std::remove_reference_t<decltype(map)>::const_iterator;
+        std::vector<ConstIterator> out(keys.size());
+        std::as_const(map).find_batch(keys, out);
+        std::array<bool, 100> contained_out{};
+        map.contains_batch(keys, contained_out);
+        for (std::size_t j = 0; j < keys.size(); j++)
+        {
+            ASSERT_EQ(std::as_const(map).find(keys[j]), out[j]);
+            ASSERT_EQ(map.contains(keys[j]), contained_out[j]);
+        }
+    };
+
+    FixedMap<int, int, 100> pool_map{};
+    check(pool_map);
+    FixedMap<int,
+             int,
+             100,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedContiguousStorage>
+        contiguous_map{};
+    check(contiguous_map);
+
+    const FixedMap<int, int, 10> empty_map{};
+    const std::array<int, 2> keys{1, 2};
+    std::array<bool, 2> contained{true, true};
+    empty_map.contains_batch(keys, contained);
+    EXPECT_FALSE(contained[0]);
+    EXPECT_FALSE(contained[1]);
+}
+
+TEST(FixedMap, FindBatch_TransparentComparator)
+{
+    static constexpr FixedMap<MockAComparableToB, int, 5, std::less<>> s{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    static_assert(
+        []()
+        {
+            constexpr std::array<MockBComparableToA, 2> KEYS{MockBComparableToA{3},
+                                                             MockBComparableToA{4}};
+            std::array<bool, 2> out{};
+            s.contains_batch(std::span<const MockBComparableToA>{KEYS}, out);
+            return out[0] && !out[1];
+        }());
+}
+
 TEST(FixedMap, Count)
 {
     constexpr FixedMap<int, int, 10> s1{{2, 20}, {4, 40}};
@@ -1333,6 +1886,408 @@ TEST(FixedMap, NonAssignable)
     }
 }
 
+namespace
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+using SplitPoolFixedMap =
+    FixedMap<K,
+             V,
+             MAXIMUM_SIZE,
+             std::less<K>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedSplitPoolStorage>;
+static_assert(TriviallyCopyable<SplitPoolFixedMap<int, int, 10>>);
+static_assert(IsStructuralType<SplitPoolFixedMap<int, int, 10>>);
+static_assert(NotTriviallyCopyable<SplitPoolFixedMap<int, std::string, 10>>);
+}  // namespace
+
+TEST(FixedMap, SplitPoolStorage)
+{
+    {
+        constexpr auto s1 = []()
+        {
+            SplitPoolFixedMap<int, int, 10> s{{2, 20}, {4, 40}};
+            s[1] = 10;
+            s.try_emplace(3, 30);
+            s.insert_or_assign(4, 44);
+            s.erase(2);
+            return s;
+        }();
+
+        static_assert(s1.size() == 3);
+        static_assert(s1.at(1) == 10);
+        static_assert(!s1.contains(2));
+        static_assert(s1.at(3) == 30);
+        static_assert(s1.at(4) == 44);
+        static_assert(s1.begin()->first == 1);
+        static_assert(s1.rbegin()->second == 44);
+    }
+
+    {
+        // Erasing nodes with two children swaps nodes structurally, so values must stay put
+        std::mt19937 random_engine{3};
+        std::uniform_int_distribution<int> distribution{0, 63};
+        SplitPoolFixedMap<int, std::string, 64> s{};
+        std::map<int, std::string> reference{};
+        for (int step = 0; step < 2000; step++)
+        {
+            const int key = distribution(random_engine);
+            if (step % 3 != 2)
+            {
+                s.try_emplace(key, std::string(32, static_cast<char>('a' + (key % 26))));
+                reference.try_emplace(key, std::string(32, static_cast<char>('a' + (key % 26))));
+            }
+            else
+            {
+                ASSERT_EQ(reference.erase(key), s.erase(key));
+            }
+        }
+        ASSERT_TRUE(std::ranges::equal(reference,
+                                       s,
+                                       [](const auto& a, const auto& b)
+                                       { return a.first == b.first && a.second == b.second; }));
+
+        auto s_copy = s;
+        ASSERT_EQ(s, s_copy);
+        const auto s_moved = std::move(s_copy);
+        ASSERT_EQ(s, s_moved);
+    }
+}
+
+namespace
+{
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS =
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR>
+using OrderStatisticFixedMap =
+    FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, FixedIndexBasedOrderStatisticPoolStorage>;
+static_assert(TriviallyCopyable<OrderStatisticFixedMap<int, int, 10>>);
+static_assert(IsStructuralType<OrderStatisticFixedMap<int, int, 10>>);
+
+template <class MapType>
+void check_order_statistics(const MapType& map, const std::map<int, int>& reference)
+{
+    ASSERT_EQ(reference.size(), map.size());
+    for (std::size_t n = 0; n <= reference.size(); n++)
+    {
+        const auto it = map.nth(n);
+        if (n == reference.size())
+        {
+            ASSERT_EQ(map.end(), it);
+            continue;
+        }
+        const auto expected = std::next(reference.begin(), static_cast<std::ptrdiff_t>(n));
+        ASSERT_EQ(expected->first, it->first);
+        ASSERT_EQ(expected->second, it->second);
+    }
+    for (int key = -2; key <= 66; key++)
+    {
+        ASSERT_EQ(std::distance(reference.begin(), reference.lower_bound(key)),
+                  static_cast<std::ptrdiff_t>(map.rank_of(key)));
+    }
+}
+}  // namespace
+
+TEST(FixedMap, OrderStatistics)
+{
+    {
+        constexpr auto s1 = []()
+        {
+            OrderStatisticFixedMap<int, int, 10> s{{20, 200}, {40, 400}, {10, 100}};
+            s[30] = 300;
+            s.erase(20);
+            return s;
+        }();
+
+        static_assert(s1.size() == 3);
+        static_assert(s1.nth(0)->first == 10);
+        static_assert(s1.nth(1)->first == 30);
+        static_assert(s1.nth(2)->second == 400);
+        static_assert(s1.nth(3) == s1.end());
+        static_assert(s1.rank_of(5) == 0);
+        static_assert(s1.rank_of(10) == 0);
+        static_assert(s1.rank_of(11) == 1);
+        static_assert(s1.rank_of(40) == 2);
+        static_assert(s1.rank_of(41) == 3);
+        static_assert(s1.count_in_range(10, 40) == 2);
+        static_assert(s1.count_in_range(0, 100) == 3);
+        static_assert(s1.count_in_range(11, 30) == 0);
+        static_assert(s1.count_in_range(40, 10) == 0);
+    }
+
+    {
+        auto s = OrderStatisticFixedMap<int, int, 10>::from_sorted_unique(
+            {{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}, {6, 60}});
+        s.nth(4)->second = 55;
+        EXPECT_EQ(55, s.at(5));
+        EXPECT_EQ(3, s.rank_of(4));
+        EXPECT_EQ(4, s.count_in_range(2, 6));
+        s.erase(s.nth(1), s.nth(4));
+        EXPECT_EQ(3, s.size());
+        EXPECT_EQ(5, s.nth(1)->first);
+        EXPECT_EQ(2, s.rank_of(6));
+    }
+}
+
+TEST(FixedMap, OrderStatistics_MatchStdMap)
+{
+    // Every kind of insertion and deletion, including rebalancing and structural swaps of nodes
+    // with two children, must keep the subtree sizes up to date.
+    const auto check = [](auto& map)
+    {
+        std::mt19937 random_engine{5};
+        std::uniform_int_distribution<int> distribution{0, 63};
+        std::map<int, int> reference{};
+        for (int step = 0; step < 1500; step++)
+        {
+            const int key = distribution(random_engine);
+            if (step % 5 < 3)
+            {
+                map.try_emplace(key, key * 10);
+                reference.try_emplace(key, key * 10);
+            }
+            else
+            {
+                ASSERT_EQ(reference.erase(key), map.erase(key));
+            }
+            if (step % 50 == 0)
+            {
+                check_order_statistics(map, reference);
+            }
+        }
+        check_order_statistics(map, reference);
+
+        map.clear();
+        reference.clear();
+        check_order_statistics(map, reference);
+    };
+
+    OrderStatisticFixedMap<int, int, 64> compact_map{};
+    check(compact_map);
+    OrderStatisticFixedMap<int,
+                           int,
+                           64,
+                           std::less<int>,
+                           fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::
+                               DEDICATED_COLOR>
+        dedicated_color_map{};
+    check(dedicated_color_map);
+}
+
+TEST(FixedMap, OrderStatistics_TransparentComparator)
+{
+    constexpr OrderStatisticFixedMap<MockAComparableToB, int, 5, std::less<>> s{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    static_assert(s.rank_of(MockBComparableToA{4}) == 2);
+    static_assert(s.count_in_range(MockBComparableToA{2}, MockBComparableToA{5}) == 1);
+}
+
+TEST(FixedMap, SetAlgebra)
+{
+    static constexpr FixedMap<int, int, 10> S1{{1, 10}, {3, 30}, {5, 50}};
+    static constexpr FixedMap<int, int, 10> S2{{3, 33}, {4, 44}};
+
+    // Entries come from the first map, unless they are only in the second one
+    constexpr auto UNION = set_union(S1, S2);
+    static_assert(UNION == FixedMap<int, int, 10>{{1, 10}, {3, 30}, {4, 44}, {5, 50}});
+    constexpr auto INTERSECTION = set_intersection(S1, S2);
+    static_assert(INTERSECTION == FixedMap<int, int, 10>{{3, 30}});
+    constexpr auto DIFFERENCE = set_difference(S1, S2);
+    static_assert(DIFFERENCE == FixedMap<int, int, 10>{{1, 10}, {5, 50}});
+}
+
+TEST(FixedMap, Merge)
+{
+    const auto check = [](auto a, auto b)
+    {
+        std::mt19937 random_engine{29};
+        std::uniform_int_distribution<int> distribution{0, 99};
+        std::map<int, std::string> expected_a{};
+        std::map<int, std::string> expected_b{};
+        for (int j = 0; j < 50; j++)
+        {
+            const int key_a = distribution(random_engine);
+            const int key_b = distribution(random_engine);
+            a.try_emplace(key_a, std::string(20, 'a'));
+            b.try_emplace(key_b, std::string(20, 'b'));
+            expected_a.try_emplace(key_a, std::string(20, 'a'));
+            expected_b.try_emplace(key_b, std::string(20, 'b'));
+        }
+        for (int key = 0; key < 100; key += 7)
+        {
+            a.erase(key);
+            b.erase(key);
+            expected_a.erase(key);
+            expected_b.erase(key);
+        }
+
+        a.merge(b);
+        expected_a.merge(expected_b);
+        const auto entries_equal = [](const auto& x, const auto& y)
+        { return x.first == y.first && x.second == y.second; };
+        ASSERT_TRUE(std::ranges::equal(expected_a, a, entries_equal));
+        ASSERT_TRUE(std::ranges::equal(expected_b, b, entries_equal));
+
+        for (int key = 0; key < 100; key += 3)
+        {
+            ASSERT_EQ(expected_a.erase(key), a.erase(key));
+            ASSERT_EQ(expected_b.try_emplace(key, "c").second, b.try_emplace(key, "c").second);
+        }
+        ASSERT_TRUE(std::ranges::equal(expected_a, a, entries_equal));
+        ASSERT_TRUE(std::ranges::equal(expected_b, b, entries_equal));
+    };
+
+    check(FixedMap<int, std::string, 128>{}, FixedMap<int, std::string, 128>{});
+    using ContiguousFixedMap =
+        FixedMap<int,
+                 std::string,
+                 128,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedContiguousStorage>;
+    check(ContiguousFixedMap{}, ContiguousFixedMap{});
+    check(SplitPoolFixedMap<int, std::string, 128>{}, SplitPoolFixedMap<int, std::string, 128>{});
+}
+
+TEST(FixedMap, Merge_ExceedsCapacity)
+{
+    FixedMap<int, int, 3> s1{{1, 10}, {2, 20}};
+    FixedMap<int, int, 3> s2{{3, 30}, {4, 40}};
+    EXPECT_DEATH(s1.merge(s2), "");
+}
+
+TEST(FixedMap, Extract)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMap<int, int, 10> a{{1, 10}, {3, 30}, {5, 50}};
+        FixedMap<int, int, 10> b{};
+        b.insert(a.extract(a.find(3)));
+        const std::optional<std::pair<const int, int>> extracted = a.extract(5);
+        const std::optional<std::pair<const int, int>> missing = a.extract(7);
+        b.insert(extracted.value_or(std::pair{-1, -1}));
+        b.insert(missing.value_or(std::pair{-2, -2}));
+        return std::pair{a, b};
+    }();
+    static_assert(s1.first == FixedMap<int, int, 10>{{1, 10}});
+    static_assert(s1.second == FixedMap<int, int, 10>{{-2, -2}, {3, 30}, {5, 50}});
+
+    FixedMap<int, std::string, 10> s2{{1, std::string(30, 'x')}};
+    const auto entry = s2.extract(s2.begin());
+    EXPECT_EQ(std::string(30, 'x'), entry.second);
+    EXPECT_TRUE(s2.empty());
+}
+
+TEST(FixedMap, CompactInOrder)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMap<int, int, 10> s{{5, 50}, {1, 10}, {9, 90}, {3, 30}, {7, 70}};
+        s.erase(1);
+        s.erase(7);
+        s.try_emplace(8, 80);
+        s.try_emplace(2, 20);
+        assert_or_abort(s.fragmentation() > 0);
+        s.compact_in_order();
+        return s;
+    }();
+    static_assert(s1.fragmentation() == 0);
+    static_assert(s1 == FixedMap<int, int, 10>{{2, 20}, {3, 30}, {5, 50}, {8, 80}, {9, 90}});
+
+    // After churn, compact a few entries at a time
+    const auto check = [](auto& map)
+    {
+        std::mt19937 random_engine{9};
+        std::uniform_int_distribution<int> distribution{0, 255};
+        for (int step = 0; step < 2000; step++)
+        {
+            const int key = distribution(random_engine);
+            if (step % 3 == 2)
+            {
+                map.erase(key);
+            }
+            else
+            {
+                map.try_emplace(key, std::to_string(key));
+            }
+        }
+        ASSERT_LT(0, map.fragmentation());
+
+        std::map<int, std::string> reference{};
+        for (const auto& [key, value] : map)
+        {
+            reference.try_emplace(key, value);
+        }
+        const auto equal_to_reference = [&map, &reference]()
+        {
+            return std::ranges::equal(map,
+                                      reference,
+                                      [](const auto& entry, const auto& reference_entry)
+                                      {
+                                          return entry.first == reference_entry.first &&
+                                                 entry.second == reference_entry.second;
+                                      });
+        };
+
+        std::size_t calls = 1;
+        while (!map.compact_in_order(8))
+        {
+            ASSERT_TRUE(equal_to_reference());
+            calls++;
+        }
+        ASSERT_LT(1, calls);
+        ASSERT_TRUE(equal_to_reference());
+        ASSERT_EQ(0, map.fragmentation());
+        ASSERT_TRUE(map.compact_in_order(0));
+
+        // Iteration walks the storage linearly
+        for (auto it = map.begin(); std::next(it) != map.end(); ++it)
+        {
+            ASSERT_LT(std::addressof(it->first), std::addressof(std::next(it)->first));
+        }
+
+        // The free list is still valid
+        for (int key = 0; key < 256; key++)
+        {
+            map.try_emplace(key, std::to_string(key));
+        }
+        ASSERT_EQ(256, map.size());
+        ASSERT_TRUE(std::ranges::all_of(
+            map, [](const auto& entry) { return std::to_string(entry.first) == entry.second; }));
+    };
+
+    FixedMap<int, std::string, 256> pool_map{};
+    check(pool_map);
+    FixedMap<int,
+             std::string,
+             256,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedSplitPoolStorage>
+        split_map{};
+    check(split_map);
+    FixedMap<int,
+             std::string,
+             256,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+             FixedIndexBasedOrderStatisticPoolStorage>
+        order_statistic_map{};
+    check(order_statistic_map);
+    ASSERT_EQ(100, order_statistic_map.nth(100)->first);
+    FixedMap<int,
+             std::string,
+             256,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedContiguousStorage>
+        contiguous_map{};
+    check(contiguous_map);
+}
+
 static constexpr int INT_VALUE_10 = 10;
 static constexpr int INT_VALUE_20 = 20;
 static constexpr int INT_VALUE_30 = 30;
@@ -0,0 +1,197 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using QueueType = FixedMpmcQueue<int, 8>;
+static_assert(TriviallyDestructible<QueueType>);
+static_assert(NotCopyConstructible<QueueType>);
+static_assert(NotMoveAssignable<QueueType>);
+static_assert(NotTriviallyDestructible<FixedMpmcQueue<MockNonTrivialDestructible, 8>>);
+
+// Constant initialization: no dynamic initializer runs for this global
+constinit QueueType GLOBAL_QUEUE{};
+}  // namespace
+
+TEST(FixedMpmcQueue, DefaultConstructor)
+{
+    const QueueType q{};
+    EXPECT_TRUE(q.empty());
+    static_assert(QueueType::capacity() == 8);
+
+    EXPECT_TRUE(GLOBAL_QUEUE.try_push(5));
+    EXPECT_EQ(5, GLOBAL_QUEUE.try_pop());
+}
+
+TEST(FixedMpmcQueue, PushAndPop)
+{
+    QueueType q{};
+    EXPECT_TRUE(q.try_push(1));
+    const int value = 2;
+    EXPECT_TRUE(q.try_push(value));
+    EXPECT_TRUE(q.try_emplace(3));
+    EXPECT_EQ(3, q.size());
+
+    EXPECT_EQ(1, q.try_pop());
+    EXPECT_EQ(2, q.try_pop());
+    EXPECT_EQ(3, q.try_pop());
+    EXPECT_EQ(std::nullopt, q.try_pop());
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(FixedMpmcQueue, Full)
+{
+    QueueType q{};
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(8));
+
+    EXPECT_EQ(0, q.try_pop());
+    EXPECT_TRUE(q.try_push(8));
+    EXPECT_FALSE(q.try_push(9));
+}
+
+TEST(FixedMpmcQueue, WrapAroundWithNonPowerOfTwoCapacity)
+{
+    FixedMpmcQueue<int, 5> q{};
+    int next_push = 0;
+    int next_pop = 0;
+    for (int round = 0; round < 20; round++)
+    {
+        while (q.try_push(next_push))
+        {
+            next_push++;
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(next_pop, q.try_pop());
+            next_pop++;
+        }
+    }
+    EXPECT_EQ(next_push - next_pop, static_cast<int>(q.size()));
+}
+
+TEST(FixedMpmcQueue, SmallestCapacity)
+{
+    FixedMpmcQueue<int, 2> q{};
+    for (int round = 0; round < 5; round++)
+    {
+        EXPECT_TRUE(q.try_push(2 * round));
+        EXPECT_TRUE(q.try_push(2 * round + 1));
+        EXPECT_FALSE(q.try_push(-1));
+        EXPECT_EQ(2, q.size());
+
+        EXPECT_EQ(2 * round, q.try_pop());
+        EXPECT_EQ(2 * round + 1, q.try_pop());
+        EXPECT_EQ(std::nullopt, q.try_pop());
+        EXPECT_TRUE(q.empty());
+    }
+}
+
+TEST(FixedMpmcQueue, NonTrivialElements)
+{
+    FixedMpmcQueue<std::string, 3> q{};
+    EXPECT_TRUE(q.try_push(std::string(100, 'a')));
+    EXPECT_TRUE(q.try_emplace(3, 'b'));
+    EXPECT_EQ(std::string(100, 'a'), q.try_pop());
+    EXPECT_EQ("bbb", q.try_pop());
+}
+
+namespace
+{
+struct FixedMpmcQueueInstanceCounterUniquenessToken
+{
+};
+
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedMpmcQueueInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedMpmcQueue, DestroysRemainingElements)
+{
+    using T = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, T::counter);
+    {
+        FixedMpmcQueue<T, 4> q{};
+        for (int i = 0; i < 4; i++)
+        {
+            ASSERT_TRUE(q.try_emplace(i));
+        }
+        ASSERT_EQ(4, T::counter);
+        (void)q.try_pop();
+        ASSERT_EQ(3, T::counter);
+        ASSERT_TRUE(q.try_emplace(4));
+        ASSERT_EQ(4, T::counter);
+    }
+    ASSERT_EQ(0, T::counter);
+}
+
+TEST(FixedMpmcQueue, ManyProducersAndConsumers)
+{
+    static constexpr std::size_t THREAD_COUNT = 4;
+    static constexpr std::uint64_t COUNT_PER_PRODUCER = 20'000;
+    FixedMpmcQueue<std::uint64_t, 16> q{};
+    std::atomic<std::uint64_t> popped_count{0};
+    std::atomic<std::uint64_t> popped_sum{0};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back(
+            [&q, t]()
+            {
+                for (std::uint64_t i = 0; i < COUNT_PER_PRODUCER; i++)
+                {
+                    while (!q.try_push(t * COUNT_PER_PRODUCER + i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        threads.emplace_back(
+            [&q, &popped_count, &popped_sum]()
+            {
+                while (popped_count.load() < THREAD_COUNT * COUNT_PER_PRODUCER)
+                {
+                    if (const auto v = q.try_pop(); v.has_value())
+                    {
+                        popped_sum += *v;
+                        popped_count++;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    static constexpr std::uint64_t TOTAL = THREAD_COUNT * COUNT_PER_PRODUCER;
+    EXPECT_EQ(TOTAL, popped_count.load());
+    EXPECT_EQ(TOTAL * (TOTAL - 1) / 2, popped_sum.load());
+    EXPECT_TRUE(q.empty());
+}
+
+}  // namespace fixed_containers
@@ -8,17 +8,25 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <map>
 #include <queue>
 #include <random>
+#include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
 namespace
 {
+constexpr auto EMBEDDED_COLOR = RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+constexpr auto DEDICATED_COLOR = RedBlackTreeNodeColorCompactness::DEDICATED_COLOR;
+
 static_assert(IsStructuralType<FixedIndexBasedPoolStorage<int, 5>>);
 static_assert(IsStructuralType<FixedIndexBasedContiguousStorage<int, 5>>);
 
-static_assert(IsStructuralType<NodeIndexWithColorEmbeddedInTheMostSignificantBit>);
+static_assert(IsStructuralType<NodeIndexWithColorEmbeddedInTheMostSignificantBit<>>);
+static_assert(IsStructuralType<NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint8_t>>);
+static_assert(sizeof(NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint16_t>) == 2);
 
 static_assert(IsRedBlackTreeNode<DefaultRedBlackTreeNode<int, EmptyValue>>);
 static_assert(IsRedBlackTreeNodeWithValue<DefaultRedBlackTreeNode<int, double>>);
@@ -33,6 +41,16 @@ static_assert(IsStructuralType<CompactRedBlackTreeNode<int, int>, 5, 99>);
 static_assert(
     IsRedBlackTreeNodeWithValue<RedBlackTreeNodeView<CompactRedBlackTreeNode<int, EmptyValue>>>);
 
+// Links are as narrow as MAXIMUM_SIZE allows
+static_assert(std::is_same_v<std::uint8_t, NodeIndexStorageType<127, EMBEDDED_COLOR>>);
+static_assert(std::is_same_v<std::uint16_t, NodeIndexStorageType<128, EMBEDDED_COLOR>>);
+static_assert(std::is_same_v<std::uint8_t, NodeIndexStorageType<255, DEDICATED_COLOR>>);
+static_assert(std::is_same_v<std::uint16_t, NodeIndexStorageType<256, DEDICATED_COLOR>>);
+static_assert(sizeof(CompactRedBlackTreeNode<int, EmptyValue, std::uint8_t>) == 8);
+static_assert(sizeof(DefaultRedBlackTreeNode<int, EmptyValue, std::uint8_t>) == 8);
+static_assert(sizeof(CompactRedBlackTreeNode<int, EmptyValue, std::uint16_t>) == 12);
+static_assert(sizeof(CompactRedBlackTreeNode<int, EmptyValue>) == 32);
+
 using Storage_1 = FixedRedBlackTreeStorage<int,
                                            double,
                                            10,
@@ -187,6 +205,64 @@ std::size_t find_height(const TreeStorageType& tree_storage)
     return find_height(tree_storage, tree_storage.root_index());
 }
 
+// Returns the number of black nodes on every path from `i` down to a leaf, or NULL_INDEX if any
+// red-black/binary-search-tree invariant is violated in that subtree.
+template <class TreeType>
+NodeIndex validated_black_height(const TreeType& tree, const NodeIndex& i)
+{
+    if (i == NULL_INDEX)
+    {
+        return 1;
+    }
+
+    const auto node = tree.node_at(i);
+    for (const NodeIndex child : {node.left_index(), node.right_index()})
+    {
+        if (child == NULL_INDEX)
+        {
+            continue;
+        }
+        if (tree.node_at(child).parent_index() != i)
+        {
+            return NULL_INDEX;
+        }
+        if (node.color() == COLOR_RED && tree.node_at(child).color() == COLOR_RED)
+        {
+            return NULL_INDEX;
+        }
+    }
+    if (node.left_index() != NULL_INDEX && !(tree.node_at(node.left_index()).key() < node.key()))
+    {
+        return NULL_INDEX;
+    }
+    if (node.right_index() != NULL_INDEX && !(node.key() < tree.node_at(node.right_index()).key()))
+    {
+        return NULL_INDEX;
+    }
+
+    const NodeIndex left_height = validated_black_height(tree, node.left_index());
+    const NodeIndex right_height = validated_black_height(tree, node.right_index());
+    if (left_height == NULL_INDEX || left_height != right_height)
+    {
+        return NULL_INDEX;
+    }
+
+    return left_height + (node.color() == COLOR_BLACK ? 1 : 0);
+}
+
+template <class TreeType>
+bool is_valid_red_black_tree(const TreeType& tree)
+{
+    if (tree.root_index() == NULL_INDEX)
+    {
+        return tree.empty();
+    }
+
+    return tree.node_at(tree.root_index()).color() == COLOR_BLACK &&
+           tree.node_at(tree.root_index()).parent_index() == NULL_INDEX &&
+           validated_black_height(tree, tree.root_index()) != NULL_INDEX;
+}
+
 std::size_t max_height_of_red_black_tree(const std::size_t size)
 {
     // https://stackoverflow.com/questions/43529279/how-to-create-red-black-tree-with-max-height
@@ -278,6 +354,45 @@ TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, Basic)
     }
 }
 
+TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, NarrowIndexType)
+{
+    using IndexAndColor = NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint8_t>;
+    {
+        constexpr IndexAndColor default_value{};
+        static_assert(consteval_compare::equal<NULL_INDEX, default_value.get_index()>);
+        static_assert(consteval_compare::equal<COLOR_BLACK, default_value.get_color()>);
+    }
+
+    {
+        constexpr auto set_value_with_red = []()
+        {
+            IndexAndColor ret{};
+            ret.set_index(126);
+            ret.set_color(COLOR_RED);
+            return ret;
+        }();
+
+        static_assert(consteval_compare::equal<126, set_value_with_red.get_index()>);
+        static_assert(consteval_compare::equal<COLOR_RED, set_value_with_red.get_color()>);
+    }
+
+    {
+        constexpr auto set_null_with_red = []()
+        {
+            IndexAndColor ret{};
+            ret.set_color(COLOR_RED);
+            ret.set_index(NULL_INDEX);
+            return ret;
+        }();
+
+        static_assert(consteval_compare::equal<NULL_INDEX, set_null_with_red.get_index()>);
+        static_assert(consteval_compare::equal<COLOR_RED, set_null_with_red.get_color()>);
+    }
+
+    IndexAndColor ret{};
+    EXPECT_DEATH(ret.set_index(128), "");
+}
+
 TEST(DefaultRedBlackTreeNode, Construction)
 {
     // Without Value
@@ -931,6 +1046,25 @@ TEST(FixedRedBlackTree, SwapNodes)
         ASSERT_TRUE(are_equal(original_bst.node_at(2), bst.node_at(2)));
     }
 
+    // Swap non-neighbors #2, with the left child first
+    {
+        /*
+         *               17B
+         *             /    \
+         *           15R      19R
+         */
+        auto bst = get_new_swap_test_base_tree();
+        Ops::swap_nodes_including_key_and_value(bst, 2, 1);
+        //        bst[17] = 170;  // Position 0
+        //        bst[15] = 150;  // Position 1
+        //        bst[19] = 190;  // Position 2
+        ASSERT_TRUE(are_equal(make_node(17, 170, NULL_INDEX, 1, 2, COLOR_BLACK), bst.node_at(0)));
+        ASSERT_TRUE(
+            are_equal(make_node(15, 150, 0, NULL_INDEX, NULL_INDEX, COLOR_RED), bst.node_at(1)));
+        ASSERT_TRUE(
+            are_equal(make_node(19, 190, 0, NULL_INDEX, NULL_INDEX, COLOR_RED), bst.node_at(2)));
+    }
+
     // Swap left-child/parent
     {
         /*
@@ -1795,6 +1929,290 @@ TEST(FixedRedBlackTree, RandomizedConsistencyTest)
     }
 }
 
+template <std::size_t MAXIMUM_SIZE>
+static void randomized_consistency_test_with_capacity()
+{
+    FixedRedBlackTree<int, int, MAXIMUM_SIZE> bst{};
+
+    std::array<int, MAXIMUM_SIZE> insertion_order{};
+    std::array<int, MAXIMUM_SIZE> deletion_order{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        insertion_order[i] = static_cast<int>(i);
+        deletion_order[i] = static_cast<int>(i);
+    }
+
+    std::mt19937 g(42);
+    std::shuffle(insertion_order.begin(), insertion_order.end(), g);
+    std::shuffle(deletion_order.begin(), deletion_order.end(), g);
+    consistency_test_helper(insertion_order, deletion_order, bst);
+}
+
+TEST(FixedRedBlackTree, NarrowNodeIndexCapacityBoundaries)
+{
+    // The largest capacity that still fits uint8_t links, and the smallest that needs uint16_t
+    randomized_consistency_test_with_capacity<127>();
+    randomized_consistency_test_with_capacity<128>();
+}
+
+TEST(FixedRedBlackTree, BuildFromSortedUnique)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 70;
+    std::array<int, MAXIMUM_SIZE> sorted{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        sorted[i] = static_cast<int>(i * 2);
+    }
+
+    for (std::size_t count = 0; count <= MAXIMUM_SIZE; count++)
+    {
+        FixedRedBlackTree<int, int, MAXIMUM_SIZE> bst{};
+        std::array<std::pair<int, int>, MAXIMUM_SIZE> entries{};
+        for (std::size_t i = 0; i < count; i++)
+        {
+            entries[i] = {sorted[i], sorted[i] + 1};
+        }
+        bst.build_from_sorted_unique(entries.begin(), count);
+
+        ASSERT_EQ(count, bst.size());
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+        ASSERT_LE(find_height(bst), max_height_of_red_black_tree(bst.size()));
+
+        // Nodes are laid out in iteration order
+        NodeIndex i = bst.index_of_min_at();
+        for (std::size_t position = 0; position < count; position++)
+        {
+            ASSERT_EQ(position, i);
+            ASSERT_EQ(sorted[position], bst.node_at(i).key());
+            ASSERT_EQ(sorted[position] + 1, bst.node_at(i).value());
+            i = bst.index_of_successor_at(i);
+        }
+        ASSERT_EQ(NULL_INDEX, i);
+
+        // The tree must stay consistent under further mutation
+        for (std::size_t k = 0; k < count; k += 2)
+        {
+            bst.delete_node(sorted[k]);
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+        }
+        for (std::size_t k = 0; k < count; k += 2)
+        {
+            bst[sorted[k] + 1] = 0;
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+        }
+    }
+}
+
+namespace
+{
+template <class TreeType>
+void merge_consistency_test_helper()
+{
+    std::mt19937 g(7);
+    std::uniform_int_distribution<int> key_distribution{0, 99};
+    for (std::size_t round = 0; round < 20; round++)
+    {
+        TreeType a{};
+        TreeType b{};
+        std::map<int, int> expected_a{};
+        std::map<int, int> expected_b{};
+        for (std::size_t j = 0; j < round * 3; j++)
+        {
+            const int key_a = key_distribution(g);
+            const int key_b = key_distribution(g);
+            a[key_a] = key_a;
+            b[key_b] = -key_b;
+            expected_a.try_emplace(key_a, key_a);
+            expected_b.try_emplace(key_b, -key_b);
+        }
+        // Leave gaps in the storage
+        for (int key = 0; key < 100; key += 5)
+        {
+            a.delete_node(key);
+            b.delete_node(key);
+            expected_a.erase(key);
+            expected_b.erase(key);
+        }
+
+        TreeType intersection{};
+        ASSERT_TRUE(intersection.assign_merged(a, b, SortedMergeKind::INTERSECTION));
+        ASSERT_TRUE(is_valid_red_black_tree(intersection));
+        TreeType difference{};
+        ASSERT_TRUE(difference.assign_merged(a, b, SortedMergeKind::DIFFERENCE));
+        ASSERT_TRUE(is_valid_red_black_tree(difference));
+        TreeType union_of_both{};
+        ASSERT_TRUE(union_of_both.assign_merged(a, b, SortedMergeKind::UNION));
+        ASSERT_TRUE(is_valid_red_black_tree(union_of_both));
+        ASSERT_EQ(difference.size() + b.size(), union_of_both.size());
+        ASSERT_EQ(difference.size() + intersection.size(), a.size());
+
+        ASSERT_TRUE(a.merge_from(b));
+        expected_a.merge(expected_b);
+        ASSERT_TRUE(is_valid_red_black_tree(a));
+        ASSERT_TRUE(is_valid_red_black_tree(b));
+        ASSERT_EQ(union_of_both.size(), a.size());
+        ASSERT_EQ(intersection.size(), b.size());
+        for (const auto& [key, value] : expected_a)
+        {
+            ASSERT_EQ(value, a.node_at(a.index_of_node_or_null(key)).value());
+        }
+        for (const auto& [key, value] : expected_b)
+        {
+            ASSERT_EQ(value, b.node_at(b.index_of_node_or_null(key)).value());
+        }
+    }
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, MergeFromAndAssignMerged)
+{
+    merge_consistency_test_helper<FixedRedBlackTree<int, int, 256>>();
+    using ContiguousTree = FixedRedBlackTree<int,
+                                             int,
+                                             256,
+                                             std::less<int>,
+                                             RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                             FixedIndexBasedContiguousStorage>;
+    merge_consistency_test_helper<ContiguousTree>();
+}
+
+namespace
+{
+template <class TreeType>
+void split_join_consistency_test_helper()
+{
+    std::mt19937 g(11);
+    std::uniform_int_distribution<int> key_distribution{0, 199};
+    for (std::size_t round = 0; round < 40; round++)
+    {
+        TreeType tree{};
+        std::map<int, int> expected{};
+        for (std::size_t j = 0; j < round * 5; j++)
+        {
+            const int key = key_distribution(g);
+            tree[key] = -key;
+            expected.try_emplace(key, -key);
+        }
+
+        // Split and join back
+        const int split_key = key_distribution(g);
+        const auto parts = tree.split(split_key);
+        ASSERT_EQ(tree.root_index(), NULL_INDEX);
+        ASSERT_EQ(expected.contains(split_key), parts.pivot != NULL_INDEX);
+        if (parts.pivot != NULL_INDEX)
+        {
+            tree.join(parts.less, parts.pivot, parts.greater);
+        }
+        else if (parts.less.root != NULL_INDEX)
+        {
+            const auto rest = tree.split_at(tree.index_of_max_at(parts.less.root));
+            tree.join(rest.less, rest.pivot, parts.greater);
+        }
+        ASSERT_TRUE(is_valid_red_black_tree(tree));
+
+        // Erase random ranges
+        while (!expected.empty())
+        {
+            int from_key = key_distribution(g);
+            int to_key = key_distribution(g);
+            if (from_key > to_key)
+            {
+                std::swap(from_key, to_key);
+            }
+            // So that the largest key can be erased too
+            to_key++;
+            const auto expected_from = expected.lower_bound(from_key);
+            const auto expected_to = expected.lower_bound(to_key);
+            const int expected_successor =
+                expected_to == expected.end() ? -1 : expected_to->first;
+            expected.erase(expected_from, expected_to);
+
+            const NodeIndex successor = tree.delete_range_and_return_successor(
+                tree.index_of_node_ceiling(from_key), tree.index_of_node_ceiling(to_key));
+            ASSERT_TRUE(is_valid_red_black_tree(tree));
+            ASSERT_EQ(expected.size(), tree.size());
+            ASSERT_EQ(expected_successor,
+                      successor == NULL_INDEX ? -1 : tree.node_at(successor).key());
+            std::size_t rank = 0;
+            for (const auto& [key, value] : expected)
+            {
+                const NodeIndex i = tree.index_of_node_or_null(key);
+                ASSERT_EQ(value, tree.node_at(i).value());
+                if constexpr (requires { tree.index_of_nth_at(rank); })
+                {
+                    ASSERT_EQ(i, tree.index_of_nth_at(rank));
+                }
+                rank++;
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, SplitJoinAndDeleteRange)
+{
+    split_join_consistency_test_helper<FixedRedBlackTree<int, int, 256>>();
+    using ContiguousTree = FixedRedBlackTree<int,
+                                             int,
+                                             256,
+                                             std::less<int>,
+                                             RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                             FixedIndexBasedContiguousStorage>;
+    split_join_consistency_test_helper<ContiguousTree>();
+    using OrderStatisticTree = FixedRedBlackTree<int,
+                                                 int,
+                                                 256,
+                                                 std::less<int>,
+                                                 RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                                 FixedIndexBasedOrderStatisticPoolStorage>;
+    split_join_consistency_test_helper<OrderStatisticTree>();
+}
+
+TEST(FixedRedBlackTreeSet, BuildFromSortedUnique)
+{
+    constexpr auto bst = []()
+    {
+        std::array<int, 5> entries{1, 3, 5, 7, 9};
+        FixedRedBlackTreeSet<int, 10> out{};
+        out.build_from_sorted_unique(entries.begin(), entries.size());
+        return out;
+    }();
+
+    static_assert(bst.size() == 5);
+    static_assert(bst.contains_node(1));
+    static_assert(bst.contains_node(9));
+    static_assert(!bst.contains_node(4));
+    static_assert(bst.node_at(bst.root_index()).key() == 5);
+}
+
+TEST(FixedRedBlackTree, IndexOfNodeWithParentNear)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    FixedRedBlackTree<int, int, MAXIMUM_SIZE> bst{};
+    std::mt19937 g(42);
+    std::uniform_int_distribution<int> key_distribution{0, 200};
+
+    while (!bst.full())
+    {
+        const int key = key_distribution(g);
+        // Any hint, good or bad, must lead to the one slot where the key belongs
+        for (std::size_t attempt = 0; attempt < 8; attempt++)
+        {
+            // NULL_INDEX (past-the-end) when there is no such node
+            const NodeIndex hint = bst.index_of_node_ceiling(key_distribution(g));
+            const NodeIndexAndParentIndex expected = bst.index_of_node_with_parent(key);
+            const NodeIndexAndParentIndex actual = bst.index_of_node_with_parent_near(hint, key);
+            ASSERT_EQ(expected.i, actual.i);
+            ASSERT_EQ(expected.parent, actual.parent);
+            ASSERT_EQ(expected.is_left_child, actual.is_left_child);
+        }
+
+        NodeIndexAndParentIndex np = bst.index_of_node_with_parent_near(NULL_INDEX, key);
+        bst.insert_if_not_present_at(np, key, key);
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+    }
+}
+
 TEST(FixedRedBlackTree, TreeMaxHeight)
 {
     static constexpr std::size_t MAXIMUM_SIZE = 512;
@@ -3,14 +3,21 @@
 #include "mock_testing_types.hpp"
 #include "test_utilities_common.hpp"
 
+#include "fixed_containers/fixed_map.hpp"
 #include "fixed_containers/fixed_set.hpp"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <functional>
+#include <iterator>
 #include <ranges>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -149,6 +156,97 @@ TEST(FixedRedBlackTreeView, PreservedOrdering)
     }
 }
 
+template <class T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class, std::size_t>
+          typename StorageTemplate,
+          fixed_red_black_tree_detail::RedBlackTreeStorageType STORAGE_TYPE>
+static void view_matches_set_contents()
+{
+    using FixedSetType = FixedSet<T, MAXIMUM_SIZE, std::less<T>, COMPACTNESS, StorageTemplate>;
+    FixedSetType s1{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i += 3)
+    {
+        s1.insert(static_cast<T>(i));
+    }
+
+    auto view = FixedRedBlackTreeRawView(
+        &s1, sizeof(T), MAXIMUM_SIZE, COMPACTNESS, STORAGE_TYPE, alignof(T));
+    EXPECT_EQ(s1.size(), view.size());
+
+    FixedSetType s2;
+    for (const std::byte* elm_ptr : view)
+    {
+        s2.insert(*reinterpret_cast<const T*>(elm_ptr));
+    }
+    EXPECT_EQ(s1, s2);
+}
+
+TEST(FixedRedBlackTreeView, ViewOfNarrowAndWideNodeIndexes)
+{
+    using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+
+    // 1-byte links
+    view_matches_set_contents<char,
+                              100,
+                              Compactness::EMBEDDED_COLOR,
+                              FixedIndexBasedPoolStorage,
+                              StorageType::FIXED_INDEX_POOL>();
+    // 2-byte links
+    view_matches_set_contents<int,
+                              300,
+                              Compactness::DEDICATED_COLOR,
+                              FixedIndexBasedContiguousStorage,
+                              StorageType::FIXED_INDEX_CONTIGUOUS>();
+    view_matches_set_contents<double,
+                              200,
+                              Compactness::EMBEDDED_COLOR,
+                              FixedIndexBasedPoolStorage,
+                              StorageType::FIXED_INDEX_POOL>();
+    view_matches_set_contents<std::int16_t,
+                              1000,
+                              Compactness::DEDICATED_COLOR,
+                              FixedIndexBasedPoolStorage,
+                              StorageType::FIXED_INDEX_POOL>();
+}
+
+TEST(FixedRedBlackTreeView, ElementAlignment)
+{
+    using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+    using RawTreeLayout = fixed_red_black_tree_view_detail::RawTreeLayout;
+
+    // Without an explicit alignment, the natural alignment of the element size is assumed
+    static_assert(RawTreeLayout::natural_alignment_bytes(1) == 1);
+    static_assert(RawTreeLayout::natural_alignment_bytes(6) == 2);
+    static_assert(RawTreeLayout::natural_alignment_bytes(12) == 4);
+    static_assert(RawTreeLayout::natural_alignment_bytes(sizeof(double)) == alignof(double));
+    static_assert(RawTreeLayout::natural_alignment_bytes(64) == alignof(std::uintptr_t));
+
+    // Elements aligned less than that need their alignment
+    using Element = std::array<char, 2>;
+    using FixedSetType =
+        FixedSet<Element, 50, std::less<>, Compactness::EMBEDDED_COLOR, FixedIndexBasedPoolStorage>;
+    static_assert(RawTreeLayout::natural_alignment_bytes(sizeof(Element)) != alignof(Element));
+    FixedSetType s1{};
+    for (char c = 'a'; c < 'a' + 20; c++)
+    {
+        s1.insert(Element{c, c});
+    }
+    const auto view = FixedRedBlackTreeRawView(&s1,
+                                               sizeof(Element),
+                                               FixedSetType::max_size(),
+                                               Compactness::EMBEDDED_COLOR,
+                                               StorageType::FIXED_INDEX_POOL,
+                                               alignof(Element));
+    const auto value_of = [](const std::byte* ptr)
+    { return *reinterpret_cast<const Element*>(ptr); };
+    EXPECT_EQ(s1.size(), view.size());
+    EXPECT_TRUE(std::ranges::equal(s1, view | std::views::transform(value_of)));
+}
+
 TEST(FixedRedBlackTreeView, SizeCalculation)
 {
     constexpr auto COMPACTNESS =
@@ -197,4 +295,385 @@ TEST(FixedRedBlackTreeView, SizeCalculation)
     EXPECT_EQ(v4.size(), 0);
 }
 
+template <class T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class, std::size_t>
+          typename StorageTemplate,
+          fixed_red_black_tree_detail::RedBlackTreeStorageType STORAGE_TYPE>
+static void static_view_matches_set()
+{
+    using FixedSetType = FixedSet<T, MAXIMUM_SIZE, std::less<T>, COMPACTNESS, StorageTemplate>;
+    using ViewType = FixedRedBlackTreeStaticRawView<sizeof(T),
+                                                    alignof(T),
+                                                    MAXIMUM_SIZE,
+                                                    COMPACTNESS,
+                                                    STORAGE_TYPE>;
+    static_assert(std::bidirectional_iterator<typename ViewType::Iterator>);
+    static_assert(std::ranges::bidirectional_range<ViewType>);
+
+    const auto less = [](const std::byte* lhs, const std::byte* rhs)
+    { return *reinterpret_cast<const T*>(lhs) < *reinterpret_cast<const T*>(rhs); };
+    const auto value_of = [](const std::byte* ptr) { return *reinterpret_cast<const T*>(ptr); };
+
+    FixedSetType s1{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i += 3)
+    {
+        s1.insert(static_cast<T>(i));
+    }
+    // Erase some, so the nodes are not in insertion order
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i += 9)
+    {
+        s1.erase(static_cast<T>(i));
+    }
+
+    const ViewType view(&s1);
+    EXPECT_EQ(s1.size(), view.size());
+    EXPECT_EQ(MAXIMUM_SIZE, ViewType::max_size());
+    EXPECT_TRUE(std::ranges::equal(s1, view | std::views::transform(value_of)));
+    std::vector<T> expected_reversed(s1.begin(), s1.end());
+    std::ranges::reverse(expected_reversed);
+    EXPECT_TRUE(std::ranges::equal(expected_reversed,
+                                   std::ranges::subrange(view.rbegin(), view.rend()) |
+                                       std::views::transform(value_of)));
+
+    for (std::size_t i = 0; i <= MAXIMUM_SIZE; i++)
+    {
+        const auto key = static_cast<T>(i);
+        const auto expected_lower = s1.lower_bound(key);
+        const auto lower = view.lower_bound(&key, less);
+        ASSERT_EQ(expected_lower == s1.end(), lower == view.end());
+        if (lower != view.end())
+        {
+            EXPECT_EQ(*expected_lower, value_of(*lower));
+        }
+
+        const auto expected_upper = s1.upper_bound(key);
+        const auto upper = view.upper_bound(&key, less);
+        ASSERT_EQ(expected_upper == s1.end(), upper == view.end());
+        if (upper != view.end())
+        {
+            EXPECT_EQ(*expected_upper, value_of(*upper));
+        }
+
+        const auto found = view.find(&key, less);
+        EXPECT_EQ(s1.contains(key), found != view.end());
+        EXPECT_EQ(s1.contains(key), view.contains(&key, less));
+        if (found != view.end())
+        {
+            // Points into the set itself
+            EXPECT_EQ(reinterpret_cast<const std::byte*>(&*s1.find(key)), *found);
+        }
+    }
+}
+
+TEST(FixedRedBlackTreeView, StaticViewOfEveryLayout)
+{
+    using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+
+    // 1-byte links
+    static_view_matches_set<char,
+                            100,
+                            Compactness::EMBEDDED_COLOR,
+                            FixedIndexBasedPoolStorage,
+                            StorageType::FIXED_INDEX_POOL>();
+    static_view_matches_set<std::int64_t,
+                            50,
+                            Compactness::DEDICATED_COLOR,
+                            FixedIndexBasedContiguousStorage,
+                            StorageType::FIXED_INDEX_CONTIGUOUS>();
+    // 2-byte links
+    static_view_matches_set<int,
+                            300,
+                            Compactness::DEDICATED_COLOR,
+                            FixedIndexBasedPoolStorage,
+                            StorageType::FIXED_INDEX_POOL>();
+    static_view_matches_set<double,
+                            200,
+                            Compactness::EMBEDDED_COLOR,
+                            FixedIndexBasedContiguousStorage,
+                            StorageType::FIXED_INDEX_CONTIGUOUS>();
+}
+
+TEST(FixedRedBlackTreeView, StaticViewOfMap)
+{
+    constexpr auto COMPACTNESS =
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+    using FixedMapType =
+        FixedMap<int, int, 20, std::less<int>, COMPACTNESS, FixedIndexBasedPoolStorage>;
+    // The key and the value, without padding after the value
+    constexpr std::size_t ELEM_SIZE_BYTES = 2 * sizeof(int);
+    using ViewType =
+        FixedRedBlackTreeStaticRawView<ELEM_SIZE_BYTES,
+                                       alignof(int),
+                                       FixedMapType::max_size(),
+                                       COMPACTNESS,
+                                       fixed_red_black_tree_detail::RedBlackTreeStorageType::
+                                           FIXED_INDEX_POOL>;
+
+    const FixedMapType m1{{30, 3}, {10, 1}, {20, 2}};
+    const ViewType view(&m1);
+    const auto key_less = [](const std::byte* lhs, const std::byte* rhs)
+    { return *reinterpret_cast<const int*>(lhs) < *reinterpret_cast<const int*>(rhs); };
+
+    const int key = 20;
+    const auto it = view.find(&key, key_less);
+    ASSERT_NE(view.end(), it);
+    EXPECT_EQ(2, *reinterpret_cast<const int*>(std::next(*it, sizeof(int))));
+
+    const int missing_key = 25;
+    EXPECT_EQ(view.end(), view.find(&missing_key, key_less));
+    EXPECT_EQ(30, *reinterpret_cast<const int*>(*view.lower_bound(&missing_key, key_less)));
+    EXPECT_EQ(30, *reinterpret_cast<const int*>(*std::prev(view.end())));
+}
+
+TEST(FixedRedBlackTreeView, StaticViewOfEmptyTree)
+{
+    constexpr auto COMPACTNESS =
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+    using FixedSetType = FixedSet<int, 10, std::less<int>, COMPACTNESS, FixedIndexBasedPoolStorage>;
+    using ViewType = FixedRedBlackTreeStaticRawView<
+        sizeof(int),
+        alignof(int),
+        10,
+        COMPACTNESS,
+        fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL>;
+
+    const FixedSetType s1{};
+    const ViewType view(&s1);
+    EXPECT_EQ(0, view.size());
+    EXPECT_EQ(view.begin(), view.end());
+    EXPECT_EQ(view.rbegin(), view.rend());
+    const int key = 1;
+    const auto less = [](const std::byte* lhs, const std::byte* rhs)
+    { return *reinterpret_cast<const int*>(lhs) < *reinterpret_cast<const int*>(rhs); };
+    EXPECT_EQ(view.end(), view.find(&key, less));
+}
+
+// Checks the offsets computed by RawTreeLayout against the members of a real pool-based instance
+template <class Container>
+static void expect_pool_layout_matches(
+    const Container& c, const fixed_red_black_tree_view_detail::RawTreeLayout& layout)
+{
+    const auto offset_of = [&c](const auto& member)
+    {
+        return static_cast<std::size_t>(reinterpret_cast<const std::byte*>(&member) -
+                                        reinterpret_cast<const std::byte*>(&c));
+    };
+    const auto& tree = c.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+    const auto& nodes = tree.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_
+                            .IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_
+                            .IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
+
+    EXPECT_EQ(layout.root_index_offset_bytes,
+              offset_of(tree.IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_));
+    EXPECT_EQ(layout.size_offset_bytes, offset_of(tree.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_));
+    EXPECT_EQ(layout.nodes_offset_bytes, offset_of(nodes[0]));
+    EXPECT_EQ(layout.node_stride_bytes, offset_of(nodes[1]) - offset_of(nodes[0]));
+    // The left link follows the parent link
+    EXPECT_EQ(layout.links_offset_bytes + layout.index_size_bytes,
+              offset_of(nodes[0].value.IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_) -
+                  offset_of(nodes[0]));
+}
+
+TEST(FixedRedBlackTreeView, LayoutOfSplitAndOrderStatisticPoolStorage)
+{
+    using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+    using RawTreeLayout = fixed_red_black_tree_view_detail::RawTreeLayout;
+
+    struct LargeValue
+    {
+        std::array<std::int32_t, 5> a;
+    };
+
+    {
+        using FixedMapType = FixedMap<char,
+                                      LargeValue,
+                                      100,
+                                      std::less<>,
+                                      Compactness::EMBEDDED_COLOR,
+                                      FixedIndexBasedSplitPoolStorage>;
+        const FixedMapType m1{};
+        constexpr RawTreeLayout LAYOUT = RawTreeLayout::of(sizeof(char),
+                                                           alignof(char),
+                                                           100,
+                                                           Compactness::EMBEDDED_COLOR,
+                                                           StorageType::FIXED_INDEX_SPLIT_POOL,
+                                                           sizeof(LargeValue),
+                                                           alignof(LargeValue));
+        expect_pool_layout_matches(m1, LAYOUT);
+        const auto& values = m1.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_
+                                 .IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_
+                                 .IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+        EXPECT_EQ(LAYOUT.values_offset_bytes,
+                  static_cast<std::size_t>(reinterpret_cast<const std::byte*>(&values[0]) -
+                                           reinterpret_cast<const std::byte*>(&m1)));
+        EXPECT_EQ(LAYOUT.value_stride_bytes, sizeof(values[0]));
+    }
+
+    // The subtree size, 1 and 2 bytes wide, fits in the tail padding of the node or extends it
+    const auto check_order_statistic =
+        []<class K, std::size_t MAXIMUM_SIZE, Compactness COMPACTNESS>()
+    {
+        using FixedSetType = FixedSet<K,
+                                      MAXIMUM_SIZE,
+                                      std::less<>,
+                                      COMPACTNESS,
+                                      FixedIndexBasedOrderStatisticPoolStorage>;
+        const FixedSetType s1{};
+        constexpr RawTreeLayout LAYOUT =
+            RawTreeLayout::of(sizeof(K),
+                              alignof(K),
+                              MAXIMUM_SIZE,
+                              COMPACTNESS,
+                              StorageType::FIXED_INDEX_ORDER_STATISTIC_POOL);
+        expect_pool_layout_matches(s1, LAYOUT);
+        const auto& node = s1.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_
+                               .IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_
+                               .IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_
+                               .IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[0]
+                               .value;
+        EXPECT_EQ(LAYOUT.subtree_size_offset_bytes,
+                  static_cast<std::size_t>(
+                      reinterpret_cast<const std::byte*>(
+                          &node.IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_) -
+                      reinterpret_cast<const std::byte*>(&node)));
+        EXPECT_EQ(LAYOUT.subtree_size_bytes,
+                  sizeof(node.IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_));
+    };
+    check_order_statistic.template operator()<char, 100, Compactness::EMBEDDED_COLOR>();
+    check_order_statistic.template operator()<std::int64_t, 50, Compactness::DEDICATED_COLOR>();
+    check_order_statistic.template operator()<int, 300, Compactness::DEDICATED_COLOR>();
+    check_order_statistic.template operator()<double, 200, Compactness::EMBEDDED_COLOR>();
+}
+
+TEST(FixedRedBlackTreeView, ViewOfSplitAndOrderStatisticPoolStorage)
+{
+    using Compactness = fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using StorageType = fixed_red_black_tree_detail::RedBlackTreeStorageType;
+
+    view_matches_set_contents<int,
+                              300,
+                              Compactness::EMBEDDED_COLOR,
+                              FixedIndexBasedSplitPoolStorage,
+                              StorageType::FIXED_INDEX_SPLIT_POOL>();
+    view_matches_set_contents<char,
+                              100,
+                              Compactness::DEDICATED_COLOR,
+                              FixedIndexBasedOrderStatisticPoolStorage,
+                              StorageType::FIXED_INDEX_ORDER_STATISTIC_POOL>();
+    static_view_matches_set<std::int64_t,
+                            50,
+                            Compactness::DEDICATED_COLOR,
+                            FixedIndexBasedSplitPoolStorage,
+                            StorageType::FIXED_INDEX_SPLIT_POOL>();
+    static_view_matches_set<double,
+                            200,
+                            Compactness::EMBEDDED_COLOR,
+                            FixedIndexBasedOrderStatisticPoolStorage,
+                            StorageType::FIXED_INDEX_ORDER_STATISTIC_POOL>();
+}
+
+TEST(FixedRedBlackTreeView, StaticViewOfSplitPoolMap)
+{
+    constexpr auto COMPACTNESS =
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::DEDICATED_COLOR;
+    constexpr auto STORAGE_TYPE =
+        fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_SPLIT_POOL;
+    struct LargeValue
+    {
+        double d;
+        std::array<int, 7> a;
+    };
+    using FixedMapType = FixedMap<std::int16_t,
+                                  LargeValue,
+                                  30,
+                                  std::less<>,
+                                  COMPACTNESS,
+                                  FixedIndexBasedSplitPoolStorage>;
+    using ViewType = FixedRedBlackTreeStaticRawView<sizeof(std::int16_t),
+                                                    alignof(std::int16_t),
+                                                    FixedMapType::max_size(),
+                                                    COMPACTNESS,
+                                                    STORAGE_TYPE,
+                                                    sizeof(LargeValue),
+                                                    alignof(LargeValue)>;
+
+    FixedMapType m1{};
+    for (std::int16_t key = 0; key < 30; key += 2)
+    {
+        m1[key] = LargeValue{.d = key * 0.5, .a = {key}};
+    }
+    m1.erase(10);
+
+    const ViewType view(&m1);
+    EXPECT_EQ(m1.size(), view.size());
+    const auto key_less = [](const std::byte* lhs, const std::byte* rhs)
+    {
+        return *reinterpret_cast<const std::int16_t*>(lhs) <
+               *reinterpret_cast<const std::int16_t*>(rhs);
+    };
+    for (const auto& [key, value] : m1)
+    {
+        const auto it = view.find(&key, key_less);
+        ASSERT_NE(view.end(), it);
+        EXPECT_EQ(reinterpret_cast<const std::byte*>(&key), *it);
+        EXPECT_EQ(reinterpret_cast<const std::byte*>(&value), view.value_pointer(it));
+    }
+
+    auto dynamic_view = FixedRedBlackTreeRawView(&m1,
+                                                 sizeof(std::int16_t),
+                                                 FixedMapType::max_size(),
+                                                 COMPACTNESS,
+                                                 STORAGE_TYPE,
+                                                 alignof(std::int16_t),
+                                                 sizeof(LargeValue),
+                                                 alignof(LargeValue));
+    EXPECT_EQ(m1.size(), dynamic_view.size());
+    const auto key_of = [](const std::byte* ptr)
+    { return *reinterpret_cast<const std::int16_t*>(ptr); };
+    EXPECT_TRUE(
+        std::ranges::equal(m1 | std::views::keys, dynamic_view | std::views::transform(key_of)));
+}
+
+TEST(FixedRedBlackTreeView, StaticViewNthOfOrderStatisticTree)
+{
+    constexpr auto COMPACTNESS =
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+    using FixedSetType = FixedSet<int,
+                                  300,
+                                  std::less<>,
+                                  COMPACTNESS,
+                                  FixedIndexBasedOrderStatisticPoolStorage>;
+    using ViewType = FixedRedBlackTreeStaticRawView<
+        sizeof(int),
+        alignof(int),
+        FixedSetType::max_size(),
+        COMPACTNESS,
+        fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_ORDER_STATISTIC_POOL>;
+
+    FixedSetType s1{};
+    const ViewType view(&s1);
+    EXPECT_EQ(view.end(), view.nth(0));
+
+    for (int i = 0; i < 300; i += 2)
+    {
+        s1.insert((i * 37) % 300);
+    }
+    for (int i = 0; i < 300; i += 7)
+    {
+        s1.erase(i);
+    }
+
+    for (std::size_t n = 0; n < s1.size(); n++)
+    {
+        const auto it = view.nth(n);
+        ASSERT_NE(view.end(), it);
+        EXPECT_EQ(reinterpret_cast<const std::byte*>(&*s1.nth(n)), *it);
+    }
+    EXPECT_EQ(view.end(), view.nth(s1.size()));
+}
+
 }  // namespace fixed_containers
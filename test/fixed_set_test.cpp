@@ -11,7 +11,16 @@
 #include <range/v3/view/filter.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -90,6 +99,83 @@ TEST(FixedSet, Contains)
     static_assert(s1.contains(4));
 }
 
+TEST(FixedSet, FindBatch)
+{
+    static constexpr FixedSet<int, 10> s1{2, 4};
+    static_assert(
+        []()
+        {
+            constexpr std::array<int, 3> KEYS{4, 1, 2};
+            std::array<FixedSet<int, 10>::const_iterator, 3> out{};
+            s1.find_batch(KEYS, out);
+            return *out[0] == 4 && out[1] == s1.cend() && *out[2] == 2;
+        }());
+
+    FixedSet<int, 64> s2{};
+    std::array<int, 40> keys{};
+    for (std::size_t j = 0; j < keys.size(); j++)
+    {
+        keys[j] = static_cast<int>((j * 7) % 40);
+        if (j % 2 == 0)
+        {
+            s2.insert(static_cast<int>(j));
+        }
+    }
+    std::array<bool, 40> contained{};
+    s2.contains_batch(keys, contained);
+    for (std::size_t j = 0; j < keys.size(); j++)
+    {
+        EXPECT_EQ(s2.contains(keys[j]), contained[j]);
+    }
+}
+
+TEST(FixedSet, OrderStatistics)
+{
+    using OrderStatisticFixedSet =
+        FixedSet<int,
+                 10,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedOrderStatisticPoolStorage>;
+
+    constexpr auto s1 = []()
+    {
+        OrderStatisticFixedSet s{8, 2, 6, 4};
+        s.insert(5);
+        s.erase(6);
+        return s;
+    }();
+
+    static_assert(*s1.nth(0) == 2);
+    static_assert(*s1.nth(2) == 5);
+    static_assert(s1.nth(4) == s1.end());
+    static_assert(s1.rank_of(5) == 2);
+    static_assert(s1.rank_of(9) == 4);
+    static_assert(s1.count_in_range(3, 8) == 2);
+
+    OrderStatisticFixedSet s2{};
+    std::set<int> reference{};
+    for (int j = 0; j < 40; j++)
+    {
+        const int key = (j * 7) % 10;
+        if (j % 4 == 3)
+        {
+            s2.erase(key);
+            reference.erase(key);
+        }
+        else
+        {
+            s2.insert(key);
+            reference.insert(key);
+        }
+        for (int k = 0; k < 10; k++)
+        {
+            ASSERT_EQ(std::distance(reference.begin(), reference.lower_bound(k)),
+                      static_cast<std::ptrdiff_t>(s2.rank_of(k)));
+        }
+    }
+}
+
 TEST(FixedSet, Contains_TransparentComparator)
 {
     constexpr FixedSet<MockAComparableToB, 5, std::less<>> s{
@@ -249,6 +335,28 @@ TEST(FixedSet, Insert_ExceedsCapacity)
     }
 }
 
+TEST(FixedSet, Insert_Hint)
+{
+    constexpr FixedSet<int, 10> s1 = []()
+    {
+        FixedSet<int, 10> s{};
+        for (int i = 0; i < 6; i++)
+        {
+            s.insert(s.cend(), i);
+        }
+        // Existing key, then good and bad hints for a new one
+        assert_or_abort(*s.insert(s.cbegin(), 3) == 3);
+        assert_or_abort(*s.insert(s.cbegin(), 7) == 7);
+        assert_or_abort(*s.insert(s.find(7), 6) == 6);
+        return s;
+    }();
+
+    static_assert(consteval_compare::equal<8, s1.size()>);
+    static_assert(*s1.begin() == 0);
+    static_assert(*std::prev(s1.end()) == 7);
+    static_assert(std::is_sorted(s1.begin(), s1.end()));
+}
+
 TEST(FixedSet, InsertMultipleTimes)
 {
     constexpr auto s1 = []()
@@ -300,6 +408,65 @@ TEST(FixedSet, InsertInitializer)
     static_assert(s1.contains(4));
 }
 
+TEST(FixedSet, FromSortedUnique)
+{
+    constexpr auto s1 = FixedSet<int, 10>::from_sorted_unique({2, 4, 6});
+    static_assert(s1.size() == 3);
+    static_assert(!s1.contains(1));
+    static_assert(s1.contains(2));
+    static_assert(s1.contains(6));
+    static_assert(*std::next(s1.begin(), 2) == 6);
+
+    constexpr std::array<int, 2> INPUT{1, 3};
+    constexpr auto s2 = FixedSet<int, 10>::from_sorted_unique(INPUT.begin(), INPUT.end());
+    static_assert(s2.size() == 2);
+    static_assert(s2.contains(1));
+    static_assert(s2.contains(3));
+}
+
+TEST(FixedSet, FromSortedUnique_ExceedsCapacity)
+{
+    constexpr std::array<int, 3> INPUT{1, 3, 5};
+    using SetType = FixedSet<int, 2>;
+    EXPECT_DEATH((void)SetType::from_sorted_unique(INPUT.begin(), INPUT.end()), "");
+}
+
+TEST(FixedSet, InsertSorted)
+{
+    constexpr auto s1 = []()
+    {
+        FixedSet<int, 10> s{};
+        s.insert_sorted({2, 4});
+        // Non-empty, merged in
+        s.insert_sorted({1, 4, 5});
+        return s;
+    }();
+
+    static_assert(s1.size() == 4);
+    static_assert(s1.contains(1));
+    static_assert(s1.contains(2));
+    static_assert(s1.contains(4));
+    static_assert(s1.contains(5));
+}
+
+TEST(FixedSet, InsertSorted_NonEmptyKeepsIteratorsValid)
+{
+    FixedSet<int, 4> s1{2, 4};
+    const auto it = s1.find(4);
+    // Overlaps with the existing keys and exactly fills the set
+    s1.insert_sorted({1, 2, 3, 4});
+
+    EXPECT_EQ((FixedSet<int, 4>{1, 2, 3, 4}), s1);
+    EXPECT_EQ(4, *it);
+    EXPECT_EQ(s1.find(4), it);
+}
+
+TEST(FixedSet, InsertSorted_NonEmptyExceedsCapacity)
+{
+    FixedSet<int, 3> s1{2, 4};
+    EXPECT_DEATH(s1.insert_sorted({1, 3}), "");
+}
+
 TEST(FixedSet, Insert_Iterators)
 {
     constexpr auto s1 = []()
@@ -604,6 +771,212 @@ TEST(FixedSet, SetIntersection)
     static_assert(!s1.contains(4));
 }
 
+TEST(FixedSet, SetAlgebra)
+{
+    static constexpr FixedSet<int, 10> S1{1, 3, 5, 7};
+    static constexpr FixedSet<int, 10> S2{3, 4, 5, 6};
+
+    constexpr auto UNION = set_union(S1, S2);
+    static_assert(std::ranges::equal(UNION, std::array{1, 3, 4, 5, 6, 7}));
+    constexpr auto INTERSECTION = set_intersection(S1, S2);
+    static_assert(std::ranges::equal(INTERSECTION, std::array{3, 5}));
+    constexpr auto DIFFERENCE = set_difference(S1, S2);
+    static_assert(std::ranges::equal(DIFFERENCE, std::array{1, 7}));
+
+    static_assert(set_union(S1, FixedSet<int, 10>{}) == S1);
+    static_assert(set_intersection(S1, FixedSet<int, 10>{}).empty());
+    static_assert(set_difference(FixedSet<int, 10>{}, S1).empty());
+}
+
+TEST(FixedSet, SetAlgebra_MatchesStd)
+{
+    const auto check = [](auto a, auto b)
+    {
+        std::mt19937 random_engine{17};
+        std::uniform_int_distribution<int> distribution{0, 99};
+        for (int j = 0; j < 60; j++)
+        {
+            a.insert(distribution(random_engine));
+            b.insert(distribution(random_engine));
+        }
+
+        std::vector<int> expected{};
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_TRUE(std::ranges::equal(expected, set_union(a, b)));
+        expected.clear();
+        std::set_intersection(
+            a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_TRUE(std::ranges::equal(expected, set_intersection(a, b)));
+        expected.clear();
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ASSERT_TRUE(std::ranges::equal(expected, set_difference(a, b)));
+
+        // The result must be a valid tree that can keep being modified
+        auto c = set_union(a, b);
+        c.erase(c.begin());
+        c.insert(-1);
+        ASSERT_EQ(expected.size(), set_difference(a, b).size());
+    };
+
+    check(FixedSet<int, 128>{}, FixedSet<int, 128>{});
+    using ContiguousFixedSet =
+        FixedSet<int,
+                 128,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                 FixedIndexBasedContiguousStorage>;
+    check(ContiguousFixedSet{}, ContiguousFixedSet{});
+}
+
+TEST(FixedSet, SetAlgebra_ExceedsCapacity)
+{
+    const FixedSet<int, 3> s1{1, 2};
+    const FixedSet<int, 3> s2{3, 4};
+    EXPECT_DEATH((void)set_union(s1, s2), "");
+}
+
+TEST(FixedSet, Merge)
+{
+    {
+        constexpr auto s1 = []()
+        {
+            FixedSet<int, 10> a{1, 3, 5};
+            FixedSet<int, 10> b{2, 3, 4};
+            a.merge(b);
+            // Duplicates stay in the source
+            return std::pair{a, b};
+        }();
+        static_assert(std::ranges::equal(s1.first, std::array{1, 2, 3, 4, 5}));
+        static_assert(std::ranges::equal(s1.second, std::array{3}));
+    }
+
+    {
+        FixedSet<int, 10> a{1, 3, 5};
+        const auto it = a.find(3);
+        a.merge(FixedSet<int, 10>{0, 6});
+        EXPECT_EQ(3, *it);
+        EXPECT_EQ(6, *std::next(it, 2));
+        EXPECT_TRUE(std::ranges::equal(a, std::array{0, 1, 3, 5, 6}));
+
+        a.merge(a);
+        EXPECT_EQ(5, a.size());
+    }
+}
+
+TEST(FixedSet, Merge_MatchesStd)
+{
+    const auto check = [](auto a, auto b)
+    {
+        std::mt19937 random_engine{23};
+        std::uniform_int_distribution<int> distribution{0, 99};
+        std::set<int> expected_a{};
+        std::set<int> expected_b{};
+        for (int j = 0; j < 50; j++)
+        {
+            const int key_a = distribution(random_engine);
+            const int key_b = distribution(random_engine);
+            a.insert(key_a);
+            b.insert(key_b);
+            expected_a.insert(key_a);
+            expected_b.insert(key_b);
+        }
+        // Leave gaps in the storage
+        for (int key = 0; key < 100; key += 7)
+        {
+            a.erase(key);
+            b.erase(key);
+            expected_a.erase(key);
+            expected_b.erase(key);
+        }
+
+        a.merge(b);
+        expected_a.merge(expected_b);
+        ASSERT_TRUE(std::ranges::equal(expected_a, a));
+        ASSERT_TRUE(std::ranges::equal(expected_b, b));
+
+        // Both must be valid trees that can keep being modified
+        for (int key = 0; key < 100; key += 3)
+        {
+            ASSERT_EQ(expected_a.erase(key), a.erase(key));
+            ASSERT_EQ(expected_b.insert(key).second, b.insert(key).second);
+        }
+        ASSERT_TRUE(std::ranges::equal(expected_a, a));
+        ASSERT_TRUE(std::ranges::equal(expected_b, b));
+    };
+
+    check(FixedSet<int, 128>{}, FixedSet<int, 128>{});
+    using ContiguousFixedSet =
+        FixedSet<int,
+                 128,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                 FixedIndexBasedContiguousStorage>;
+    check(ContiguousFixedSet{}, ContiguousFixedSet{});
+    using OrderStatisticFixedSet =
+        FixedSet<int,
+                 128,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedOrderStatisticPoolStorage>;
+    check(OrderStatisticFixedSet{}, OrderStatisticFixedSet{});
+
+    OrderStatisticFixedSet a{1, 3, 5};
+    a.merge(OrderStatisticFixedSet{2, 4});
+    EXPECT_EQ(4, *a.nth(3));
+    EXPECT_EQ(2, a.rank_of(3));
+}
+
+TEST(FixedSet, Merge_ExceedsCapacity)
+{
+    FixedSet<int, 3> s1{1, 2};
+    FixedSet<int, 3> s2{3, 4};
+    EXPECT_DEATH(s1.merge(s2), "");
+}
+
+TEST(FixedSet, Extract)
+{
+    constexpr auto s1 = []()
+    {
+        FixedSet<int, 10> a{1, 3, 5};
+        FixedSet<int, 10> b{};
+        b.insert(a.extract(a.find(3)));
+        const std::optional<int> extracted = a.extract(5);
+        const std::optional<int> missing = a.extract(7);
+        b.insert(extracted.value_or(-1));
+        b.insert(missing.value_or(-1));
+        return std::pair{a, b};
+    }();
+    static_assert(std::ranges::equal(s1.first, std::array{1}));
+    static_assert(std::ranges::equal(s1.second, std::array{-1, 3, 5}));
+}
+
+TEST(FixedSet, CompactInOrder)
+{
+    constexpr auto s1 = []()
+    {
+        FixedSet<int, 10> s{5, 1, 9, 3, 7};
+        s.erase(1);
+        s.erase(7);
+        s.insert(8);
+        s.insert(2);
+        assert_or_abort(s.fragmentation() > 0);
+        while (!s.compact_in_order(1))
+        {
+        }
+        return s;
+    }();
+    static_assert(s1.fragmentation() == 0);
+    static_assert(std::ranges::equal(s1, std::array{2, 3, 5, 8, 9}));
+
+    FixedSet<int, 10> s2{4, 2, 6};
+    s2.erase(2);
+    s2.insert(1);
+    s2.compact_in_order();
+    EXPECT_EQ(0, s2.fragmentation());
+    EXPECT_LT(std::addressof(*s2.begin()), std::addressof(*std::next(s2.begin())));
+    EXPECT_TRUE(std::ranges::equal(s2, std::array{1, 4, 6}));
+}
+
 namespace
 {
 template <FixedSet<int, 5> /*INSTANCE*/>
@@ -635,5 +1008,6 @@ TEST(FixedSet, ArgumentDependentLookup)
     fixed_containers::FixedSet<int, 5> a{};
     erase_if(a, [](int) { return true; });
     is_full(a);
+    (void)set_union(a, a);
 }
 }  // namespace another_namespace_unrelated_to_the_fixed_containers_namespace
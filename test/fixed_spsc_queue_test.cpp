@@ -0,0 +1,219 @@
+#include "fixed_containers/fixed_spsc_queue.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using QueueType = FixedSpscQueue<int, 8>;
+static_assert(TriviallyDestructible<QueueType>);
+static_assert(NotCopyConstructible<QueueType>);
+static_assert(NotMoveAssignable<QueueType>);
+static_assert(NotTriviallyDestructible<FixedSpscQueue<MockNonTrivialDestructible, 8>>);
+
+// Producer and consumer state must not share a cache line
+static_assert(sizeof(QueueType) >=
+              2 * cache_line_detail::CACHE_LINE_SIZE + sizeof(int) * 8);
+}  // namespace
+
+TEST(FixedSpscQueue, DefaultConstructor)
+{
+    const QueueType q{};
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(0, q.size());
+    static_assert(QueueType::capacity() == 8);
+}
+
+TEST(FixedSpscQueue, PushAndPop)
+{
+    QueueType q{};
+    EXPECT_TRUE(q.try_push(1));
+    const int value = 2;
+    EXPECT_TRUE(q.try_push(value));
+    EXPECT_TRUE(q.try_emplace(3));
+    EXPECT_EQ(3, q.size());
+
+    EXPECT_EQ(1, q.try_pop());
+    EXPECT_EQ(2, q.try_pop());
+    EXPECT_EQ(3, q.try_pop());
+    EXPECT_EQ(std::nullopt, q.try_pop());
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(FixedSpscQueue, Full)
+{
+    QueueType q{};
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(8));
+    EXPECT_EQ(8, q.size());
+
+    EXPECT_EQ(0, q.try_pop());
+    EXPECT_TRUE(q.try_push(8));
+    EXPECT_FALSE(q.try_push(9));
+}
+
+TEST(FixedSpscQueue, WrapAroundWithNonPowerOfTwoCapacity)
+{
+    FixedSpscQueue<int, 5> q{};
+    int next_push = 0;
+    int next_pop = 0;
+    for (int round = 0; round < 20; round++)
+    {
+        while (q.try_push(next_push))
+        {
+            next_push++;
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(next_pop, q.try_pop());
+            next_pop++;
+        }
+    }
+    EXPECT_EQ(next_push - next_pop, static_cast<int>(q.size()));
+}
+
+TEST(FixedSpscQueue, BatchPushAndPop)
+{
+    FixedSpscQueue<int, 6> q{};
+    const std::array<int, 4> input{1, 2, 3, 4};
+
+    EXPECT_EQ(4, q.try_push_n(input.begin(), input.size()));
+    // Only two slots left
+    EXPECT_EQ(2, q.try_push_n(input.begin(), input.size()));
+    EXPECT_EQ(0, q.try_push_n(input.begin(), input.size()));
+
+    std::array<int, 5> output{};
+    EXPECT_EQ(5, q.try_pop_n(output.begin(), output.size()));
+    EXPECT_EQ((std::array<int, 5>{1, 2, 3, 4, 1}), output);
+
+    // Wraps around the end of the storage
+    EXPECT_EQ(4, q.try_push_n(input.begin(), input.size()));
+    std::vector<int> rest{};
+    EXPECT_EQ(5, q.try_pop_n(std::back_inserter(rest), 10));
+    EXPECT_EQ((std::vector<int>{2, 1, 2, 3, 4}), rest);
+    EXPECT_EQ(0, q.try_pop_n(std::back_inserter(rest), 10));
+}
+
+TEST(FixedSpscQueue, NonTrivialElements)
+{
+    FixedSpscQueue<std::string, 3> q{};
+    EXPECT_TRUE(q.try_push(std::string(100, 'a')));
+    EXPECT_TRUE(q.try_emplace(3, 'b'));
+    EXPECT_EQ(std::string(100, 'a'), q.try_pop());
+    EXPECT_EQ("bbb", q.try_pop());
+}
+
+namespace
+{
+struct FixedSpscQueueInstanceCounterUniquenessToken
+{
+};
+
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedSpscQueueInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedSpscQueue, DestroysRemainingElements)
+{
+    using T = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, T::counter);
+    {
+        FixedSpscQueue<T, 4> q{};
+        for (int i = 0; i < 4; i++)
+        {
+            ASSERT_TRUE(q.try_emplace(i));
+        }
+        ASSERT_EQ(4, T::counter);
+        (void)q.try_pop();
+        ASSERT_EQ(3, T::counter);
+        ASSERT_TRUE(q.try_emplace(4));
+        ASSERT_EQ(4, T::counter);
+    }
+    ASSERT_EQ(0, T::counter);
+}
+
+TEST(FixedSpscQueue, ProducerAndConsumerThreads)
+{
+    static constexpr std::uint64_t COUNT = 200'000;
+    FixedSpscQueue<std::uint64_t, 64> q{};
+
+    std::thread producer(
+        [&q]()
+        {
+            std::array<std::uint64_t, 7> batch{};
+            std::uint64_t next = 0;
+            while (next < COUNT)
+            {
+                if (next % 3 == 0)
+                {
+                    if (q.try_push(next))
+                    {
+                        next++;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                    continue;
+                }
+                const std::size_t n =
+                    (std::min)(batch.size(), static_cast<std::size_t>(COUNT - next));
+                for (std::size_t i = 0; i < n; i++)
+                {
+                    batch[i] = next + i;
+                }
+                const std::size_t pushed = q.try_push_n(batch.begin(), n);
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+                next += pushed;
+            }
+        });
+
+    std::uint64_t expected = 0;
+    std::uint64_t sum = 0;
+    bool in_order = true;
+    std::array<std::uint64_t, 5> batch{};
+    while (expected < COUNT)
+    {
+        const std::size_t n = q.try_pop_n(batch.begin(), batch.size());
+        if (n == 0)
+        {
+            // Lets the producer make progress when both threads share a core
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            in_order = in_order && batch[i] == expected;
+            sum += batch[i];
+            expected++;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(COUNT * (COUNT - 1) / 2, sum);
+    EXPECT_TRUE(q.empty());
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,728 @@
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+#include "test_utilities_common.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/view/filter.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedUnorderedMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::forward_iterator<ES_1::iterator>);
+static_assert(std::forward_iterator<ES_1::const_iterator>);
+static_assert(!std::random_access_iterator<ES_1::iterator>);
+static_assert(!std::random_access_iterator<ES_1::const_iterator>);
+
+static_assert(std::is_trivially_copyable_v<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::iterator>);
+
+static_assert(std::is_same_v<std::iter_value_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, std::pair<const int&, const int&>>);
+static_assert(std::is_same_v<ES_1::reference, ES_1::iterator::reference>);
+
+using STD_UNORDERED_MAP_INT_INT = std::unordered_map<int, int>;
+static_assert(ranges::forward_iterator<STD_UNORDERED_MAP_INT_INT::iterator>);
+static_assert(ranges::forward_iterator<ES_1::iterator>);
+static_assert(ranges::forward_iterator<ES_1::const_iterator>);
+
+struct TransparentStringViewHash
+{
+    using is_transparent = void;
+    constexpr std::size_t operator()(std::string_view s) const
+    {
+        return Hash<std::string_view>{}(s);
+    }
+};
+
+// All keys collide in the hash, exercising the probing and the key comparisons
+struct ConstantHash
+{
+    constexpr std::size_t operator()(const int& /*key*/) const { return 7; }
+};
+
+}  // namespace
+
+TEST(FixedUnorderedMap, DefaultConstructor)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+}
+
+TEST(FixedUnorderedMap, IteratorConstructor)
+{
+    constexpr std::array INPUT{std::pair{2, 20}, std::pair{4, 40}};
+    constexpr FixedUnorderedMap<int, int, 10> s2{INPUT.begin(), INPUT.end()};
+    static_assert(s2.size() == 2);
+
+    static_assert(s2.at(2) == 20);
+    static_assert(s2.at(4) == 40);
+}
+
+TEST(FixedUnorderedMap, Initializer)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    static_assert(s1.size() == 2);
+
+    constexpr FixedUnorderedMap<int, int, 10> s2{{3, 30}};
+    static_assert(s2.size() == 1);
+}
+
+TEST(FixedUnorderedMap, MaxSize)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    static_assert(s1.max_size() == 10);
+}
+
+TEST(FixedUnorderedMap, EmptySizeFull)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    static_assert(s1.size() == 2);
+    static_assert(!s1.empty());
+
+    constexpr FixedUnorderedMap<int, int, 10> s2{};
+    static_assert(s2.size() == 0);
+    static_assert(s2.empty());
+
+    constexpr FixedUnorderedMap<int, int, 2> s3{{2, 20}, {4, 40}};
+    static_assert(is_full(s3));
+
+    constexpr FixedUnorderedMap<int, int, 5> s4{{2, 20}, {4, 40}};
+    static_assert(!is_full(s4));
+}
+
+TEST(FixedUnorderedMap, MaxSizeDeduction)
+{
+    constexpr auto s1 = make_fixed_unordered_map({std::pair{30, 30}, std::pair{31, 54}});
+    static_assert(s1.size() == 2);
+    static_assert(s1.max_size() == 2);
+    static_assert(s1.contains(30));
+    static_assert(s1.contains(31));
+    static_assert(!s1.contains(32));
+}
+
+TEST(FixedUnorderedMap, OperatorBracket_Constexpr)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{};
+        s[2] = 20;
+        s[4] = 40;
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(!s1.contains(1));
+    static_assert(s1.contains(2));
+    static_assert(!s1.contains(3));
+    static_assert(s1.contains(4));
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedUnorderedMap, OperatorBracket_ExceedsCapacity)
+{
+    FixedUnorderedMap<int, int, 2> s1{};
+    s1[2];
+    s1[4];
+    s1[4];
+    s1[4];
+    EXPECT_DEATH(s1[6], "");
+}
+
+TEST(FixedUnorderedMap, At_OutOfRange)
+{
+    FixedUnorderedMap<int, int, 5> s1{{2, 20}};
+    EXPECT_EQ(20, s1.at(2));
+    EXPECT_DEATH((void)s1.at(3), "");
+}
+
+TEST(FixedUnorderedMap, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{};
+        s.insert({2, 20});
+        s.insert({4, 40});
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(!s1.contains(1));
+    static_assert(s1.contains(2));
+    static_assert(!s1.contains(3));
+    static_assert(s1.contains(4));
+}
+
+TEST(FixedUnorderedMap, Insert_ExceedsCapacity)
+{
+    FixedUnorderedMap<int, int, 2> s1{};
+    s1.insert({2, 20});
+    s1.insert({4, 40});
+    s1.insert({4, 41});
+    EXPECT_DEATH(s1.insert({6, 60}), "");
+}
+
+TEST(FixedUnorderedMap, InsertMultipleTimes)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{};
+        {
+            auto [it, was_inserted] = s.insert({2, 20});
+            assert_or_abort(was_inserted);
+            assert_or_abort(2 == it->first);
+            assert_or_abort(20 == it->second);
+        }
+        {
+            auto [it, was_inserted] = s.insert({2, 99});
+            assert_or_abort(!was_inserted);
+            assert_or_abort(2 == it->first);
+            assert_or_abort(20 == it->second);
+        }
+        return s;
+    }();
+
+    static_assert(s1.size() == 1);
+    static_assert(s1.at(2) == 20);
+}
+
+TEST(FixedUnorderedMap, InsertOrAssign)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{};
+        {
+            auto [it, was_inserted] = s.insert_or_assign(2, 20);
+            assert_or_abort(was_inserted);
+            assert_or_abort(20 == it->second);
+        }
+        {
+            auto [it, was_inserted] = s.insert_or_assign(2, 209);
+            assert_or_abort(!was_inserted);
+            assert_or_abort(209 == it->second);
+        }
+        {
+            auto it = s.insert_or_assign(s.cbegin(), 4, 40);
+            assert_or_abort(40 == it->second);
+        }
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 209);
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedUnorderedMap, TryEmplace)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{};
+        s.try_emplace(2, 20);
+        s.try_emplace(2, 209);
+        s.try_emplace(s.cbegin(), 4, 40);
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedUnorderedMap, Emplace)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{};
+        s.emplace(2, 20);
+        s.emplace(std::pair{4, 40});
+        s.emplace_hint(s.cend(), 6, 60);
+        return s;
+    }();
+
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+    static_assert(s1.at(6) == 60);
+}
+
+TEST(FixedUnorderedMap, Clear)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{{2, 20}, {4, 40}};
+        s.clear();
+        s[5] = 50;
+        return s;
+    }();
+
+    static_assert(s1.size() == 1);
+    static_assert(s1.contains(5));
+    static_assert(!s1.contains(2));
+}
+
+TEST(FixedUnorderedMap, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{{2, 20}, {4, 40}};
+        auto removed_count = s.erase(2);
+        assert_or_abort(removed_count == 1);
+        removed_count = s.erase(3);
+        assert_or_abort(removed_count == 0);
+        return s;
+    }();
+
+    static_assert(s1.size() == 1);
+    static_assert(!s1.contains(2));
+    static_assert(s1.contains(4));
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedUnorderedMap, EraseIterator)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{{2, 20}, {3, 30}, {4, 40}};
+        {
+            auto it = s.begin();
+            auto next = s.erase(it);
+            // The last entry is moved into the erased position
+            assert_or_abort(next->first == 4 && next->second == 40);
+        }
+        {
+            auto it = s.cbegin();
+            std::advance(it, 1);
+            auto next = s.erase(it);
+            assert_or_abort(next == s.end());
+        }
+        return s;
+    }();
+
+    static_assert(s1.size() == 1);
+    static_assert(s1.contains(4));
+}
+
+TEST(FixedUnorderedMap, EraseRange)
+{
+    {
+        constexpr auto s1 = []()
+        {
+            FixedUnorderedMap<int, int, 10> s{{2, 20}, {3, 30}, {4, 40}, {5, 50}};
+            auto from = s.begin();
+            std::advance(from, 1);
+            auto to = s.begin();
+            std::advance(to, 3);
+            auto next = s.erase(from, to);
+            assert_or_abort(next->first == 5);
+            return s;
+        }();
+
+        static_assert(s1.size() == 2);
+        static_assert(s1.contains(2));
+        static_assert(s1.contains(5));
+    }
+    {
+        constexpr auto s1 = []()
+        {
+            FixedUnorderedMap<int, int, 10> s{{2, 20}, {3, 30}, {4, 40}, {5, 50}};
+            auto from = s.begin();
+            std::advance(from, 2);
+            auto next = s.erase(from, s.end());
+            assert_or_abort(next == s.end());
+            return s;
+        }();
+
+        static_assert(s1.size() == 2);
+        static_assert(s1.contains(2));
+        static_assert(s1.contains(3));
+    }
+    {
+        FixedUnorderedMap<int, int, 10> s{{2, 20}, {3, 30}, {4, 40}, {5, 50}};
+        auto next = s.erase(s.cbegin(), s.cend());
+        EXPECT_EQ(next, s.end());
+        EXPECT_TRUE(s.empty());
+    }
+}
+
+TEST(FixedUnorderedMap, EraseIf)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> s{{2, 20}, {3, 30}, {4, 40}, {5, 50}};
+        const std::size_t removed_count =
+            erase_if(s, [](const auto& entry) { return entry.first % 2 == 0; });
+        assert_or_abort(2 == removed_count);
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.contains(3));
+    static_assert(s1.contains(5));
+}
+
+TEST(FixedUnorderedMap, IteratorBasic)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+
+    static_assert(std::distance(s1.cbegin(), s1.cend()) == 4);
+
+    // Iteration follows insertion order, as long as nothing was erased
+    static_assert(s1.begin()->first == 1);
+    static_assert(std::next(s1.begin(), 1)->second == 20);
+    static_assert(std::next(s1.begin(), 3)->first == 4);
+    static_assert(std::next(s1.begin(), 4) == s1.end());
+}
+
+TEST(FixedUnorderedMap, IteratorMutableValue)
+{
+    FixedUnorderedMap<int, int, 10> s1{{1, 10}, {2, 20}};
+    for (auto&& [key, value] : s1)
+    {
+        value *= 2;
+    }
+    EXPECT_EQ(20, s1.at(1));
+    EXPECT_EQ(40, s1.at(2));
+}
+
+TEST(FixedUnorderedMap, Iterator_StructuredBinding)
+{
+    FixedUnorderedMap<int, int, 10> s1{{3, 30}, {4, 40}};
+    int sum = 0;
+    for (auto&& [key, value] : s1)
+    {
+        sum += key * value;
+    }
+    EXPECT_EQ(250, sum);
+}
+
+TEST(FixedUnorderedMap, IteratorEndIsStableAcrossMutation)
+{
+    FixedUnorderedMap<int, int, 10> s1{{3, 30}};
+    const auto end = s1.end();
+    s1[4] = 40;
+    EXPECT_EQ(end, s1.end());
+    EXPECT_EQ(end, s1.find(5));
+}
+
+TEST(FixedUnorderedMap, Find)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+
+    static_assert(s1.find(1) == s1.cend());
+    static_assert(s1.find(2) != s1.cend());
+    static_assert(s1.find(2)->second == 20);
+    static_assert(s1.find(4)->second == 40);
+}
+
+TEST(FixedUnorderedMap, MutableFind)
+{
+    FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    auto it = s1.find(2);
+    it->second = 25;
+    EXPECT_EQ(25, s1.at(2));
+}
+
+TEST(FixedUnorderedMap, Find_TransparentHash)
+{
+    using MapType =
+        FixedUnorderedMap<std::string_view, int, 10, TransparentStringViewHash, std::equal_to<>>;
+    constexpr MapType s1{{"a", 1}, {"bb", 2}};
+    constexpr const char* KEY = "bb";
+    static_assert(s1.find(KEY)->second == 2);
+    static_assert(s1.contains(KEY));
+    static_assert(s1.count(KEY) == 1);
+    static_assert(!s1.contains("c"));
+}
+
+TEST(FixedUnorderedMap, Contains)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    static_assert(s1.contains(2));
+    static_assert(!s1.contains(3));
+    static_assert(s1.count(4) == 1);
+    static_assert(s1.count(5) == 0);
+}
+
+TEST(FixedUnorderedMap, StringLiteralKeysComparedByContent)
+{
+    // Same content, different addresses
+    static constexpr char RED_1[] = "red";
+    static constexpr char RED_2[] = "red";
+    FixedUnorderedMap<StringLiteral, int, 10> s1{};
+    s1.try_emplace(StringLiteral{RED_1}, 1);
+    EXPECT_TRUE(s1.contains(StringLiteral{RED_2}));
+    EXPECT_FALSE(s1.try_emplace(StringLiteral{RED_2}, 2).second);
+    EXPECT_EQ(1, s1.at(StringLiteral{RED_2}));
+    EXPECT_EQ(1, s1.size());
+
+    constexpr FixedUnorderedMap<StringLiteral, int, 10> s2{{StringLiteral{RED_1}, 3}};
+    static_assert(s2.contains(StringLiteral{RED_2}));
+}
+
+TEST(FixedUnorderedMap, EqualRange)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{2, 20}, {4, 40}};
+
+    static_assert(std::distance(s1.equal_range(2).first, s1.equal_range(2).second) == 1);
+    static_assert(std::distance(s1.equal_range(3).first, s1.equal_range(3).second) == 0);
+}
+
+TEST(FixedUnorderedMap, Equality)
+{
+    constexpr FixedUnorderedMap<int, int, 10> s1{{1, 10}, {4, 40}};
+    constexpr FixedUnorderedMap<int, int, 11> s2{{4, 40}, {1, 10}};
+    constexpr FixedUnorderedMap<int, int, 10> s3{{1, 10}, {3, 30}};
+    constexpr FixedUnorderedMap<int, int, 10> s4{{1, 10}, {4, 44}};
+
+    static_assert(s1 == s2);
+    static_assert(s2 == s1);
+    static_assert(s1 != s3);
+    static_assert(s1 != s4);
+}
+
+TEST(FixedUnorderedMap, Ranges)
+{
+    FixedUnorderedMap<int, int, 10> s1{{1, 10}, {4, 40}};
+    auto f = s1 | ranges::views::filter([](const auto& v) -> bool { return v.second == 10; });
+
+    EXPECT_EQ(1, ranges::distance(f));
+    int first_entry = (*f.begin()).second;
+    EXPECT_EQ(10, first_entry);
+}
+
+TEST(FixedUnorderedMap, Collisions)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedMap<int, int, 30, ConstantHash> s{};
+        for (int i = 0; i < 30; i++)
+        {
+            s[i] = i * 10;
+        }
+        for (int i = 0; i < 30; i += 3)
+        {
+            s.erase(i);
+        }
+        return s;
+    }();
+
+    static_assert(s1.size() == 20);
+    static_assert(!s1.contains(0));
+    static_assert(s1.at(1) == 10);
+    static_assert(s1.at(29) == 290);
+    static_assert(!s1.contains(27));
+}
+
+TEST(FixedUnorderedMap, TombstonesAreReclaimed)
+{
+    // Churn through many more distinct keys than there are slots, while staying at capacity.
+    FixedUnorderedMap<int, int, 14> s{};
+    for (int i = 0; i < 14; i++)
+    {
+        s[i] = i;
+    }
+    for (int i = 14; i < 2000; i++)
+    {
+        ASSERT_EQ(1, s.erase(i - 14));
+        s[i] = i;
+        ASSERT_EQ(14, s.size());
+        ASSERT_TRUE(s.contains(i - 13));
+        ASSERT_FALSE(s.contains(i - 14));
+    }
+}
+
+TEST(FixedUnorderedMap, RandomizedAgainstStdUnorderedMap)
+{
+    static constexpr std::size_t CAPACITY = 130;
+    FixedUnorderedMap<int, int, CAPACITY> actual{};
+    std::unordered_map<int, int> expected{};
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> key_distribution{0, 300};
+    std::uniform_int_distribution<int> operation_distribution{0, 3};
+    for (int step = 0; step < 20000; step++)
+    {
+        const int key = key_distribution(generator);
+        switch (operation_distribution(generator))
+        {
+        case 0:
+        case 1:
+            if (expected.size() < CAPACITY || expected.contains(key))
+            {
+                expected[key] = step;
+                actual[key] = step;
+            }
+            break;
+        case 2:
+            ASSERT_EQ(expected.erase(key), actual.erase(key));
+            break;
+        default:
+            ASSERT_EQ(expected.contains(key), actual.contains(key));
+            break;
+        }
+        ASSERT_EQ(expected.size(), actual.size());
+    }
+
+    for (const auto& [key, value] : expected)
+    {
+        ASSERT_EQ(value, actual.at(key));
+    }
+    ASSERT_EQ(expected.size(), std::distance(actual.begin(), actual.end()));
+}
+
+TEST(FixedUnorderedMap, ClassTemplateArgumentDeduction)
+{
+    // Compile-only test
+    FixedUnorderedMap a = FixedUnorderedMap<int, int, 5>{};
+    (void)a;
+}
+
+TEST(FixedUnorderedMap, NonDefaultConstructible)
+{
+    {
+        constexpr FixedUnorderedMap<int, MockNonDefaultConstructible, 10> s1{};
+        static_assert(s1.empty());
+    }
+    {
+        FixedUnorderedMap<int, MockNonDefaultConstructible, 10> s2{};
+        s2.emplace(1, 3);
+    }
+}
+
+TEST(FixedUnorderedMap, MoveableButNotCopyable)
+{
+    FixedUnorderedMap<std::string_view, MockMoveableButNotCopyable, 10> s{};
+    s.emplace("", MockMoveableButNotCopyable{});
+    s.emplace("a", MockMoveableButNotCopyable{});
+    s.erase("");
+}
+
+TEST(FixedUnorderedMap, NonAssignable)
+{
+    FixedUnorderedMap<int, MockNonAssignable, 10> s{};
+    s[1];
+    s[2];
+    s[3];
+
+    s.erase(1);
+    EXPECT_EQ(2, s.size());
+}
+
+static constexpr int INT_VALUE_10 = 10;
+static constexpr int INT_VALUE_20 = 20;
+
+TEST(FixedUnorderedMap, ConstRef)
+{
+    constexpr FixedUnorderedMap<int, const int&, 10> s1 = []()
+    {
+        FixedUnorderedMap<int, const int&, 10> s{{1, INT_VALUE_10}};
+        s.insert({2, INT_VALUE_20});
+        s.erase(1);
+
+        auto s_copy = s;
+        s = s_copy;
+        s = std::move(s_copy);
+
+        return s;
+    }();
+
+    static_assert(!s1.contains(1));
+    static_assert(s1.at(2) == INT_VALUE_20);
+}
+
+namespace
+{
+template <FixedUnorderedMap<int, int, 5> /*INSTANCE*/>
+struct FixedUnorderedMapInstanceCanBeUsedAsATemplateParameter
+{
+};
+
+template <FixedUnorderedMap<int, int, 5> INSTANCE>
+constexpr int fixed_unordered_map_instance_can_be_used_as_a_template_parameter()
+{
+    return INSTANCE.at(1);
+}
+}  // namespace
+
+TEST(FixedUnorderedMap, UsageAsTemplateParameter)
+{
+    static constexpr FixedUnorderedMap<int, int, 5> INSTANCE1{{1, 10}};
+    static_assert(fixed_unordered_map_instance_can_be_used_as_a_template_parameter<INSTANCE1>() ==
+                  10);
+    FixedUnorderedMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+namespace
+{
+struct FixedUnorderedMapInstanceCounterUniquenessToken
+{
+};
+
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedUnorderedMapInstanceCounterUniquenessToken>;
+
+using FixedUnorderedMapOfInstanceCounterNonTrivial =
+    FixedUnorderedMap<int, InstanceCounterNonTrivialAssignment, 5>;
+static_assert(!TriviallyCopyAssignable<FixedUnorderedMapOfInstanceCounterNonTrivial>);
+static_assert(!TriviallyMoveAssignable<FixedUnorderedMapOfInstanceCounterNonTrivial>);
+}  // namespace
+
+TEST(FixedUnorderedMap, InstanceCounting)
+{
+    using ItemType = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, ItemType::counter);
+    {
+        FixedUnorderedMapOfInstanceCounterNonTrivial s{};
+        s[1];
+        s[2];
+        s[3];
+        ASSERT_EQ(3, ItemType::counter);
+        s.erase(1);
+        ASSERT_EQ(2, ItemType::counter);
+        {
+            auto s_copy = s;
+            ASSERT_EQ(4, ItemType::counter);
+        }
+        ASSERT_EQ(2, ItemType::counter);
+        s.clear();
+        ASSERT_EQ(0, ItemType::counter);
+    }
+    ASSERT_EQ(0, ItemType::counter);
+}
+
+}  // namespace fixed_containers
+
+namespace another_namespace_unrelated_to_the_fixed_containers_namespace
+{
+TEST(FixedUnorderedMap, ArgumentDependentLookup)
+{
+    // Compile-only test
+    fixed_containers::FixedUnorderedMap<int, int, 5> a{};
+    erase_if(a, [](auto&&) { return true; });
+    is_full(a);
+}
+}  // namespace another_namespace_unrelated_to_the_fixed_containers_namespace
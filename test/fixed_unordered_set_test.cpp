@@ -0,0 +1,367 @@
+#include "fixed_containers/fixed_unordered_set.hpp"
+
+#include "mock_testing_types.hpp"
+#include "test_utilities_common.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/view/filter.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <unordered_set>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedUnorderedSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::forward_iterator<ES_1::iterator>);
+static_assert(std::forward_iterator<ES_1::const_iterator>);
+static_assert(!std::random_access_iterator<ES_1::iterator>);
+
+static_assert(std::is_same_v<std::iter_value_t<ES_1::iterator>, int>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+static_assert(std::is_same_v<typename std::iterator_traits<ES_1::iterator>::pointer, const int*>);
+
+static_assert(ranges::forward_iterator<ES_1::iterator>);
+
+struct TransparentStringViewHash
+{
+    using is_transparent = void;
+    constexpr std::size_t operator()(std::string_view s) const
+    {
+        return Hash<std::string_view>{}(s);
+    }
+};
+
+enum class Direction
+{
+    NORTH,
+    EAST,
+    SOUTH,
+    WEST,
+};
+
+}  // namespace
+
+TEST(FixedUnorderedSet, DefaultConstructor)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{};
+    static_assert(s1.empty());
+}
+
+TEST(FixedUnorderedSet, IteratorConstructor)
+{
+    constexpr std::array INPUT{2, 4};
+    constexpr FixedUnorderedSet<int, 10> s2{INPUT.begin(), INPUT.end()};
+
+    static_assert(s2.size() == 2);
+    static_assert(s2.contains(2));
+    static_assert(s2.contains(4));
+}
+
+TEST(FixedUnorderedSet, Initializer)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{2, 4};
+    static_assert(s1.size() == 2);
+
+    constexpr FixedUnorderedSet<int, 10> s2{3};
+    static_assert(s2.size() == 1);
+}
+
+TEST(FixedUnorderedSet, Find_TransparentHash)
+{
+    constexpr FixedUnorderedSet<std::string_view, 10, TransparentStringViewHash, std::equal_to<>>
+        s{"a", "bb"};
+    constexpr const char* KEY = "bb";
+    static_assert(*s.find(KEY) == "bb");
+    static_assert(s.contains(KEY));
+    static_assert(s.count(KEY) == 1);
+    static_assert(s.find("c") == s.end());
+}
+
+TEST(FixedUnorderedSet, Contains)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{2, 4};
+    static_assert(!s1.contains(1));
+    static_assert(s1.contains(2));
+    static_assert(!s1.contains(3));
+    static_assert(s1.contains(4));
+}
+
+TEST(FixedUnorderedSet, StringLiteralKeysComparedByContent)
+{
+    // Same content, different addresses
+    static constexpr char RED_1[] = "red";
+    static constexpr char RED_2[] = "red";
+    FixedUnorderedSet<StringLiteral, 10> s1{};
+    s1.insert(StringLiteral{RED_1});
+    EXPECT_TRUE(s1.contains(StringLiteral{RED_2}));
+    EXPECT_FALSE(s1.insert(StringLiteral{RED_2}).second);
+    EXPECT_EQ(1, s1.size());
+    s1.erase(StringLiteral{RED_2});
+    EXPECT_TRUE(s1.empty());
+
+    constexpr FixedUnorderedSet<StringLiteral, 10> s2{StringLiteral{RED_1}};
+    static_assert(s2.contains(StringLiteral{RED_2}));
+}
+
+TEST(FixedUnorderedSet, EnumKeys)
+{
+    constexpr FixedUnorderedSet<Direction, 4> s1{Direction::EAST, Direction::WEST};
+    static_assert(s1.contains(Direction::EAST));
+    static_assert(!s1.contains(Direction::NORTH));
+}
+
+TEST(FixedUnorderedSet, EqualRange)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{2, 4};
+    static_assert(std::distance(s1.equal_range(2).first, s1.equal_range(2).second) == 1);
+    static_assert(std::distance(s1.equal_range(3).first, s1.equal_range(3).second) == 0);
+}
+
+TEST(FixedUnorderedSet, MaxSize)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{2, 4};
+    static_assert(s1.max_size() == 10);
+}
+
+TEST(FixedUnorderedSet, EmptySizeFull)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{2, 4};
+    static_assert(s1.size() == 2);
+    static_assert(!s1.empty());
+
+    constexpr FixedUnorderedSet<int, 2> s3{2, 4};
+    static_assert(is_full(s3));
+
+    constexpr FixedUnorderedSet<int, 5> s4{2, 4};
+    static_assert(!is_full(s4));
+}
+
+TEST(FixedUnorderedSet, MaxSizeDeduction)
+{
+    constexpr auto s1 = make_fixed_unordered_set({30, 31});
+    static_assert(s1.size() == 2);
+    static_assert(s1.max_size() == 2);
+    static_assert(s1.contains(30));
+    static_assert(s1.contains(31));
+    static_assert(!s1.contains(32));
+}
+
+TEST(FixedUnorderedSet, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedSet<int, 10> s{};
+        s.insert(2);
+        s.insert(4);
+        auto [it, was_inserted] = s.insert(4);
+        assert_or_abort(!was_inserted);
+        assert_or_abort(*it == 4);
+        s.emplace(6);
+        s.insert(s.cend(), 8);
+        return s;
+    }();
+
+    static_assert(s1.size() == 4);
+    static_assert(s1.contains(2));
+    static_assert(s1.contains(8));
+}
+
+TEST(FixedUnorderedSet, Insert_ExceedsCapacity)
+{
+    FixedUnorderedSet<int, 2> s1{};
+    s1.insert(2);
+    s1.insert(4);
+    s1.insert(4);
+    EXPECT_DEATH(s1.insert(6), "");
+}
+
+TEST(FixedUnorderedSet, Clear)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedSet<int, 10> s{2, 4};
+        s.clear();
+        return s;
+    }();
+
+    static_assert(s1.empty());
+}
+
+TEST(FixedUnorderedSet, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedSet<int, 10> s{2, 4};
+        assert_or_abort(1 == s.erase(2));
+        assert_or_abort(0 == s.erase(3));
+        return s;
+    }();
+
+    static_assert(s1.size() == 1);
+    static_assert(!s1.contains(2));
+    static_assert(s1.contains(4));
+}
+
+TEST(FixedUnorderedSet, EraseIterator)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedSet<int, 10> s{2, 3, 4};
+        auto next = s.erase(s.begin());
+        assert_or_abort(*next == 4);
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.contains(3));
+    static_assert(s1.contains(4));
+}
+
+TEST(FixedUnorderedSet, EraseRange)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedSet<int, 10> s{2, 3, 4, 5};
+        auto next = s.erase(std::next(s.begin()), std::next(s.begin(), 3));
+        assert_or_abort(*next == 5);
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.contains(2));
+    static_assert(s1.contains(5));
+}
+
+TEST(FixedUnorderedSet, EraseIf)
+{
+    constexpr auto s1 = []()
+    {
+        FixedUnorderedSet<int, 10> s{2, 3, 4, 5};
+        const std::size_t removed_count = erase_if(s, [](const int& v) { return v % 2 == 0; });
+        assert_or_abort(2 == removed_count);
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(s1.contains(3));
+    static_assert(s1.contains(5));
+}
+
+TEST(FixedUnorderedSet, IteratorBasic)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{1, 2, 3, 4};
+
+    static_assert(std::distance(s1.cbegin(), s1.cend()) == 4);
+    static_assert(*s1.begin() == 1);
+    static_assert(*std::next(s1.begin(), 3) == 4);
+}
+
+TEST(FixedUnorderedSet, Equality)
+{
+    constexpr FixedUnorderedSet<int, 10> s1{1, 4};
+    constexpr FixedUnorderedSet<int, 11> s2{4, 1};
+    constexpr FixedUnorderedSet<int, 10> s3{1, 3};
+
+    static_assert(s1 == s2);
+    static_assert(s2 == s1);
+    static_assert(s1 != s3);
+}
+
+TEST(FixedUnorderedSet, Ranges)
+{
+    FixedUnorderedSet<int, 10> s1{1, 4};
+    auto f = s1 | ranges::views::filter([](const auto& v) -> bool { return v == 4; });
+
+    EXPECT_EQ(1, ranges::distance(f));
+    EXPECT_EQ(4, *f.begin());
+}
+
+TEST(FixedUnorderedSet, RandomizedAgainstStdUnorderedSet)
+{
+    static constexpr std::size_t CAPACITY = 200;
+    FixedUnorderedSet<std::uint64_t, CAPACITY> actual{};
+    std::unordered_set<std::uint64_t> expected{};
+
+    std::mt19937_64 generator{7};
+    std::uniform_int_distribution<std::uint64_t> key_distribution{0, 500};
+    for (int step = 0; step < 20000; step++)
+    {
+        const std::uint64_t key = key_distribution(generator) << 20;
+        if (step % 3 == 0)
+        {
+            ASSERT_EQ(expected.erase(key), actual.erase(key));
+        }
+        else if (expected.size() < CAPACITY)
+        {
+            ASSERT_EQ(expected.insert(key).second, actual.insert(key).second);
+        }
+        ASSERT_EQ(expected.size(), actual.size());
+    }
+
+    for (const std::uint64_t key : expected)
+    {
+        ASSERT_TRUE(actual.contains(key));
+    }
+}
+
+TEST(FixedUnorderedSet, ClassTemplateArgumentDeduction)
+{
+    // Compile-only test
+    FixedUnorderedSet a = FixedUnorderedSet<int, 5>{};
+    (void)a;
+}
+
+TEST(FixedUnorderedSet, NonTriviallyCopyable)
+{
+    static_assert(NotTriviallyCopyable<FixedUnorderedSet<MockNonTrivialInt, 5>>);
+}
+
+namespace
+{
+template <FixedUnorderedSet<int, 5> /*INSTANCE*/>
+struct FixedUnorderedSetInstanceCanBeUsedAsATemplateParameter
+{
+};
+
+template <FixedUnorderedSet<int, 5> /*INSTANCE*/>
+constexpr void fixed_unordered_set_instance_can_be_used_as_a_template_parameter()
+{
+}
+}  // namespace
+
+TEST(FixedUnorderedSet, UsageAsTemplateParameter)
+{
+    static constexpr FixedUnorderedSet<int, 5> INSTANCE1{};
+    fixed_unordered_set_instance_can_be_used_as_a_template_parameter<INSTANCE1>();
+    FixedUnorderedSetInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
+
+namespace another_namespace_unrelated_to_the_fixed_containers_namespace
+{
+TEST(FixedUnorderedSet, ArgumentDependentLookup)
+{
+    // Compile-only test
+    fixed_containers::FixedUnorderedSet<int, 5> a{};
+    erase_if(a, [](auto&&) { return true; });
+    is_full(a);
+}
+}  // namespace another_namespace_unrelated_to_the_fixed_containers_namespace
@@ -2,6 +2,7 @@
 
 #include "instance_counter.hpp"
 #include "mock_testing_types.hpp"
+#include "sequence_container_test_common.hpp"
 #include "test_utilities_common.hpp"
 
 #include "fixed_containers/concepts.hpp"
@@ -1632,6 +1633,13 @@ TEST(FixedVector, EraseOne)
     EXPECT_TRUE(std::ranges::equal(v2, std::array<int, 3>{{1, 4, 0}}));
 }
 
+// Runtime insertions and erasures shift the tail as a block for trivially copyable types
+using FixedVectorShiftTypes = testing::Types<FixedVector<SequenceContainerShiftEntry, 64>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(FixedVector,
+                               SequenceContainerShiftFixture,
+                               FixedVectorShiftTypes,
+                               NameProviderForTypeParameterizedTest);
+
 TEST(FixedVector, Erase_Empty)
 {
     {
@@ -0,0 +1,229 @@
+#include "fixed_containers/frozen_map.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FrozenMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_reverse_iterator>);
+
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, PairView<const int, const int>>);
+static_assert(std::is_same_v<ES_1::iterator, ES_1::const_iterator>);
+
+constexpr auto FROZEN = freeze(
+    []()
+    {
+        FixedMap<int, int, 10> map{};
+        for (int i = 1; i <= 7; i++)
+        {
+            map.try_emplace(i * 2, i * 20);
+        }
+        return map;
+    }());
+}  // namespace
+
+TEST(FrozenMap, DefaultConstructor)
+{
+    constexpr FrozenMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+    static_assert(s1.begin() == s1.end());
+    static_assert(s1.find(1) == s1.end());
+}
+
+TEST(FrozenMap, Freeze)
+{
+    static_assert(std::is_same_v<const FrozenMap<int, int, 10>, decltype(FROZEN)>);
+    static_assert(FROZEN.size() == 7);
+    static_assert(FROZEN.at(2) == 20);
+    static_assert(FROZEN.at(14) == 140);
+}
+
+TEST(FrozenMap, KeysAreStoredInEytzingerOrder)
+{
+    static_assert(std::ranges::equal(FROZEN.keys(), std::array{8, 4, 12, 2, 6, 10, 14}));
+    static_assert(std::ranges::equal(FROZEN.values(), std::array{80, 40, 120, 20, 60, 100, 140}));
+}
+
+TEST(FrozenMap, FromSortedUnique)
+{
+    constexpr std::array INPUT{std::pair{1, 'a'}, std::pair{2, 'b'}, std::pair{3, 'c'}};
+    constexpr auto s1 = FrozenMap<int, char, 5>::from_sorted_unique(INPUT.begin(), INPUT.end());
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(1) == 'a');
+    static_assert(s1.at(3) == 'c');
+
+    // Works at runtime too
+    const std::map<int, char> std_map{{5, 'e'}, {9, 'i'}};
+    const auto s2 = FrozenMap<int, char, 5>::from_sorted_unique(std_map.begin(), std_map.end());
+    EXPECT_EQ(2, s2.size());
+    EXPECT_EQ('i', s2.at(9));
+}
+
+TEST(FrozenMap, FromSortedUnique_ExceedsCapacity)
+{
+    const std::array input{std::pair{1, 1}, std::pair{2, 2}, std::pair{3, 3}};
+    EXPECT_DEATH(
+        (void)(FrozenMap<int, int, 2>::from_sorted_unique(input.begin(), input.end())), "");
+}
+
+TEST(FrozenMap, At_OutOfRange)
+{
+    EXPECT_DEATH((void)FROZEN.at(3), "");
+}
+
+TEST(FrozenMap, Lookup)
+{
+    static_assert(FROZEN.find(4)->second() == 40);
+    static_assert(FROZEN.find(5) == FROZEN.end());
+    static_assert(FROZEN.contains(2));
+    static_assert(!FROZEN.contains(3));
+    static_assert(FROZEN.count(6) == 1);
+    static_assert(FROZEN.count(7) == 0);
+    static_assert(FROZEN.lower_bound(0)->first() == 2);
+    static_assert(FROZEN.lower_bound(3)->first() == 4);
+    static_assert(FROZEN.lower_bound(4)->first() == 4);
+    static_assert(FROZEN.lower_bound(15) == FROZEN.end());
+    static_assert(FROZEN.upper_bound(4)->first() == 6);
+    static_assert(FROZEN.upper_bound(14) == FROZEN.end());
+
+    static_assert(std::distance(FROZEN.equal_range(4).first, FROZEN.equal_range(4).second) == 1);
+    static_assert(FROZEN.equal_range(5).first == FROZEN.equal_range(5).second);
+    static_assert(FROZEN.equal_range(5).first->first() == 6);
+}
+
+TEST(FrozenMap, Lookup_TransparentComparator)
+{
+    constexpr std::array INPUT{std::pair{MockAComparableToB{1}, 10},
+                               std::pair{MockAComparableToB{3}, 30},
+                               std::pair{MockAComparableToB{5}, 50}};
+    constexpr auto s1 = FrozenMap<MockAComparableToB, int, 5, std::less<>>::from_sorted_unique(
+        INPUT.begin(), INPUT.end());
+    constexpr MockBComparableToA b3{3};
+    constexpr MockBComparableToA b4{4};
+    static_assert(s1.find(b3)->second() == 30);
+    static_assert(s1.find(b4) == s1.end());
+    static_assert(s1.contains(b3));
+    static_assert(s1.count(b4) == 0);
+    static_assert(s1.lower_bound(b4)->first() == MockAComparableToB{5});
+    static_assert(s1.upper_bound(b3)->first() == MockAComparableToB{5});
+    static_assert(std::distance(s1.equal_range(b3).first, s1.equal_range(b3).second) == 1);
+}
+
+TEST(FrozenMap, Iterator)
+{
+    int expected_key = 2;
+    for (const auto& [key, value] : FROZEN)
+    {
+        EXPECT_EQ(expected_key, key);
+        EXPECT_EQ(expected_key * 10, value);
+        expected_key += 2;
+    }
+    EXPECT_EQ(16, expected_key);
+
+    std::vector<int> reversed_keys{};
+    for (auto it = FROZEN.crbegin(); it != FROZEN.crend(); ++it)
+    {
+        reversed_keys.push_back(it->first());
+    }
+    EXPECT_EQ((std::vector<int>{14, 12, 10, 8, 6, 4, 2}), reversed_keys);
+    EXPECT_EQ(FROZEN.begin(), FROZEN.rend().base());
+    EXPECT_EQ(FROZEN.end(), FROZEN.rbegin().base());
+    static_assert(std::prev(FROZEN.end())->first() == 14);
+}
+
+// Every shape of the last level: empty, partially filled from the left, and full
+TEST(FrozenMap, AgreesWithStdMapForEverySize)
+{
+    static constexpr std::size_t CAP = 40;
+    std::vector<std::pair<int, int>> entries{};
+    for (std::size_t size = 0; size <= CAP; size++)
+    {
+        const auto s1 =
+            FrozenMap<int, int, CAP>::from_sorted_unique(entries.begin(), entries.end());
+        const std::map<int, int> expected(entries.begin(), entries.end());
+        ASSERT_EQ(expected.size(), s1.size());
+
+        EXPECT_TRUE(std::ranges::equal(
+            s1, expected, [](const auto& a, const auto& b) { return a.first() == b.first; }));
+        EXPECT_TRUE(std::ranges::equal(
+            s1.crbegin(),
+            s1.crend(),
+            expected.crbegin(),
+            expected.crend(),
+            [](const auto& a, const auto& b) { return a.first() == b.first; }));
+
+        // Keys are odd, so even lookups miss on both sides of every key
+        for (int key = -1; key <= static_cast<int>(2 * CAP + 1); key++)
+        {
+            EXPECT_EQ(expected.contains(key), s1.contains(key));
+            const auto lower = s1.lower_bound(key);
+            const auto expected_lower = expected.lower_bound(key);
+            EXPECT_EQ(expected_lower == expected.end(), lower == s1.end());
+            if (lower != s1.end())
+            {
+                EXPECT_EQ(expected_lower->first, lower->first());
+                EXPECT_EQ(expected_lower->second, lower->second());
+            }
+            const auto upper = s1.upper_bound(key);
+            const auto expected_upper = expected.upper_bound(key);
+            EXPECT_EQ(expected_upper == expected.end(), upper == s1.end());
+            if (upper != s1.end())
+            {
+                EXPECT_EQ(expected_upper->first, upper->first());
+            }
+        }
+
+        const int next_key = static_cast<int>(2 * size + 1);
+        entries.emplace_back(next_key, next_key * 10);
+    }
+}
+
+TEST(FrozenMap, Equality)
+{
+    constexpr std::array INPUT_1{std::pair{1, 10}, std::pair{2, 20}};
+    constexpr std::array INPUT_2{std::pair{1, 10}, std::pair{2, 21}};
+    constexpr auto s1 = FrozenMap<int, int, 10>::from_sorted_unique(INPUT_1.begin(), INPUT_1.end());
+    constexpr auto s2 = FrozenMap<int, int, 5>::from_sorted_unique(INPUT_1.begin(), INPUT_1.end());
+    constexpr auto s3 = FrozenMap<int, int, 10>::from_sorted_unique(INPUT_2.begin(), INPUT_2.end());
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+namespace
+{
+template <FrozenMap<int, int, 10> INSTANCE>
+struct FrozenMapInstanceCanBeUsedAsATemplateParameter
+{
+    static constexpr int VALUE_OF_FOUR = INSTANCE.at(4);
+};
+}  // namespace
+
+TEST(FrozenMap, UsageAsTemplateParameter)
+{
+    static_assert(FrozenMapInstanceCanBeUsedAsATemplateParameter<FROZEN>::VALUE_OF_FOUR == 40);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,122 @@
+#include "fixed_containers/frozen_set.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FrozenSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, const int&>);
+
+constexpr auto FROZEN = freeze(
+    []()
+    {
+        FixedSet<int, 10> set{};
+        for (int i = 1; i <= 5; i++)
+        {
+            set.insert(i * 2);
+        }
+        return set;
+    }());
+}  // namespace
+
+TEST(FrozenSet, DefaultConstructor)
+{
+    constexpr FrozenSet<int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+    static_assert(s1.begin() == s1.end());
+}
+
+TEST(FrozenSet, Freeze)
+{
+    static_assert(std::is_same_v<const FrozenSet<int, 10>, decltype(FROZEN)>);
+    static_assert(FROZEN.size() == 5);
+    // The last level is filled from the left
+    static_assert(std::ranges::equal(FROZEN.keys(), std::array{8, 4, 10, 2, 6}));
+}
+
+TEST(FrozenSet, FromSortedUnique_ExceedsCapacity)
+{
+    const std::array input{1, 2, 3};
+    EXPECT_DEATH((void)(FrozenSet<int, 2>::from_sorted_unique(input.begin(), input.end())), "");
+}
+
+TEST(FrozenSet, Lookup)
+{
+    static_assert(*FROZEN.find(4) == 4);
+    static_assert(FROZEN.find(5) == FROZEN.end());
+    static_assert(FROZEN.contains(2));
+    static_assert(!FROZEN.contains(3));
+    static_assert(FROZEN.count(6) == 1);
+    static_assert(*FROZEN.lower_bound(3) == 4);
+    static_assert(*FROZEN.upper_bound(4) == 6);
+    static_assert(FROZEN.upper_bound(10) == FROZEN.end());
+    static_assert(std::distance(FROZEN.equal_range(4).first, FROZEN.equal_range(4).second) == 1);
+}
+
+TEST(FrozenSet, Lookup_TransparentComparator)
+{
+    constexpr std::array INPUT{MockAComparableToB{1}, MockAComparableToB{3}};
+    constexpr auto s1 = FrozenSet<MockAComparableToB, 5, std::less<>>::from_sorted_unique(
+        INPUT.begin(), INPUT.end());
+    constexpr MockBComparableToA b3{3};
+    static_assert(s1.contains(b3));
+    static_assert(s1.find(MockBComparableToA{2}) == s1.end());
+    static_assert(*s1.lower_bound(MockBComparableToA{2}) == MockAComparableToB{3});
+}
+
+TEST(FrozenSet, AgreesWithStdSetForEverySize)
+{
+    static constexpr std::size_t CAP = 40;
+    std::vector<int> keys{};
+    for (std::size_t size = 0; size <= CAP; size++)
+    {
+        const auto s1 = FrozenSet<int, CAP>::from_sorted_unique(keys.begin(), keys.end());
+        const std::set<int> expected(keys.begin(), keys.end());
+        EXPECT_TRUE(std::ranges::equal(s1, expected));
+        EXPECT_TRUE(
+            std::ranges::equal(s1.crbegin(), s1.crend(), expected.crbegin(), expected.crend()));
+        for (int key = -1; key <= static_cast<int>(2 * CAP + 1); key++)
+        {
+            EXPECT_EQ(expected.contains(key), s1.contains(key));
+            EXPECT_EQ(std::distance(expected.begin(), expected.lower_bound(key)),
+                      std::distance(s1.begin(), s1.lower_bound(key)));
+        }
+        keys.push_back(static_cast<int>(2 * size + 1));
+    }
+}
+
+namespace
+{
+template <FrozenSet<int, 10> INSTANCE>
+struct FrozenSetInstanceCanBeUsedAsATemplateParameter
+{
+    static constexpr bool CONTAINS_SIX = INSTANCE.contains(6);
+};
+}  // namespace
+
+TEST(FrozenSet, UsageAsTemplateParameter)
+{
+    static_assert(FrozenSetInstanceCanBeUsedAsATemplateParameter<FROZEN>::CONTAINS_SIX);
+}
+
+}  // namespace fixed_containers
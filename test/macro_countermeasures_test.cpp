@@ -23,6 +23,8 @@ error: expected unqualified-id if (const auto __len = std::min(__d1, __d2))
 #include "fixed_containers/enum_utils.hpp"
 #include "fixed_containers/fixed_map.hpp"
 #include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/fixed_unordered_set.hpp"
 #include "fixed_containers/fixed_vector.hpp"
 
 namespace fixed_containers
@@ -73,6 +75,14 @@ TEST(MacroCountermeasures, DummyUsagesOfContainers)
         FixedMap<int, int, 5> map{};
         (void)map;
     }
+    {
+        FixedUnorderedSet<int, 5> set{};
+        (void)set;
+    }
+    {
+        FixedUnorderedMap<int, int, 5> map{};
+        (void)map;
+    }
     {
         EnumSet<Color> set{};
         (void)set;
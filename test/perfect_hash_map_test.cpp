@@ -0,0 +1,227 @@
+#include "fixed_containers/perfect_hash_map.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = PerfectHashMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_iterator>);
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, PairView<const int, const int>>);
+
+enum class Opcode : std::uint8_t
+{
+    NOP = 0x00,
+    LOAD = 0x10,
+    STORE = 0x11,
+    JUMP = 0x40,
+    HALT = 0xFF,
+};
+
+// All keys collide in the hash, so no pilot can separate them
+struct ConstantHash
+{
+    constexpr std::size_t operator()(const int& /*key*/) const { return 7; }
+};
+
+}  // namespace
+
+TEST(PerfectHashMap, DefaultConstructor)
+{
+    constexpr PerfectHashMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+    static_assert(!s1.contains(0));
+    static_assert(s1.find(0) == s1.end());
+}
+
+TEST(PerfectHashMap, Initializer)
+{
+    constexpr PerfectHashMap<int, int, 10> s1{{4, 40}, {2, 20}, {7, 70}};
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+    static_assert(s1.at(7) == 70);
+    static_assert(!s1.contains(3));
+}
+
+TEST(PerfectHashMap, MaxSizeDeduction)
+{
+    constexpr auto s1 = make_perfect_hash_map<Opcode, std::string_view>({
+        {Opcode::NOP, "nop"},
+        {Opcode::LOAD, "load"},
+        {Opcode::STORE, "store"},
+        {Opcode::JUMP, "jump"},
+        {Opcode::HALT, "halt"},
+    });
+    static_assert(s1.max_size() == 5);
+    static_assert(s1.at(Opcode::STORE) == "store");
+    static_assert(s1.at(Opcode::HALT) == "halt");
+}
+
+TEST(PerfectHashMap, FromFixedMap)
+{
+    constexpr auto FIXED_MAP = []()
+    {
+        FixedMap<int, char, 26> map{};
+        for (int i = 0; i < 26; i++)
+        {
+            map.try_emplace(i * 1000, static_cast<char>('a' + i));
+        }
+        return map;
+    }();
+    constexpr PerfectHashMap<int, char, 26> s1{FIXED_MAP.begin(), FIXED_MAP.end()};
+    static_assert(s1.size() == 26);
+    static_assert(s1.at(0) == 'a');
+    static_assert(s1.at(25000) == 'z');
+    static_assert(!s1.contains(1));
+}
+
+TEST(PerfectHashMap, StringKeys)
+{
+    constexpr PerfectHashMap<std::string_view, int, 4> s1{
+        {"timeout_ms", 1}, {"retries", 2}, {"verbose", 3}};
+    static_assert(s1.at("retries") == 2);
+    static_assert(!s1.contains("retrie"));
+
+    constexpr PerfectHashMap<StringLiteral, int, 4> s2{
+        {StringLiteral{"red"}, 1}, {StringLiteral{"green"}, 2}, {StringLiteral{"blue"}, 3}};
+    static_assert(s2.at("green") == 2);
+    // Compared by content, not by pointer
+    static constexpr char BLUE[] = "blue";
+    static_assert(s2.at(StringLiteral{BLUE}) == 3);
+
+    using Key = fixed_string_detail::FixedString<16>;
+    constexpr PerfectHashMap<Key, int, 4> s3{{Key{"alpha"}, 1}, {Key{"beta"}, 2}};
+    static_assert(s3.at(Key{"beta"}) == 2);
+    static_assert(!s3.contains(Key{"gamma"}));
+}
+
+TEST(PerfectHashMap, At_OutOfRange)
+{
+    const PerfectHashMap<int, int, 10> s1{{2, 20}};
+    EXPECT_DEATH((void)s1.at(3), "");
+}
+
+TEST(PerfectHashMap, ExceedsCapacity)
+{
+    const std::array input{std::pair{1, 1}, std::pair{2, 2}, std::pair{3, 3}};
+    EXPECT_DEATH((void)(PerfectHashMap<int, int, 2>{input.begin(), input.end()}), "");
+}
+
+TEST(PerfectHashMap, DuplicateKey)
+{
+    // Would not compile as a constant expression
+    const std::array input{std::pair{1, 1}, std::pair{2, 2}, std::pair{1, 3}};
+    EXPECT_DEATH((void)(PerfectHashMap<int, int, 10>{input.begin(), input.end()}), "");
+}
+
+TEST(PerfectHashMap, HashCollision)
+{
+    const std::array input{std::pair{1, 1}, std::pair{2, 2}};
+    EXPECT_DEATH(
+        (void)(PerfectHashMap<int, int, 10, ConstantHash>{input.begin(), input.end()}), "");
+}
+
+TEST(PerfectHashMap, Iterator)
+{
+    constexpr PerfectHashMap<int, int, 10> s1{{3, 30}, {1, 10}, {2, 20}};
+    std::vector<int> keys{};
+    for (const auto& [key, value] : s1)
+    {
+        EXPECT_EQ(key * 10, value);
+        keys.push_back(key);
+    }
+    // Construction order
+    EXPECT_EQ((std::vector<int>{3, 1, 2}), keys);
+
+    std::vector<int> reversed_keys{};
+    for (auto it = s1.crbegin(); it != s1.crend(); ++it)
+    {
+        reversed_keys.push_back(it->first());
+    }
+    EXPECT_EQ((std::vector<int>{2, 1, 3}), reversed_keys);
+    static_assert(std::distance(s1.begin(), s1.end()) == 3);
+    static_assert(s1.find(1)->second() == 10);
+}
+
+TEST(PerfectHashMap, AgreesWithStdUnorderedMap)
+{
+    static constexpr std::size_t CAP = 1000;
+    for (const std::size_t size : {std::size_t{1}, std::size_t{7}, std::size_t{64}, CAP})
+    {
+        std::vector<std::pair<std::int64_t, std::int64_t>> entries{};
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto key = static_cast<std::int64_t>(i * i * 31);
+            entries.emplace_back(key, -key);
+        }
+        // Does not fit on the stack together with the temporaries of the construction
+        const auto s1 = std::make_unique<PerfectHashMap<std::int64_t, std::int64_t, CAP>>(
+            entries.begin(), entries.end());
+        const std::unordered_map<std::int64_t, std::int64_t> expected(entries.begin(),
+                                                                      entries.end());
+        ASSERT_EQ(expected.size(), s1->size());
+        // Keys are multiples of 31, so their neighbours are misses
+        for (const auto& [present_key, _] : entries)
+        {
+            for (const std::int64_t key : {present_key - 1, present_key, present_key + 1})
+            {
+                const auto it = s1->find(key);
+                ASSERT_EQ(expected.contains(key), it != s1->end());
+                if (it != s1->end())
+                {
+                    EXPECT_EQ(expected.at(key), it->second());
+                }
+            }
+        }
+    }
+}
+
+TEST(PerfectHashMap, Equality)
+{
+    constexpr PerfectHashMap<int, int, 10> s1{{1, 10}, {2, 20}};
+    constexpr PerfectHashMap<int, int, 5> s2{{2, 20}, {1, 10}};
+    constexpr PerfectHashMap<int, int, 10> s3{{1, 10}, {2, 21}};
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+namespace
+{
+template <PerfectHashMap<int, int, 10> INSTANCE>
+struct PerfectHashMapInstanceCanBeUsedAsATemplateParameter
+{
+    static constexpr int VALUE_OF_FOUR = INSTANCE.at(4);
+};
+}  // namespace
+
+TEST(PerfectHashMap, UsageAsTemplateParameter)
+{
+    static constexpr PerfectHashMap<int, int, 10> INSTANCE1{{4, 40}, {5, 50}};
+    static_assert(PerfectHashMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1>::VALUE_OF_FOUR ==
+                  40);
+}
+
+}  // namespace fixed_containers
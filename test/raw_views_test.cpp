@@ -0,0 +1,169 @@
+#include "fixed_containers/raw_views.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_set.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using rich_enums::TestEnum1;
+
+struct alignas(16) OverAligned
+{
+    std::int32_t x;
+    std::array<std::int8_t, 7> y;
+};
+
+// 70 constants, so the presence bits span two words
+enum class LargeEnum
+{
+    // clang-format off
+    E00, E01, E02, E03, E04, E05, E06, E07, E08, E09,
+    E10, E11, E12, E13, E14, E15, E16, E17, E18, E19,
+    E20, E21, E22, E23, E24, E25, E26, E27, E28, E29,
+    E30, E31, E32, E33, E34, E35, E36, E37, E38, E39,
+    E40, E41, E42, E43, E44, E45, E46, E47, E48, E49,
+    E50, E51, E52, E53, E54, E55, E56, E57, E58, E59,
+    E60, E61, E62, E63, E64, E65, E66, E67, E68, E69,
+    // clang-format on
+};
+
+template <class T>
+const void* address_of(const T& value)
+{
+    return static_cast<const void*>(&value);
+}
+
+}  // namespace
+
+TEST(RawViews, FixedVector)
+{
+    using FixedVectorType = FixedVector<int, 10>;
+    const FixedVectorType v1{3, 1, 4, 1, 5};
+
+    const FixedVectorRawView view(&v1,
+                                  sizeof(FixedVectorType::value_type),
+                                  alignof(FixedVectorType::value_type),
+                                  FixedVectorType::max_size());
+
+    EXPECT_EQ(v1.size(), view.size());
+    EXPECT_EQ(10, view.max_size());
+    EXPECT_EQ(address_of(*v1.data()), view.data());
+    for (std::size_t i = 0; i < v1.size(); i++)
+    {
+        EXPECT_EQ(address_of(v1[i]), view.at(i));
+        EXPECT_EQ(v1[i], *reinterpret_cast<const int*>(view.at(i)));
+    }
+}
+
+TEST(RawViews, FixedVectorWithOverAlignedElements)
+{
+    using FixedVectorType = FixedVector<OverAligned, 4>;
+    FixedVectorType v1{};
+    v1.push_back({1, {}});
+    v1.push_back({2, {}});
+
+    const FixedVectorRawView view(&v1,
+                                  sizeof(FixedVectorType::value_type),
+                                  alignof(FixedVectorType::value_type),
+                                  FixedVectorType::max_size());
+
+    EXPECT_EQ(2, view.size());
+    EXPECT_EQ(address_of(v1[0]), view.at(0));
+    EXPECT_EQ(address_of(v1[1]), view.at(1));
+    EXPECT_EQ(2, reinterpret_cast<const OverAligned*>(view.at(1))->x);
+}
+
+TEST(RawViews, FixedString)
+{
+    using FixedStringType = fixed_string_detail::FixedString<16>;
+    const FixedStringType s1{"raw view"};
+
+    const FixedStringRawView view(&s1, s1.max_size());
+
+    EXPECT_EQ(8, view.size());
+    EXPECT_EQ(16, view.max_size());
+    EXPECT_EQ(address_of(*s1.data()), view.data());
+    EXPECT_EQ(std::string_view{"raw view"}, view.as_string_view());
+    // Null-terminated
+    EXPECT_EQ('\0', view.data()[view.size()]);
+}
+
+TEST(RawViews, EnumSet)
+{
+    using EnumSetType = EnumSet<TestEnum1>;
+    const EnumSetType s1{TestEnum1::TWO, TestEnum1::FOUR};
+
+    const EnumSetRawView view(&s1, EnumSetType::max_size());
+
+    EXPECT_EQ(2, view.size());
+    EXPECT_EQ(4, view.max_size());
+    EXPECT_FALSE(view.contains(0));
+    EXPECT_TRUE(view.contains(1));
+    EXPECT_FALSE(view.contains(2));
+    EXPECT_TRUE(view.contains(3));
+}
+
+TEST(RawViews, EnumSetWithMultipleWords)
+{
+    using EnumSetType = EnumSet<LargeEnum>;
+    const EnumSetType s1{LargeEnum::E00, LargeEnum::E63, LargeEnum::E64, LargeEnum::E69};
+
+    const EnumSetRawView view(&s1, EnumSetType::max_size());
+
+    EXPECT_EQ(4, view.size());
+    EXPECT_EQ(70, view.max_size());
+    for (std::size_t i = 0; i < view.max_size(); i++)
+    {
+        EXPECT_EQ(s1.contains(static_cast<LargeEnum>(i)), view.contains(i));
+    }
+}
+
+TEST(RawViews, EnumMap)
+{
+    using EnumMapType = EnumMap<TestEnum1, std::int16_t>;
+    const EnumMapType m1{{TestEnum1::ONE, 10}, {TestEnum1::THREE, 30}};
+
+    const EnumMapRawView view(&m1, sizeof(EnumMapType::mapped_type), EnumMapType::max_size());
+
+    EXPECT_EQ(2, view.size());
+    EXPECT_EQ(4, view.max_size());
+    EXPECT_EQ(address_of(m1.at(TestEnum1::ONE)), view.value_at(0));
+    EXPECT_EQ(address_of(m1.at(TestEnum1::THREE)), view.value_at(2));
+    EXPECT_EQ(nullptr, view.value_at(1));
+    EXPECT_EQ(nullptr, view.value_at(3));
+    EXPECT_EQ(30, *reinterpret_cast<const std::int16_t*>(view.value_at(2)));
+}
+
+TEST(RawViews, EnumMapWithOverAlignedValuesAndMultipleWords)
+{
+    using EnumMapType = EnumMap<LargeEnum, OverAligned>;
+    EnumMapType m1{};
+    m1[LargeEnum::E05] = {5, {}};
+    m1[LargeEnum::E66] = {66, {}};
+
+    const EnumMapRawView view(&m1, sizeof(EnumMapType::mapped_type), EnumMapType::max_size());
+
+    EXPECT_EQ(2, view.size());
+    for (std::size_t i = 0; i < view.max_size(); i++)
+    {
+        const auto key = static_cast<LargeEnum>(i);
+        EXPECT_EQ(m1.contains(key), view.contains(i));
+        EXPECT_EQ(m1.contains(key) ? address_of(m1.at(key)) : nullptr, view.value_at(i));
+    }
+    EXPECT_EQ(66, reinterpret_cast<const OverAligned*>(view.value_at(66))->x);
+}
+
+}  // namespace fixed_containers
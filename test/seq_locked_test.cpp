@@ -0,0 +1,160 @@
+#include "fixed_containers/seq_locked.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using MapType = FixedMap<int, std::uint64_t, 32>;
+using SeqLockedMap = SeqLocked<MapType>;
+static_assert(NotCopyConstructible<SeqLockedMap>);
+static_assert(NotMoveAssignable<SeqLockedMap>);
+
+struct NoDefaultConstructor
+{
+    constexpr explicit NoDefaultConstructor(int v)
+      : value{v}
+    {
+    }
+    int value;
+};
+
+// Not a multiple of the word size
+struct OddSize
+{
+    std::array<std::uint8_t, 13> bytes;
+};
+}  // namespace
+
+TEST(SeqLocked, DefaultConstructor)
+{
+    const SeqLocked<FixedVector<int, 5>> s1{};
+    EXPECT_TRUE(s1.load().empty());
+    EXPECT_EQ(1, s1.version());
+}
+
+TEST(SeqLocked, InitialValue)
+{
+    const SeqLocked<MapType> s1{MapType{{1, 10}, {2, 20}}};
+    EXPECT_EQ(20, s1.read([](const MapType& map) { return map.at(2); }));
+    EXPECT_EQ((MapType{{1, 10}, {2, 20}}), s1.load());
+
+    const SeqLocked<NoDefaultConstructor> s2{NoDefaultConstructor{7}};
+    EXPECT_EQ(7, s2.load().value);
+}
+
+TEST(SeqLocked, Update)
+{
+    SeqLocked<MapType> s1{};
+    s1.update([](MapType& map) { map[1] = 10; });
+    EXPECT_EQ(2, s1.version());
+    const bool inserted = s1.update([](MapType& map) { return map.try_emplace(2, 20).second; });
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(3, s1.version());
+    EXPECT_EQ((MapType{{1, 10}, {2, 20}}), s1.load());
+
+    s1.store(MapType{{3, 30}});
+    EXPECT_EQ(4, s1.version());
+    EXPECT_EQ((MapType{{3, 30}}), s1.load());
+}
+
+TEST(SeqLocked, SizeNotMultipleOfWord)
+{
+    OddSize value{};
+    for (std::size_t i = 0; i < value.bytes.size(); i++)
+    {
+        value.bytes[i] = static_cast<std::uint8_t>(i + 1);
+    }
+    SeqLocked<OddSize> s1{value};
+    EXPECT_EQ(value.bytes, s1.load().bytes);
+    s1.update([](OddSize& v) { v.bytes.back() = 0xFF; });
+    EXPECT_EQ(0xFF, s1.load().bytes.back());
+    EXPECT_EQ(value.bytes[0], s1.load().bytes[0]);
+}
+
+TEST(SeqLocked, ReadersNeverObserveTornUpdates)
+{
+    // Every update rewrites all the entries with the same value, so any snapshot where the values
+    // differ was torn
+    static constexpr int ENTRY_COUNT = 32;
+    static constexpr std::uint64_t UPDATE_COUNT = 20000;
+    static constexpr std::size_t READER_COUNT = 4;
+
+    auto s1 = std::make_unique<SeqLockedMap>();
+    s1->update(
+        [](MapType& map)
+        {
+            for (int i = 0; i < ENTRY_COUNT; i++)
+            {
+                map[i] = 0;
+            }
+        });
+
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> torn_count{0};
+    std::vector<std::thread> readers{};
+    for (std::size_t r = 0; r < READER_COUNT; r++)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                std::uint64_t last_seen = 0;
+                while (!done.load(std::memory_order_acquire))
+                {
+                    s1->read(
+                        [&](const MapType& map)
+                        {
+                            const std::uint64_t first = map.begin()->second;
+                            for (const auto& [key, value] : map)
+                            {
+                                if (value != first)
+                                {
+                                    torn_count++;
+                                }
+                            }
+                            // Updates are observed in order
+                            if (first < last_seen || map.size() != ENTRY_COUNT)
+                            {
+                                torn_count++;
+                            }
+                            last_seen = first;
+                        });
+                }
+            });
+    }
+
+    for (std::uint64_t u = 1; u <= UPDATE_COUNT; u++)
+    {
+        s1->update(
+            [u](MapType& map)
+            {
+                for (auto&& [key, value] : map)
+                {
+                    value = u;
+                }
+            });
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, torn_count.load());
+    EXPECT_EQ(UPDATE_COUNT, s1->load().at(0));
+}
+
+}  // namespace fixed_containers
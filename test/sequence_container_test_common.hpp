@@ -0,0 +1,66 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace fixed_containers
+{
+// Tests shared by the sequence containers (FixedVector, FixedDeque). Each test file instantiates
+// them with its own container types:
+//   INSTANTIATE_TYPED_TEST_SUITE_P(
+//       FixedVector, SequenceContainerShiftFixture, testing::Types<...>, ...);
+struct SequenceContainerShiftEntry
+{
+    int a;
+    double b;
+    constexpr bool operator==(const SequenceContainerShiftEntry&) const = default;
+};
+static_assert(TriviallyCopyable<SequenceContainerShiftEntry>);
+
+template <typename T>
+struct SequenceContainerShiftFixture : public ::testing::Test
+{
+};
+TYPED_TEST_SUITE_P(SequenceContainerShiftFixture);
+
+// Runtime insertions and erasures shift the tail as a block for trivially copyable types
+TYPED_TEST_P(SequenceContainerShiftFixture, InsertAndEraseInTheMiddle_MatchesStdVector)
+{
+    using ContainerType = TypeParam;
+    using Entry = typename ContainerType::value_type;
+
+    ContainerType actual{};
+    std::vector<Entry> expected{};
+    for (int i = 0; i < 40; i++)
+    {
+        const auto offset = static_cast<std::ptrdiff_t>((i * 7) % (expected.size() + 1));
+        // Through the initializer_list overload, which both containers have
+        actual.insert(actual.begin() + offset, {Entry{i, i * 0.5}});
+        expected.insert(expected.begin() + offset, Entry{i, i * 0.5});
+    }
+    EXPECT_TRUE(std::ranges::equal(actual, expected));
+
+    const std::array<Entry, 3> more{Entry{100, 1.0}, Entry{101, 2.0}, Entry{102, 3.0}};
+    actual.insert(actual.begin() + 5, more.begin(), more.end());
+    expected.insert(expected.begin() + 5, more.begin(), more.end());
+    EXPECT_TRUE(std::ranges::equal(actual, expected));
+
+    while (expected.size() > 3)
+    {
+        const auto offset = static_cast<std::ptrdiff_t>(expected.size() / 3);
+        actual.erase(actual.begin() + offset, actual.begin() + offset + 2);
+        expected.erase(expected.begin() + offset, expected.begin() + offset + 2);
+        EXPECT_TRUE(std::ranges::equal(actual, expected));
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SequenceContainerShiftFixture,
+                            InsertAndEraseInTheMiddle_MatchesStdVector);
+
+}  // namespace fixed_containers
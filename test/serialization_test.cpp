@@ -0,0 +1,266 @@
+#include "fixed_containers/serialization.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_set.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using rich_enums::TestEnum1;
+
+using VectorType = FixedVector<int, 10>;
+using DequeType = FixedDeque<int, 10>;
+using StringType = fixed_string_detail::FixedString<16>;
+using EnumMapType = EnumMap<TestEnum1, int>;
+using EnumSetType = EnumSet<TestEnum1>;
+using MapType = FixedMap<int, int, 10>;
+using SetType = FixedSet<int, 10>;
+
+static_assert(ZeroCopySerializable<VectorType>);
+static_assert(ZeroCopySerializable<DequeType>);
+static_assert(ZeroCopySerializable<StringType>);
+static_assert(ZeroCopySerializable<EnumMapType>);
+static_assert(ZeroCopySerializable<EnumSetType>);
+static_assert(ZeroCopySerializable<MapType>);
+static_assert(ZeroCopySerializable<SetType>);
+static_assert(!ZeroCopySerializable<int>);
+static_assert(!ZeroCopySerializable<std::array<int, 10>>);
+
+static_assert(serialized_payload_offset<VectorType>() == sizeof(SerializedHeader));
+static_assert(serialized_size_bytes<VectorType>() == sizeof(SerializedHeader) + sizeof(VectorType));
+
+struct alignas(128) OverAligned
+{
+    int value;
+};
+static_assert(serialized_payload_offset<FixedVector<OverAligned, 2>>() == 128);
+static_assert(serialized_alignment<FixedVector<OverAligned, 2>>() == 128);
+
+template <class T>
+struct Buffer
+{
+    alignas(serialized_alignment<T>()) std::array<std::byte, serialized_size_bytes<T>()> bytes{};
+
+    [[nodiscard]] std::span<std::byte> span() { return bytes; }
+};
+
+template <class T>
+const T* round_trip(const T& container, Buffer<T>& buffer)
+{
+    EXPECT_EQ(SerializationStatus::OK, serialize_to(container, buffer.span()));
+    EXPECT_EQ(SerializationStatus::OK, validate_serialized<T>(buffer.span()));
+    const T* view = view_from<T>(buffer.span());
+    // In place, not a copy
+    EXPECT_EQ(static_cast<const void*>(buffer.bytes.data() + serialized_payload_offset<T>()),
+              static_cast<const void*>(view));
+    return view;
+}
+
+}  // namespace
+
+TEST(Serialization, Header)
+{
+    constexpr SerializedHeader HEADER = serialized_header_for<MapType>();
+    static_assert(std::string_view{HEADER.magic.data()} == "FXCNTNR");
+    static_assert(HEADER.size_bytes == sizeof(MapType));
+    static_assert(HEADER.alignment_bytes == alignof(MapType));
+    static_assert(HEADER.capacity == 10);
+    static_assert(HEADER.storage_policy != 0);
+    using fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    static_assert(HEADER.compactness ==
+                  static_cast<std::uint8_t>(RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR));
+
+    static_assert(serialized_header_for<VectorType>().compactness == 0xFF);
+    static_assert(serialized_header_for<VectorType>().storage_policy == 0);
+    static_assert(serialized_header_for<EnumSetType>().capacity == 4);
+}
+
+TEST(Serialization, FixedVector)
+{
+    const VectorType v1{1, 2, 3};
+    Buffer<VectorType> buffer{};
+    const VectorType* view = round_trip(v1, buffer);
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(v1, *view);
+}
+
+TEST(Serialization, FixedDeque)
+{
+    // Start the deque away from the front of its storage
+    DequeType v1{0, 1, 2};
+    v1.erase(v1.begin());
+    v1.push_back(3);
+    Buffer<DequeType> buffer{};
+    const DequeType* view = round_trip(v1, buffer);
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(v1, *view);
+    EXPECT_EQ(1, view->front());
+    EXPECT_EQ(3, view->back());
+}
+
+TEST(Serialization, FixedString)
+{
+    const StringType v1{"hello"};
+    Buffer<StringType> buffer{};
+    const StringType* view = round_trip(v1, buffer);
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(std::string_view{"hello"}, std::string_view{*view});
+}
+
+TEST(Serialization, EnumMapAndEnumSet)
+{
+    const EnumMapType v1{{TestEnum1::ONE, 10}, {TestEnum1::FOUR, 40}};
+    Buffer<EnumMapType> map_buffer{};
+    const EnumMapType* map_view = round_trip(v1, map_buffer);
+    ASSERT_NE(nullptr, map_view);
+    EXPECT_EQ(v1, *map_view);
+    EXPECT_EQ(40, map_view->at(TestEnum1::FOUR));
+
+    const EnumSetType v2{TestEnum1::TWO, TestEnum1::THREE};
+    Buffer<EnumSetType> set_buffer{};
+    const EnumSetType* set_view = round_trip(v2, set_buffer);
+    ASSERT_NE(nullptr, set_view);
+    EXPECT_EQ(v2, *set_view);
+}
+
+TEST(Serialization, FixedMapAndFixedSet)
+{
+    const MapType v1{{3, 30}, {1, 10}, {2, 20}};
+    Buffer<MapType> map_buffer{};
+    const MapType* map_view = round_trip(v1, map_buffer);
+    ASSERT_NE(nullptr, map_view);
+    EXPECT_EQ(v1, *map_view);
+    EXPECT_EQ(20, map_view->at(2));
+    EXPECT_EQ(1, map_view->begin()->first);
+
+    const SetType v2{5, 4, 6};
+    Buffer<SetType> set_buffer{};
+    const SetType* set_view = round_trip(v2, set_buffer);
+    ASSERT_NE(nullptr, set_view);
+    EXPECT_EQ(v2, *set_view);
+    EXPECT_TRUE(set_view->contains(4));
+}
+
+TEST(Serialization, BufferTooSmall)
+{
+    const VectorType v1{1, 2, 3};
+    Buffer<VectorType> buffer{};
+    const std::span<std::byte> short_span = buffer.span().first(buffer.bytes.size() - 1);
+    EXPECT_EQ(SerializationStatus::BUFFER_TOO_SMALL, serialize_to(v1, short_span));
+
+    ASSERT_EQ(SerializationStatus::OK, serialize_to(v1, buffer.span()));
+    EXPECT_EQ(SerializationStatus::BUFFER_TOO_SMALL, validate_serialized<VectorType>(short_span));
+    EXPECT_EQ(nullptr, view_from<VectorType>(short_span));
+}
+
+TEST(Serialization, MisalignedBuffer)
+{
+    const VectorType v1{1, 2, 3};
+    struct
+    {
+        alignas(serialized_alignment<VectorType>())
+            std::array<std::byte, serialized_size_bytes<VectorType>() + 1> bytes;
+    } buffer{};
+    const std::span<std::byte> misaligned = std::span{buffer.bytes}.subspan(1);
+    // Writing only copies bytes, so any buffer is fine
+    ASSERT_EQ(SerializationStatus::OK, serialize_to(v1, misaligned));
+    EXPECT_EQ(SerializationStatus::MISALIGNED_BUFFER, validate_serialized<VectorType>(misaligned));
+    EXPECT_EQ(nullptr, view_from<VectorType>(misaligned));
+}
+
+TEST(Serialization, NotSerializedData)
+{
+    Buffer<VectorType> buffer{};
+    EXPECT_EQ(SerializationStatus::NOT_SERIALIZED_DATA,
+              validate_serialized<VectorType>(buffer.span()));
+}
+
+TEST(Serialization, HeaderFieldMismatch)
+{
+    const VectorType v1{1, 2, 3};
+    Buffer<VectorType> buffer{};
+
+    const auto status_with_header = [&](const std::function<void(SerializedHeader&)>& modify)
+    {
+        EXPECT_EQ(SerializationStatus::OK, serialize_to(v1, buffer.span()));
+        SerializedHeader header{};
+        std::memcpy(&header, buffer.bytes.data(), sizeof(header));
+        modify(header);
+        std::memcpy(buffer.bytes.data(), &header, sizeof(header));
+        return validate_serialized<VectorType>(buffer.span());
+    };
+
+    EXPECT_EQ(SerializationStatus::ENDIANNESS_MISMATCH,
+              status_with_header([](SerializedHeader& h) { h.endianness_marker = 0x04030201; }));
+    EXPECT_EQ(SerializationStatus::UNSUPPORTED_FORMAT_VERSION,
+              status_with_header([](SerializedHeader& h) { h.format_version++; }));
+    EXPECT_EQ(SerializationStatus::LAYOUT_MISMATCH,
+              status_with_header([](SerializedHeader& h) { h.capacity++; }));
+    EXPECT_EQ(SerializationStatus::OK, status_with_header([](SerializedHeader& /*h*/) {}));
+}
+
+TEST(Serialization, LayoutMismatch)
+{
+    const VectorType v1{1, 2, 3};
+    Buffer<VectorType> buffer{};
+    ASSERT_EQ(SerializationStatus::OK, serialize_to(v1, buffer.span()));
+
+    // Same size, different element type
+    using OtherElement = FixedVector<unsigned, 10>;
+    static_assert(sizeof(OtherElement) == sizeof(VectorType));
+    EXPECT_EQ(SerializationStatus::LAYOUT_MISMATCH,
+              validate_serialized<OtherElement>(buffer.span()));
+    // Different capacity
+    using OtherCapacity = FixedVector<int, 5>;
+    EXPECT_EQ(SerializationStatus::LAYOUT_MISMATCH,
+              validate_serialized<OtherCapacity>(buffer.span()));
+}
+
+TEST(Serialization, TreeLayoutMismatch)
+{
+    const MapType v1{{1, 10}};
+    Buffer<MapType> buffer{};
+    ASSERT_EQ(SerializationStatus::OK, serialize_to(v1, buffer.span()));
+
+    using DedicatedColor =
+        FixedMap<int,
+                 int,
+                 10,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::DEDICATED_COLOR>;
+    EXPECT_EQ(SerializationStatus::LAYOUT_MISMATCH,
+              validate_serialized<DedicatedColor>(buffer.span()));
+
+    using ContiguousStorage =
+        FixedMap<int,
+                 int,
+                 10,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedContiguousStorage>;
+    static_assert(serialized_header_for<ContiguousStorage>().storage_policy !=
+                  serialized_header_for<MapType>().storage_policy);
+    EXPECT_EQ(SerializationStatus::LAYOUT_MISMATCH,
+              validate_serialized<ContiguousStorage>(buffer.span()));
+}
+
+}  // namespace fixed_containers
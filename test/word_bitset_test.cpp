@@ -0,0 +1,174 @@
+#include "fixed_containers/word_bitset.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <cstddef>
+#include <random>
+
+namespace fixed_containers::word_bitset_detail
+{
+namespace
+{
+static_assert(TriviallyCopyable<WordBitset<130>>);
+static_assert(StandardLayout<WordBitset<130>>);
+static_assert(IsStructuralType<WordBitset<130>>);
+static_assert(sizeof(WordBitset<64>) == 8);
+static_assert(sizeof(WordBitset<65>) == 16);
+
+template <std::size_t BIT_COUNT>
+constexpr WordBitset<BIT_COUNT> make_bitset(std::initializer_list<std::size_t> indices)
+{
+    WordBitset<BIT_COUNT> out{};
+    for (const std::size_t i : indices)
+    {
+        out.set(i);
+    }
+    return out;
+}
+}  // namespace
+
+TEST(WordBitset, SetTestReset)
+{
+    constexpr auto b = []()
+    {
+        auto out = make_bitset<130>({0, 63, 64, 129});
+        out.reset(63);
+        return out;
+    }();
+
+    static_assert(b.test(0));
+    static_assert(!b.test(63));
+    static_assert(b.test(64));
+    static_assert(b.test(129));
+    static_assert(!b.test(128));
+    static_assert(b.count() == 3);
+    static_assert(!b.none());
+    static_assert(WordBitset<130>{}.none());
+}
+
+TEST(WordBitset, SetAllAndFlipAll)
+{
+    constexpr auto all = []()
+    {
+        WordBitset<130> out{};
+        out.set_all();
+        return out;
+    }();
+    static_assert(all.count() == 130);
+
+    constexpr auto flipped = []()
+    {
+        auto out = make_bitset<130>({1, 127});
+        out.flip_all();
+        return out;
+    }();
+    // Bits past BIT_COUNT must stay clear
+    static_assert(flipped.count() == 128);
+    static_assert(!flipped.test(1));
+    static_assert(flipped.test(129));
+    static_assert(flipped.find_first_at_or_after(128) == 128);
+}
+
+TEST(WordBitset, FindFirstAtOrAfter)
+{
+    constexpr auto b = make_bitset<200>({3, 64, 199});
+    static_assert(b.find_first_at_or_after(0) == 3);
+    static_assert(b.find_first_at_or_after(3) == 3);
+    static_assert(b.find_first_at_or_after(4) == 64);
+    static_assert(b.find_first_at_or_after(65) == 199);
+    static_assert(b.find_first_at_or_after(200) == 200);
+    static_assert(WordBitset<200>{}.find_first_at_or_after(0) == 200);
+}
+
+TEST(WordBitset, FindLastAtOrBefore)
+{
+    constexpr auto b = make_bitset<200>({3, 64, 199});
+    static_assert(b.find_last_at_or_before(199) == 199);
+    static_assert(b.find_last_at_or_before(198) == 64);
+    static_assert(b.find_last_at_or_before(64) == 64);
+    static_assert(b.find_last_at_or_before(63) == 3);
+    static_assert(b.find_last_at_or_before(2) == WordBitset<200>::NO_INDEX);
+    static_assert(b.find_last_at_or_before(WordBitset<200>::NO_INDEX) == WordBitset<200>::NO_INDEX);
+    static_assert(WordBitset<0>{}.find_last_at_or_before(0) == WordBitset<0>::NO_INDEX);
+}
+
+TEST(WordBitset, SetOperations)
+{
+    constexpr auto a = make_bitset<100>({1, 2, 70});
+    constexpr auto b = make_bitset<100>({2, 70, 99});
+
+    constexpr auto u = [&]()
+    {
+        auto out = a;
+        out.union_with(b);
+        return out;
+    }();
+    static_assert(u == make_bitset<100>({1, 2, 70, 99}));
+
+    constexpr auto i = [&]()
+    {
+        auto out = a;
+        out.intersect_with(b);
+        return out;
+    }();
+    static_assert(i == make_bitset<100>({2, 70}));
+
+    constexpr auto d = [&]()
+    {
+        auto out = a;
+        out.subtract(b);
+        return out;
+    }();
+    static_assert(d == make_bitset<100>({1}));
+
+    static_assert(i.is_subset_of(a));
+    static_assert(i.is_subset_of(b));
+    static_assert(!a.is_subset_of(b));
+    static_assert(WordBitset<100>{}.is_subset_of(a));
+}
+
+TEST(WordBitset, RandomizedAgainstStdBitset)
+{
+    static constexpr std::size_t BIT_COUNT = 300;
+    WordBitset<BIT_COUNT> actual{};
+    std::bitset<BIT_COUNT> expected{};
+
+    std::mt19937 generator{3};
+    std::uniform_int_distribution<std::size_t> distribution{0, BIT_COUNT - 1};
+    for (int step = 0; step < 2000; step++)
+    {
+        const std::size_t i = distribution(generator);
+        if (step % 3 == 0)
+        {
+            actual.reset(i);
+            expected.reset(i);
+        }
+        else
+        {
+            actual.set(i);
+            expected.set(i);
+        }
+        ASSERT_EQ(expected.count(), actual.count());
+
+        const std::size_t from = distribution(generator);
+        std::size_t expected_next = from;
+        while (expected_next < BIT_COUNT && !expected.test(expected_next))
+        {
+            expected_next++;
+        }
+        ASSERT_EQ(expected_next, actual.find_first_at_or_after(from));
+
+        std::size_t expected_previous = from;
+        while (expected_previous != WordBitset<BIT_COUNT>::NO_INDEX &&
+               !expected.test(expected_previous))
+        {
+            expected_previous--;
+        }
+        ASSERT_EQ(expected_previous, actual.find_last_at_or_before(from));
+    }
+}
+
+}  // namespace fixed_containers::word_bitset_detail